@@ -78,6 +78,7 @@ void GameRPG::InitGame()
     fireSound->SetLoop(true);
     fireSound->SetVolume(0.5f);
     fireSound->SetUseDistanceAttenuation(true);
+    fireSound->SetCategory(toy::SoundCategory::Ambient);
     fireSound->Play();
 
 
@@ -87,14 +88,7 @@ void GameRPG::InitGame()
     auto particleActor = CreateActor<toy::Actor>();
     particleActor->SetPosition(Vector3(0, 0, 0));
     auto particleComp = particleActor->CreateComponent<toy::ParticleComponent>();
-    particleComp->SetTexture(GetAssetManager()->GetTexture("fire.png"));
-    particleComp->CreateParticles(Vector3(0, 0, 0),
-                                  10,
-                                  1000,
-                                  0.3f,
-                                  5.5,
-                                  toy::ParticleComponent::P_SMOKE);
-    particleComp->SetAddBlend(true);
+    particleComp->SetEffect(GetAssetManager()->GetParticleEffect("fire_effect.json"));
     particleActor->SetParent(fireActor);
 
     
@@ -243,6 +237,7 @@ void GameRPG::LoadData()
     wolfSound->SetSound("growling.wav");
     wolfSound->SetLoop(true);
     wolfSound->SetUseDistanceAttenuation(true);
+    wolfSound->SetCategory(toy::SoundCategory::Ambient);
     wolfSound->Play();
 
 
@@ -274,14 +269,15 @@ void GameRPG::LoadData()
     
     
     
-    // フォント
-    auto fnt = GetAssetManager()->GetFont("rounded-mplus-1c-bold.ttf", 24);
+    // フォント（距離場。サイズは SetFontSize で決める）
+    auto fnt = GetAssetManager()->GetSdfFont("rounded-mplus-1c-bold.ttf");
     // テキスト用 Actor を作成
     auto uiActor = CreateActor<toy::Actor>();
     uiActor->SetPosition(Vector3(600.0f, 360.0f, 0.0f)); // 2Dスクリーン座標として扱う
 
     auto textComp = uiActor->CreateComponent<toy::TextSpriteComponent>();
     textComp->SetFont(fnt);
+    textComp->SetFontSize(24.0f);
     textComp->SetFormat("");
     textComp->SetColor(Vector3(1.0f, 1.0f, 0.0f)); // 黄
     mTextComp = textComp;
@@ -0,0 +1,106 @@
+#version 410 core
+
+//======================================================================
+//  BillboardInstanced.vert
+//  ・パーティクル／ビルボードのインスタンス描画用（BillboardBatch）
+//  ・1 枚の四角形をインスタンスごとの位置・大きさ・色・UV で描く
+//  ・フラグメントは Particle.frag（無灯）か Phong.frag（ライティングあり）
+//======================================================================
+
+
+//======================================================================
+//  Uniforms
+//======================================================================
+
+// ワールド → クリップ行列
+uniform mat4 uViewProj;
+
+// ワールド → ライト空間行列（Phong.frag のシャドウ参照用）
+uniform mat4 uLightSpaceMatrix;
+
+// カメラ（ワールド座標・右方向・上方向）
+uniform vec3 uCameraPos;
+uniform vec3 uCameraRight;
+uniform vec3 uCameraUp;
+
+// true  : Y 軸だけ回してカメラへ向ける（立て看板）
+// false : カメラに正対（パーティクル）
+uniform bool uUpright;
+
+
+//======================================================================
+//  Attributes
+//======================================================================
+
+// 四角形の角（-0.5〜+0.5）と UV
+layout(location = 0) in vec2 inCorner;
+layout(location = 2) in vec2 inTexCoord;
+
+// インスタンス（BillboardInstance と同じ並び）
+layout(location = 3) in vec4 inInstancePosLife;  // xyz: 中心, w: 寿命の経過率
+layout(location = 4) in vec4 inInstanceColor;    // 乗算色
+layout(location = 5) in vec4 inInstanceUV;       // xy: 左上 UV, zw: 右下 UV
+layout(location = 6) in vec2 inInstanceSize;     // ワールドでの幅・高さ
+
+
+//======================================================================
+//  Varyings（フラグメントへ渡す）
+//======================================================================
+out vec2  fragTexCoord;
+out vec3  fragNormal;
+out vec3  fragWorldPos;
+out vec4  fragPosLightSpace;
+out vec4  fragColor;
+out float fragLife;
+
+
+//======================================================================
+//  main()
+//======================================================================
+void main()
+{
+    vec3 center = inInstancePosLife.xyz;
+
+    //------------------------------------------------------------------
+    // Step 1 : 向き（右・上・カメラへ向く法線）
+    //------------------------------------------------------------------
+    vec3 right;
+    vec3 up;
+    vec3 normal;
+    if (uUpright)
+    {
+        // 水平面でカメラから見た向きに合わせて Y 軸回転
+        vec3 dir = center - uCameraPos;
+        dir.y = 0.0;
+        dir = (dot(dir, dir) > 1e-8) ? normalize(dir) : vec3(0.0, 0.0, 1.0);
+        right  = vec3(dir.z, 0.0, -dir.x);
+        up     = vec3(0.0, 1.0, 0.0);
+        normal = -dir;
+    }
+    else
+    {
+        right  = uCameraRight;
+        up     = uCameraUp;
+        normal = -normalize(cross(uCameraRight, uCameraUp));   // 視線の逆
+    }
+
+    //------------------------------------------------------------------
+    // Step 2 : 角をワールドへ展開して投影
+    //------------------------------------------------------------------
+    vec3 worldPos = center
+                  + right * (inCorner.x * inInstanceSize.x)
+                  + up    * (inCorner.y * inInstanceSize.y);
+
+    vec4 pos = vec4(worldPos, 1.0);
+    gl_Position = pos * uViewProj;
+
+    //------------------------------------------------------------------
+    // Step 3 : フラグメントへ
+    //------------------------------------------------------------------
+    fragWorldPos      = worldPos;
+    fragNormal        = normal;
+    fragPosLightSpace = pos * uLightSpaceMatrix;
+    fragTexCoord      = mix(inInstanceUV.xy, inInstanceUV.zw, inTexCoord);
+    fragColor         = inInstanceColor;
+    fragLife          = inInstancePosLife.w;
+}
@@ -0,0 +1,140 @@
+#version 410 core
+
+//======================================================================
+//  CrowdSkinned.vert
+//
+//  群衆（同一スキンメッシュの大量インスタンス）用の頂点シェーダ。
+//  ・ボーン行列は CPU で計算せず、焼き込みテクスチャからフェッチ
+//  ・インスタンスごとにワールド行列とクリップ・再生位相を持つ
+//  ・前後 2 フレームの行列を線形補間して滑らかにする
+//
+//  ※ ToyLib は「行ベクトル × 行列 (v * M)」で統一。
+//======================================================================
+
+// ---------------------------------------------------------
+// Uniforms
+// ---------------------------------------------------------
+
+// 群衆全体のワールド変換（Actor のワールド行列）
+uniform mat4 uWorldTransform;
+
+// ワールド → クリップ（ビューProj）
+uniform mat4 uViewProj;
+
+// ワールド → ライト空間（LightProj * LightView）
+uniform mat4 uLightSpaceMatrix;
+
+// 焼き込み済みボーン行列（BakedAnimation）
+//  x = ボーン * 3 + 列、y = フレーム行
+uniform sampler2D uBakedPalette;
+
+// 経過時間（秒）
+uniform float uTime;
+
+// 量子化頂点の復元（VertexArray::GetQuantization と対応）
+uniform bool uQuantized;
+uniform vec3 uPosScale;
+uniform vec3 uPosOffset;
+
+
+// ---------------------------------------------------------
+// Attributes（頂点属性）
+// ---------------------------------------------------------
+layout(location = 0) in vec3 inPosition;    // 頂点位置
+layout(location = 1) in vec3 inNormal;      // 法線
+layout(location = 2) in vec2 inTexCoord;    // UV
+layout(location = 3) in uvec4 inSkinBones;  // 影響ボーンID（最大4本）
+layout(location = 4) in vec4  inSkinWeights;// ボーンウェイト
+
+// インスタンス属性（CrowdMeshComponent が 1 インスタンス 1 回進める）
+layout(location = 5) in vec4 inInstanceCol0;  // ワールド行列 0 列目
+layout(location = 6) in vec4 inInstanceCol1;  // 1 列目
+layout(location = 7) in vec4 inInstanceCol2;  // 2 列目
+layout(location = 8) in vec4 inInstanceAnim;  // 先頭行, フレーム数, フレーム/秒, 開始フレーム
+
+
+// ---------------------------------------------------------
+// Varyings（フラグメントシェーダへ渡す値）
+// ---------------------------------------------------------
+out vec2 fragTexCoord;       // UV
+out vec3 fragNormal;         // ワールド空間の法線
+out vec3 fragWorldPos;       // ワールド座標
+out vec4 fragPosLightSpace;  // ライト空間座標（シャドウマップ用）
+
+
+// ---------------------------------------------------------
+// 八面体エンコード法線の復元
+// ---------------------------------------------------------
+vec3 OctDecode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += (n.x >= 0.0) ? -t : t;
+    n.y += (n.y >= 0.0) ? -t : t;
+    return normalize(n);
+}
+
+
+// ---------------------------------------------------------
+// 焼き込みテクスチャからボーン行列を 1 本取り出す
+// ---------------------------------------------------------
+mat4 FetchBone(uint bone, int row)
+{
+    int x = int(bone) * 3;
+    return mat4(texelFetch(uBakedPalette, ivec2(x + 0, row), 0),
+                texelFetch(uBakedPalette, ivec2(x + 1, row), 0),
+                texelFetch(uBakedPalette, ivec2(x + 2, row), 0),
+                vec4(0.0, 0.0, 0.0, 1.0));
+}
+
+mat4 FetchSkin(int row)
+{
+    return FetchBone(inSkinBones[0], row) * inSkinWeights[0]
+         + FetchBone(inSkinBones[1], row) * inSkinWeights[1]
+         + FetchBone(inSkinBones[2], row) * inSkinWeights[2]
+         + FetchBone(inSkinBones[3], row) * inSkinWeights[3];
+}
+
+
+// ---------------------------------------------------------
+// メイン
+// ---------------------------------------------------------
+void main()
+{
+    // 1) 再生位置 → フレーム行（ループ）
+    //    最終フレームはクリップ末尾なので [0, numFrames - 1) で回す
+    float firstRow  = inInstanceAnim.x;
+    float numFrames = inInstanceAnim.y;
+    float span      = max(numFrames - 1.0, 1.0);
+    float frame     = mod(uTime * inInstanceAnim.z + inInstanceAnim.w, span);
+    int   f0        = int(floor(frame));
+    float t         = frame - float(f0);
+    int   row0      = int(firstRow) + f0;
+
+    // 2) 前後フレームのスキニング行列を補間
+    mat4 skinMat = FetchSkin(row0) * (1.0 - t) + FetchSkin(row0 + 1) * t;
+
+    // 3) インスタンスのワールド行列（アフィンなので 4 列目は固定）
+    mat4 instance = mat4(inInstanceCol0, inInstanceCol1, inInstanceCol2,
+                         vec4(0.0, 0.0, 0.0, 1.0));
+    mat4 world = instance * uWorldTransform;
+
+    // 4) 頂点位置のスキニング → ワールド
+    vec3 localPos = uQuantized ? inPosition * uPosScale + uPosOffset : inPosition;
+    vec4 skinnedPos = vec4(localPos, 1.0) * skinMat * world;
+    fragWorldPos = skinnedPos.xyz;
+
+    // 5) ワールド → クリップ（ビュー射影）
+    gl_Position = skinnedPos * uViewProj;
+
+    // 6) 法線（w = 0）
+    vec3 normal = uQuantized ? OctDecode(inNormal.xy) : inNormal;
+    vec4 n = vec4(normal, 0.0) * skinMat * world;
+    fragNormal = normalize(n.xyz);
+
+    // 7) UV をそのまま転送
+    fragTexCoord = inTexCoord;
+
+    // 8) シャドウマップ用：ライト空間座標
+    fragPosLightSpace = skinnedPos * uLightSpaceMatrix;
+}
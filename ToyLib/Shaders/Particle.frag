@@ -17,6 +17,9 @@ in vec2 fragTexCoord;
 // パーティクルのワールド座標
 in vec3 fragWorldPos;
 
+// インスタンスごとの乗算色
+in vec4 fragColor;
+
 
 //======================================================================
 //  Outputs
@@ -44,9 +47,8 @@ uniform vec3 uCameraPos;
 void main()
 {
     //------------------------------------------------------------------
-    // Step 1 : テクスチャカラーをそのまま出力
-    //          ※アルファはテクスチャ側に依存
+    // Step 1 : テクスチャカラー × インスタンスの色
     //          ※ブレンドはOpenGL側で設定（加算/アルファブレンド等）
     //------------------------------------------------------------------
-    outColor = texture(uTexture, fragTexCoord);
+    outColor = texture(uTexture, fragTexCoord) * fragColor;
 }
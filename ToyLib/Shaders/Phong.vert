@@ -20,6 +20,17 @@ uniform mat4 uViewProj;
 // ワールド → ライト空間行列（シャドウマップ生成用）
 uniform mat4 uLightSpaceMatrix;
 
+// 量子化頂点の復元（VertexArray::GetQuantization と対応）
+//  uQuantized = true のとき位置は -1..1、法線は八面体エンコード
+uniform bool uQuantized;
+uniform vec3 uPosScale;
+uniform vec3 uPosOffset;
+
+// テクスチャの使用領域（ビルボードがアトラスの 1 枚を使うとき）
+//  UV = uTexOffset + inTexCoord * uTexScale。既定は全体
+uniform vec2 uTexOffset = vec2(0.0, 0.0);
+uniform vec2 uTexScale  = vec2(1.0, 1.0);
+
 
 //======================================================================
 //  Vertex Attributes
@@ -50,6 +61,19 @@ out vec3 fragWorldPos;
 out vec4 fragPosLightSpace;
 
 
+//======================================================================
+//  八面体エンコード法線の復元
+//======================================================================
+vec3 OctDecode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += (n.x >= 0.0) ? -t : t;
+    n.y += (n.y >= 0.0) ? -t : t;
+    return normalize(n);
+}
+
+
 //======================================================================
 //  main()
 //======================================================================
@@ -58,7 +82,8 @@ void main()
     //------------------------------------------------------------------
     // Step 1 : 頂点座標をワールド空間へ
     //------------------------------------------------------------------
-    vec4 worldPos = vec4(inPosition, 1.0) * uWorldTransform;
+    vec3 localPos = uQuantized ? inPosition * uPosScale + uPosOffset : inPosition;
+    vec4 worldPos = vec4(localPos, 1.0) * uWorldTransform;
     fragWorldPos = worldPos.xyz;
 
     //------------------------------------------------------------------
@@ -69,12 +94,13 @@ void main()
     //------------------------------------------------------------------
     // Step 3 : 法線をワールド空間で変換（スケールも含める）
     //------------------------------------------------------------------
-    fragNormal = normalize(mat3(uWorldTransform) * inNormal);
+    vec3 normal = uQuantized ? OctDecode(inNormal.xy) : inNormal;
+    fragNormal = normalize(mat3(uWorldTransform) * normal);
 
     //------------------------------------------------------------------
-    // Step 4 : UV そのまま渡す
+    // Step 4 : UV を使用領域へ写して渡す（通常のメッシュは全体のまま）
     //------------------------------------------------------------------
-    fragTexCoord = inTexCoord;
+    fragTexCoord = uTexOffset + inTexCoord * uTexScale;
 
     //------------------------------------------------------------------
     // Step 5 : ライト空間座標（シャドウマップで使う）
@@ -0,0 +1,70 @@
+#version 410 core
+
+//======================================================================
+//  ShadowMapping_Crowd.vert
+//
+//  群衆インスタンス用のシャドウマッピング頂点シェーダ。
+//  ・CrowdSkinned.vert と同じく焼き込みテクスチャでスキニング
+//  ・深度だけなので補間は行わず、近い方のフレームを使う
+//======================================================================
+
+// ---------------------------------------------------------
+// Uniforms
+// ---------------------------------------------------------
+uniform mat4 uWorldTransform;
+uniform mat4 uLightSpaceMatrix;
+
+uniform sampler2D uBakedPalette;
+uniform float uTime;
+
+// 量子化頂点の位置復元（VertexArray::GetQuantization と対応）
+uniform bool uQuantized;
+uniform vec3 uPosScale;
+uniform vec3 uPosOffset;
+
+
+// ---------------------------------------------------------
+// 頂点属性
+// ---------------------------------------------------------
+layout(location = 0) in vec3 inPosition;
+layout(location = 3) in uvec4 inSkinBones;
+layout(location = 4) in vec4  inSkinWeights;
+
+layout(location = 5) in vec4 inInstanceCol0;
+layout(location = 6) in vec4 inInstanceCol1;
+layout(location = 7) in vec4 inInstanceCol2;
+layout(location = 8) in vec4 inInstanceAnim;
+
+
+mat4 FetchBone(uint bone, int row)
+{
+    int x = int(bone) * 3;
+    return mat4(texelFetch(uBakedPalette, ivec2(x + 0, row), 0),
+                texelFetch(uBakedPalette, ivec2(x + 1, row), 0),
+                texelFetch(uBakedPalette, ivec2(x + 2, row), 0),
+                vec4(0.0, 0.0, 0.0, 1.0));
+}
+
+
+// ---------------------------------------------------------
+// メインシェーダ
+// ---------------------------------------------------------
+void main()
+{
+    float span  = max(inInstanceAnim.y - 1.0, 1.0);
+    float frame = mod(uTime * inInstanceAnim.z + inInstanceAnim.w, span);
+    int   row   = int(inInstanceAnim.x) + int(frame + 0.5);
+
+    mat4 skinMat = FetchBone(inSkinBones[0], row) * inSkinWeights[0]
+                 + FetchBone(inSkinBones[1], row) * inSkinWeights[1]
+                 + FetchBone(inSkinBones[2], row) * inSkinWeights[2]
+                 + FetchBone(inSkinBones[3], row) * inSkinWeights[3];
+
+    mat4 instance = mat4(inInstanceCol0, inInstanceCol1, inInstanceCol2,
+                         vec4(0.0, 0.0, 0.0, 1.0));
+
+    vec3 localPos = uQuantized ? inPosition * uPosScale + uPosOffset : inPosition;
+    vec4 worldPos = vec4(localPos, 1.0) * skinMat * instance * uWorldTransform;
+
+    gl_Position = worldPos * uLightSpaceMatrix;
+}
@@ -17,6 +17,10 @@
 uniform mat4 uWorldTransform;
 // ワールド → ライト空間変換（LightProj * LightView）
 uniform mat4 uLightSpaceMatrix;
+// 量子化頂点の位置復元（VertexArray::GetQuantization と対応）
+uniform bool uQuantized;
+uniform vec3 uPosScale;
+uniform vec3 uPosOffset;
 
 // === 頂点属性 ===
 // メッシュは深度パスでは位置のみ使用する
@@ -26,7 +30,8 @@ void main()
 {
     // ワールド変換 → ライト空間変換
     // gl_Position にライト空間座標を設定
-    gl_Position = vec4(inPosition, 1.0) * uWorldTransform * uLightSpaceMatrix;
+    vec3 localPos = uQuantized ? inPosition * uPosScale + uPosOffset : inPosition;
+    gl_Position = vec4(localPos, 1.0) * uWorldTransform * uLightSpaceMatrix;
 
     // ※ 注意 ※
     // 深度マップでは gl_FragDepth が自動で書き込まれるため、
@@ -16,7 +16,13 @@
 // ---------------------------------------------------------
 
 // ボーン変換行列パレット（最大96ボーン）
-uniform mat4 uMatrixPalette[96];
+//  - 全スキンメッシュ共通の UBO（MatrixPaletteBuffer）の一部を
+//    描画ごとに glBindBufferRange で割り当てる
+//  - CPU 側の Matrix4 は行優先で並んでいるので row_major で読む
+layout(std140, row_major) uniform MatrixPalette
+{
+    mat4 uMatrixPalette[96];
+};
 
 // モデル → ワールド変換
 uniform mat4 uWorldTransform;
@@ -24,6 +30,11 @@ uniform mat4 uWorldTransform;
 // ワールド → ライト空間変換（LightProj * LightView）
 uniform mat4 uLightSpaceMatrix;
 
+// 量子化頂点の位置復元（VertexArray::GetQuantization と対応）
+uniform bool uQuantized;
+uniform vec3 uPosScale;
+uniform vec3 uPosOffset;
+
 
 // ---------------------------------------------------------
 // 頂点属性（頂点バッファ）
@@ -39,7 +50,8 @@ layout(location = 4) in vec4  inSkinWeights; // ボーンウエイト（4つ）
 void main()
 {
     // 1) スキニング処理
-    vec4 pos = vec4(inPosition, 1.0);
+    vec3 localPos = uQuantized ? inPosition * uPosScale + uPosOffset : inPosition;
+    vec4 pos = vec4(localPos, 1.0);
 
     // 4ボーンの線形合成
     mat4 skinMat =
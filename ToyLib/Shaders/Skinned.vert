@@ -23,11 +23,23 @@ uniform mat4 uWorldTransform;
 uniform mat4 uViewProj;
 
 // スキニング用ボーン行列パレット
-uniform mat4 uMatrixPalette[96];
+//  - 全スキンメッシュ共通の UBO（MatrixPaletteBuffer）の一部を
+//    描画ごとに glBindBufferRange で割り当てる
+//  - CPU 側の Matrix4 は行優先で並んでいるので row_major で読む
+layout(std140, row_major) uniform MatrixPalette
+{
+    mat4 uMatrixPalette[96];
+};
 
 // ワールド → ライト空間（LightProj * LightView）
 uniform mat4 uLightSpaceMatrix;
 
+// 量子化頂点の復元（VertexArray::GetQuantization と対応）
+//  uQuantized = true のとき位置は -1..1、法線は八面体エンコード
+uniform bool uQuantized;
+uniform vec3 uPosScale;
+uniform vec3 uPosOffset;
+
 
 // ---------------------------------------------------------
 // Attributes（頂点属性）
@@ -48,13 +60,27 @@ out vec3 fragWorldPos;       // ワールド座標
 out vec4 fragPosLightSpace;  // ライト空間座標（シャドウマップ用）
 
 
+// ---------------------------------------------------------
+// 八面体エンコード法線の復元
+// ---------------------------------------------------------
+vec3 OctDecode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += (n.x >= 0.0) ? -t : t;
+    n.y += (n.y >= 0.0) ? -t : t;
+    return normalize(n);
+}
+
+
 // ---------------------------------------------------------
 // メイン
 // ---------------------------------------------------------
 void main()
 {
-    // 1) 入力位置を vec4 に拡張
-    vec4 pos = vec4(inPosition, 1.0);
+    // 1) 入力位置を vec4 に拡張（量子化されていれば復元）
+    vec3 localPos = uQuantized ? inPosition * uPosScale + uPosOffset : inPosition;
+    vec4 pos = vec4(localPos, 1.0);
 
     // 2) スキニング行列を作成（ボーン4本分の線形結合）
     mat4 skinMat =
@@ -75,7 +101,8 @@ void main()
 
     // 6) 法線のスキニング＆ワールド変換
     //    ※ 法線は w = 0 として扱う
-    vec4 n = vec4(inNormal, 0.0);
+    vec3 normal = uQuantized ? OctDecode(inNormal.xy) : inNormal;
+    vec4 n = vec4(normal, 0.0);
     n = n * skinMat;             // スキニング
     n = n * uWorldTransform;     // ワールド変換
     fragNormal = normalize(n.xyz);
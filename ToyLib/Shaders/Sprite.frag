@@ -31,6 +31,14 @@ out vec4 outColor;
 //------------------------------------------------------------------------
 uniform sampler2D uTexture;
 
+//------------------------------------------------------------------------
+// 配列テクスチャ（uUseArray のとき uTextureArray の uLayer 層を読む）
+//   - uTexture と同じユニットは使えないので Renderer がユニット 1 に固定
+//------------------------------------------------------------------------
+uniform sampler2DArray uTextureArray;
+uniform bool  uUseArray;
+uniform float uLayer;
+
 
 //======================================================================
 // メイン
@@ -38,5 +46,7 @@ uniform sampler2D uTexture;
 void main()
 {
     // スプライトは基本的にそのままテクスチャ色を出力
-    outColor = texture(uTexture, fragTexCoord);
+    outColor = uUseArray
+        ? texture(uTextureArray, vec3(fragTexCoord, uLayer))
+        : texture(uTexture, fragTexCoord);
 }
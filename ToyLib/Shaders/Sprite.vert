@@ -23,6 +23,11 @@ uniform mat4 uWorldTransform;
 // UI の場合は Renderer 側で画面直交行列を設定する
 uniform mat4 uViewProj;
 
+// テクスチャの使用領域（アトラスの 1 枚など）
+//  UV = uTexOffset + inTexCoord * uTexScale。既定は全体
+uniform vec2 uTexOffset = vec2(0.0, 0.0);
+uniform vec2 uTexScale  = vec2(1.0, 1.0);
+
 
 //------------------------------------------------------------------------
 // Attributes
@@ -53,6 +58,6 @@ void main()
     // gl_Position は最終クリップ空間座標
     gl_Position = pos * uWorldTransform * uViewProj;
 
-    // UV をそのまま出力
-    fragTexCoord = inTexCoord;
+    // UV を使用領域へ写して出力
+    fragTexCoord = uTexOffset + inTexCoord * uTexScale;
 }
@@ -0,0 +1,60 @@
+#version 410 core
+
+//======================================================================
+//  SpriteBatch.frag
+//
+//  ・SpriteBatch でまとめた 2D スプライト用のフラグメントシェーダ
+//  ・テクスチャ色に頂点色を掛けて出す（通常のスプライトは白なので Sprite.frag と同じ）
+//  ・uDistanceField のときはアルファを距離場として輪郭を描く（SDF フォント）
+//======================================================================
+
+//------------------------------------------------------------------------
+// 頂点シェーダーから受け取るデータ
+//------------------------------------------------------------------------
+in vec2 fragTexCoord;
+flat in float fragLayer;
+in vec4 fragColor;
+
+//------------------------------------------------------------------------
+// 出力
+//------------------------------------------------------------------------
+out vec4 outColor;
+
+//------------------------------------------------------------------------
+// テクスチャ
+//   - 通常はユニット 0 の uTexture
+//   - uUseArray のときはユニット 1 の uTextureArray の fragLayer 層
+//------------------------------------------------------------------------
+uniform sampler2D      uTexture;
+uniform sampler2DArray uTextureArray;
+uniform bool           uUseArray;
+
+//------------------------------------------------------------------------
+// 距離場
+//   - アルファ 0.5 が輪郭、内側ほど大きい
+//   - 縁のぼかし幅は画面上の 1 ピクセル分（fwidth）なので、
+//     拡大・縮小しても縁の鋭さが変わらない
+//------------------------------------------------------------------------
+uniform bool uDistanceField;
+
+
+//======================================================================
+// メイン
+//======================================================================
+void main()
+{
+    vec4 texColor = uUseArray
+        ? texture(uTextureArray, vec3(fragTexCoord, fragLayer))
+        : texture(uTexture, fragTexCoord);
+    if (uDistanceField)
+    {
+        float dist  = texColor.a;
+        float width = max(fwidth(dist) * 0.7, 1e-4);
+        float cover = smoothstep(0.5 - width, 0.5 + width, dist);
+        outColor = vec4(fragColor.rgb, fragColor.a * cover);
+    }
+    else
+    {
+        outColor = texColor * fragColor;
+    }
+}
@@ -0,0 +1,44 @@
+#version 410 core
+
+//======================================================================
+//  SpriteBatch.vert
+//
+//  ・SpriteBatch でまとめた 2D スプライト用の頂点シェーダ
+//  ・頂点は CPU 側で画面座標まで変換済み（ワールド行列なし）
+//  ・配列テクスチャの層・乗算色も頂点ごとに受け取る
+//======================================================================
+
+//------------------------------------------------------------------------
+// Uniforms
+//------------------------------------------------------------------------
+// 画面座標 → クリップ空間（Matrix4::CreateSimpleViewProj）
+uniform mat4 uViewProj;
+
+
+//------------------------------------------------------------------------
+// Attributes（SpriteBatch::Vertex と対応）
+//------------------------------------------------------------------------
+layout(location = 0) in vec2  inPosition;
+layout(location = 1) in vec2  inTexCoord;
+layout(location = 2) in float inLayer;
+layout(location = 3) in vec4  inColor;
+
+
+//------------------------------------------------------------------------
+// フラグメントシェーダーへ渡すデータ
+//------------------------------------------------------------------------
+out vec2 fragTexCoord;
+flat out float fragLayer;
+out vec4 fragColor;
+
+
+//======================================================================
+// メイン
+//======================================================================
+void main()
+{
+    gl_Position  = vec4(inPosition, 0.0, 1.0) * uViewProj;
+    fragTexCoord = inTexCoord;
+    fragLayer    = inLayer;
+    fragColor    = inColor;
+}
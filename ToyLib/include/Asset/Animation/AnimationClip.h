@@ -1,14 +1,49 @@
 #pragma once
 
+#include "Utils/MathUtil.h"
+#include <cstdint>
 #include <string>
-#include <assimp/scene.h>
+#include <vector>
 
 namespace toy {
 
+//======================================================================
+// NodeAnimation
+//   - 1 ノード分の位置 / 回転 / スケールのキー列（SoA）
+//   - 時刻（Tick 単位）と値を別配列に持つので、キー検索は
+//     時刻配列だけを連続して読めばよい
+//======================================================================
+struct NodeAnimation
+{
+    std::string             mNodeName;
+
+    std::vector<float>      mPositionTimes;
+    std::vector<Vector3>    mPositions;
+
+    std::vector<float>      mRotationTimes;
+    std::vector<Quaternion> mRotations;
+
+    std::vector<float>      mScalingTimes;
+    std::vector<Vector3>    mScalings;
+
+    // 圧縮済みの値（AnimationCompression::Compress 後）
+    //  - mIsCompressed のとき上の値配列は空になり、代わりに
+    //    キーごとに uint16 を 3 つずつ持つ（時刻配列はそのまま）
+    //  - 位置 / スケールは範囲量子化、回転は smallest-three（48 bit）
+    bool                    mIsCompressed = false;
+    std::vector<uint16_t>   mPackedPositions;
+    std::vector<uint16_t>   mPackedRotations;
+    std::vector<uint16_t>   mPackedScalings;
+    Vector3                 mPositionMin    = Vector3::Zero;
+    Vector3                 mPositionExtent = Vector3::Zero;
+    Vector3                 mScalingMin     = Vector3::Zero;
+    Vector3                 mScalingExtent  = Vector3::Zero;
+};
+
 //======================================================================
 // AnimationClip
-//   - Assimp から取得した aiAnimation 1本分をラップする軽量構造体
-//   - 「クリップ名」「Assimp の生ポインタ」「長さ」「再生レート」を保持
+//   - アニメーション 1 本分（Assimp の aiAnimation から変換して保持）
+//   - 「クリップ名」「ノードごとのキー列」「長さ」「再生レート」を保持
 //   - 実際のポーズ計算は Mesh::ComputePoseAtTime() などが担当
 //======================================================================
 struct AnimationClip
@@ -17,9 +52,13 @@ struct AnimationClip
     //  - FBX/GLTF 内のアニメーション名や、ゲーム側での識別子を入れる
     std::string       mName;
 
-    // Assimp のアニメーションデータ（所有権は Assimp/Mesh 側）
-    //  - AnimationPlayer などがこのポインタを使ってサンプリングする
-    const aiAnimation* mAnimation = nullptr;
+    // ノードごとのキー列（所有権はクリップ側）
+    //  - AnimationPlayer などがこのクリップを使ってサンプリングする
+    std::vector<NodeAnimation> mChannels;
+
+    // スケルトンのノード番号 → mChannels の番号（-1 はキー無し）
+    //  - 読み込み時に名前で一度だけ対応付ける
+    std::vector<int>  mNodeChannels;
 
     // アニメーションの長さ（Assimp の Tick 単位）
     //  - 実際の再生時間(sec) = mDuration / mTicksPerSecond
@@ -30,4 +69,28 @@ struct AnimationClip
     float             mTicksPerSecond  = 0.0f;
 };
 
+//======================================================================
+// AnimationCursor
+//   - 再生側（AnimationPlayer など）が持つ「前回どのキーにいたか」の記録
+//   - チャネルごとに 位置 / 回転 / スケール の 3 つを持つ
+//   - 順方向再生なら前回位置から数キー進めるだけで済み、
+//     シークやループで戻ったときは二分探索にフォールバックする
+//======================================================================
+struct AnimationCursor
+{
+    const AnimationClip*      mClip = nullptr;
+    std::vector<unsigned int> mKeys;   // [channel * 3 + {0:pos, 1:rot, 2:scale}]
+
+    // 別のクリップに切り替わったら作り直す
+    void Bind(const AnimationClip& clip)
+    {
+        if (mClip == &clip && mKeys.size() == clip.mChannels.size() * 3)
+        {
+            return;
+        }
+        mClip = &clip;
+        mKeys.assign(clip.mChannels.size() * 3, 0);
+    }
+};
+
 } // namespace toy
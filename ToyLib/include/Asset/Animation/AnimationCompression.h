@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+#include "Asset/Animation/AnimationClip.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace toy {
+
+//======================================================================
+// AnimationCompressionSettings
+//   - 許容誤差はキー削減（線形補間で再現できるキーを落とす）に使う
+//   - 量子化の誤差はこれとは別に乗る（位置は範囲の 1/65535、
+//     回転は 1 成分あたり約 4e-5）
+//======================================================================
+struct AnimationCompressionSettings
+{
+    bool  enabled           = true;
+    float positionTolerance = 0.0005f;   // モデル単位
+    float rotationTolerance = 0.0005f;   // ラジアン
+    float scaleTolerance    = 0.0005f;   // 倍率
+};
+
+//======================================================================
+// AnimationCompressionStats
+//   - Compress() の結果（メモリは値と時刻の配列だけを数える）
+//   - 誤差は元の全キー時刻で、圧縮後のトラックを補間した値と比べたもの
+//======================================================================
+struct AnimationCompressionStats
+{
+    size_t rawBytes        = 0;
+    size_t compressedBytes = 0;
+    size_t rawKeys         = 0;
+    size_t keptKeys        = 0;
+    float  maxPositionError = 0.0f;   // モデル単位
+    float  maxRotationError = 0.0f;   // ラジアン
+    float  maxScaleError    = 0.0f;
+};
+
+//======================================================================
+// AnimationCompression
+//   - 読み込み後のクリップをその場で圧縮する
+//   - 展開はサンプラ（Mesh::CalcInterpolated*）が補間に使う
+//     2 キーだけを都度行う。下の Decode* はそのためのインライン関数
+//======================================================================
+namespace AnimationCompression {
+
+/**
+ * @brief クリップ内の全チャネルをキー削減＋量子化する。
+ *
+ * - 既に圧縮済みのチャネルはそのまま（統計にはメモリだけ数える）
+ */
+AnimationCompressionStats Compress(AnimationClip& clip,
+                                   const AnimationCompressionSettings& settings);
+
+/**
+ * @brief クリップのキーデータが使っているバイト数（圧縮の有無どちらでも）。
+ */
+size_t ComputeMemory(const AnimationClip& clip);
+
+//----------------------------------------------------------------------
+// 展開
+//----------------------------------------------------------------------
+
+// 範囲量子化した 3 成分
+inline Vector3 DecodeVector3(const uint16_t* p, const Vector3& min, const Vector3& extent)
+{
+    constexpr float kInv = 1.0f / 65535.0f;
+    return Vector3(min.x + p[0] * kInv * extent.x,
+                   min.y + p[1] * kInv * extent.y,
+                   min.z + p[2] * kInv * extent.z);
+}
+
+// smallest-three（15 bit × 3 ＋ 省いた成分の番号 2 bit）
+//  - 省いた成分は最大成分かつ正になるよう符号をそろえてある
+inline Quaternion DecodeQuaternion(const uint16_t* p)
+{
+    constexpr float kRange = 0.70710678f;               // 1 / sqrt(2)
+    constexpr float kScale = 2.0f * kRange / 32767.0f;
+
+    const int largest = ((p[0] >> 15) & 1) | (((p[1] >> 15) & 1) << 1);
+    const float a = (p[0] & 0x7fff) * kScale - kRange;
+    const float b = (p[1] & 0x7fff) * kScale - kRange;
+    const float c = (p[2] & 0x7fff) * kScale - kRange;
+    const float d = std::sqrt(std::fmax(0.0f, 1.0f - a * a - b * b - c * c));
+
+    switch (largest)
+    {
+        case 0:  return Quaternion(d, a, b, c);
+        case 1:  return Quaternion(a, d, b, c);
+        case 2:  return Quaternion(a, b, d, c);
+        default: return Quaternion(a, b, c, d);
+    }
+}
+
+} // namespace AnimationCompression
+} // namespace toy
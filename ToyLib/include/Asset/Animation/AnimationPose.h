@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//======================================================================
+// BoneTransform
+//   - 1 ノード分のローカル変換を 平行移動 / 回転 / スケール に分けたもの
+//   - 行列にするときはキー補間と同じ R * T * S の順で合成する
+//   - ブレンドは成分ごと（位置・スケールは Lerp、回転は Slerp）
+//======================================================================
+struct BoneTransform
+{
+    Vector3    mTranslation = Vector3::Zero;
+    Quaternion mRotation    = Quaternion::Identity;
+    Vector3    mScale       = Vector3(1.0f, 1.0f, 1.0f);
+
+    Matrix4 ToMatrix() const
+    {
+        return Matrix4::CreateFromQuaternion(mRotation) *
+               Matrix4::CreateTranslation(mTranslation) *
+               Matrix4::CreateScale(mScale);
+    }
+
+    // R * T * S で合成された行列を分解（シアーは無い前提）
+    static BoneTransform FromMatrix(const Matrix4& m);
+
+    // a → b を t で補間
+    static BoneTransform Blend(const BoneTransform& a, const BoneTransform& b, float t);
+};
+
+//======================================================================
+// AnimationPose
+//   - スケルトンの全ノードのローカル TRS（インデックス = ノード番号）
+//   - mAnimated はいずれかのクリップのキーで上書きされたノードだけ 1
+//     （0 のノードは階層計算でバインド行列をそのまま使う）
+//======================================================================
+struct AnimationPose
+{
+    std::vector<BoneTransform> mLocals;
+    std::vector<uint8_t>       mAnimated;
+
+    void Resize(size_t numNodes)
+    {
+        mLocals.resize(numNodes);
+        mAnimated.resize(numNodes);
+    }
+
+    size_t GetNumNodes() const { return mLocals.size(); }
+};
+
+//======================================================================
+// BoneMask
+//   - ノードごとのブレンド重み（0〜1）。空なら全ノード 1 扱い
+//   - 上半身だけ別アニメ、などのレイヤーに使う
+//======================================================================
+struct BoneMask
+{
+    std::vector<float> mWeights;
+
+    float GetWeight(size_t node) const
+    {
+        return mWeights.empty() ? 1.0f : mWeights[node];
+    }
+
+    /**
+     * @brief rootName のノードとその子孫に weight、それ以外に 0 を入れたマスクを作る。
+     *
+     * - ノードが見つからなければ空（= 全身）を返す
+     */
+    static BoneMask FromSubtree(const struct Skeleton& skeleton,
+                                const std::string& rootName,
+                                float weight = 1.0f);
+};
+
+//======================================================================
+// AnimationBlend
+//   - ローカル TRS 同士の合成（階層計算の前に行う）
+//======================================================================
+namespace AnimationBlend {
+
+/**
+ * @brief dst を src へ weight だけ近づける（上書きレイヤー / N 本ブレンド用）。
+ *
+ * - mask があればノードごとに weight * マスク値 を使う
+ */
+void Blend(AnimationPose& dst,
+           const AnimationPose& src,
+           float weight,
+           const BoneMask* mask = nullptr);
+
+/**
+ * @brief dst に「src と reference の差分」を weight 倍して足す（加算レイヤー）。
+ *
+ * - 位置は差、回転は reference⁻¹ * src、スケールは比を差分とする
+ */
+void Additive(AnimationPose& dst,
+              const AnimationPose& src,
+              const AnimationPose& reference,
+              float weight,
+              const BoneMask* mask = nullptr);
+
+} // namespace AnimationBlend
+} // namespace toy
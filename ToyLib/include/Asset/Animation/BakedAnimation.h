@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//======================================================================
+// BakedClip
+//   - 焼き込みテクスチャ内での 1 クリップ分の位置
+//   - フレーム f のボーン b は (b * 3 + 列, mFirstRow + f) に入っている
+//   - 最終フレームはクリップ末尾の姿勢（ループ時は先頭と同じ）なので、
+//     補間は常に [f, f + 1] の 2 フレームで済む
+//======================================================================
+struct BakedClip
+{
+    std::string mName;
+    int   mFirstRow  = 0;     // テクスチャの先頭行
+    int   mNumFrames = 0;     // 行数（2 以上）
+    float mDuration  = 0.0f;  // 秒
+
+    // 等倍再生での 1 秒あたりのフレーム行数
+    float GetFramesPerSecond() const
+    {
+        return (mDuration > 0.0f) ? (mNumFrames - 1) / mDuration : 0.0f;
+    }
+};
+
+//======================================================================
+// BakedAnimation
+//   - Mesh の全クリップを一定レートでサンプリングし、スキニング行列を
+//     RGBA32F テクスチャに並べたもの（群衆のインスタンス描画用）
+//   - 1 行 = 1 フレーム、1 ボーン = 3 テクセル（行列の 0〜2 列目。
+//     4 列目はアフィン変換なので (0,0,0,1) 固定）
+//   - 描画時は CPU で階層計算せず、頂点シェーダが
+//     (クリップ, フレーム) でフェッチして前後フレームを補間する
+//======================================================================
+class BakedAnimation
+{
+public:
+    BakedAnimation();
+    ~BakedAnimation();
+
+    // mesh の全クリップを sampleRate [fps] で焼き込んでテクスチャを作る
+    //  - GL コンテキストのあるスレッドで呼ぶこと
+    bool Bake(const class Mesh& mesh, float sampleRate = 30.0f);
+
+    // テクスチャを破棄
+    void Unload();
+
+    // 焼き込み済みテクスチャ
+    std::shared_ptr<class Texture> GetTexture() const { return mTexture; }
+
+    const BakedClip& GetClip(int index) const { return mClips[index]; }
+    int   GetNumClips() const { return static_cast<int>(mClips.size()); }
+    int   GetNumBones() const { return mNumBones; }
+    float GetSampleRate() const { return mSampleRate; }
+
+    // 名前からクリップ番号を探す（無ければ -1）
+    int FindClip(const std::string& name) const;
+
+private:
+    std::vector<BakedClip>         mClips;
+    std::shared_ptr<class Texture> mTexture;
+
+    int   mNumBones;
+    float mSampleRate;
+};
+
+} // namespace toy
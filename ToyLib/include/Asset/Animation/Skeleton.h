@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+#include "Asset/Animation/AnimationPose.h"
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//======================================================================
+// Skeleton
+//   - aiNode 階層をフラットな配列に焼いたもの（インデックス = ノード番号）
+//   - 親は必ず子より前に並ぶ（深さ優先の行きがけ順）ので、
+//     先頭から 1 回なめるだけでグローバル姿勢が求まる
+//   - mParents[0] == -1 がルート
+//======================================================================
+struct Skeleton
+{
+    // ノード名（読み込み時のチャネル / ボーンとの対応付けにだけ使う）
+    std::vector<std::string> mNames;
+
+    // 親ノード番号（-1 はルート）
+    std::vector<int>         mParents;
+
+    // バインド時のローカル変換（キーを持たないノードで使用）
+    std::vector<Matrix4>     mLocalBind;
+
+    // mLocalBind を TRS に分解したもの（ブレンド時、キーの無い側に使う）
+    std::vector<BoneTransform> mBindPose;
+
+    // ノード → ボーン番号（-1 はボーンではない）
+    std::vector<int>         mBoneIndices;
+
+    // 末端からの段数（葉 = 0、指先の 1 つ上 = 1 ...）
+    //  - 遠景で「末端から n 段」をバインド姿勢に落とす LOD に使う
+    std::vector<int>         mHeights;
+
+    size_t GetNumNodes() const { return mParents.size(); }
+};
+
+} // namespace toy
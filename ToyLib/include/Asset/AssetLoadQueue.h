@@ -0,0 +1,134 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace toy {
+
+//=====================================================================
+// 非同期読み込みの状態
+//=====================================================================
+enum class AssetLoadState
+{
+    Loading,   // デコード中 / アップロード待ち
+    Ready,     // 使える
+    Failed     // 読み込み失敗
+};
+
+//=====================================================================
+// AssetLoadJob
+//  - decode はワーカースレッドで、upload はメインスレッドで呼ばれる
+//  - upload には decode の成否が渡り、最終的な成否を返す
+//  - state はメインスレッドだけが書き換える
+//=====================================================================
+struct AssetLoadJob
+{
+    std::function<bool()>     decode;
+    std::function<bool(bool)> upload;
+    AssetLoadState            state = AssetLoadState::Loading;
+
+    // 以下は AssetLoadQueue のロック下で扱う
+    bool isDecoded = false;
+    bool decodeOk  = false;
+};
+
+//=====================================================================
+// AssetHandle
+//  - LoadTextureAsync / LoadMeshAsync の戻り値
+//  - Get() は読み込み中でも有効なオブジェクトを返す
+//    （テクスチャはプレースホルダとして描け、メッシュは空のまま）
+//  - IsReady() になった時点で中身がそろう
+//=====================================================================
+template <typename T>
+class AssetHandle
+{
+public:
+    AssetHandle() = default;
+    AssetHandle(std::shared_ptr<T> asset, std::shared_ptr<AssetLoadJob> job = nullptr)
+    : mAsset(std::move(asset))
+    , mJob(std::move(job))
+    {
+    }
+
+    const std::shared_ptr<T>& Get() const { return mAsset; }
+
+    AssetLoadState GetState() const
+    {
+        if (!mAsset) return AssetLoadState::Failed;
+        return mJob ? mJob->state : AssetLoadState::Ready;
+    }
+
+    bool IsReady()   const { return GetState() == AssetLoadState::Ready; }
+    bool IsLoading() const { return GetState() == AssetLoadState::Loading; }
+    bool IsFailed()  const { return GetState() == AssetLoadState::Failed; }
+
+private:
+    std::shared_ptr<T>            mAsset;
+    std::shared_ptr<AssetLoadJob> mJob;
+};
+
+//=====================================================================
+// AssetLoadQueue
+//  - ファイル読み込み・デコードを専用ワーカーで行い、
+//    GL への転送はメインスレッドで 1 フレームの時間予算内に少しずつ行う
+//  - JobSystem の ParallelFor は呼び出し側が完了を待つ作りなので、
+//    フレームをまたぐ読み込みには別にスレッドを持つ
+//=====================================================================
+class AssetLoadQueue
+{
+public:
+    // numWorkers = 0 のときは 2（ディスク待ちとデコードを重ねる程度）
+    explicit AssetLoadQueue(unsigned int numWorkers = 0);
+    ~AssetLoadQueue();
+
+    AssetLoadQueue(const AssetLoadQueue&) = delete;
+    AssetLoadQueue& operator=(const AssetLoadQueue&) = delete;
+
+    // ジョブを積む
+    void Submit(const std::shared_ptr<AssetLoadJob>& job);
+
+    //---------------------------------------------------------
+    // デコード済みのジョブを upload する（メインスレッド、毎フレーム）
+    //  - budgetMs を超えたら次のフレームへ回す（最低 1 件は進める）
+    //  - 戻り値は処理した件数
+    //---------------------------------------------------------
+    size_t ProcessUploads(float budgetMs);
+
+    //---------------------------------------------------------
+    // job をこの場で完了させる（メインスレッド）
+    //  - 同期読み込みが読み込み中のアセットを要求したとき用
+    //  - まだワーカーが取っていなければ呼び出し側でデコードする
+    //---------------------------------------------------------
+    void Finish(const std::shared_ptr<AssetLoadJob>& job);
+
+    // 未完了のジョブをすべて捨てる（デコード中のものは終わるまで待つ）
+    void Clear();
+
+    // 未完了（デコード待ち＋デコード中＋アップロード待ち）の件数
+    size_t GetNumPending() const;
+
+private:
+    void WorkerLoop();
+
+    // upload を呼んで状態を確定し、クロージャを解放する
+    static void Complete(AssetLoadJob& job);
+
+    std::vector<std::thread> mWorkers;
+
+    mutable std::mutex      mMutex;
+    std::condition_variable mWakeCond;      // ジョブ投入 / 終了の通知
+    std::condition_variable mDecodedCond;   // デコード完了の通知
+
+    std::deque<std::shared_ptr<AssetLoadJob>> mQueued;    // デコード待ち
+    std::deque<std::shared_ptr<AssetLoadJob>> mDecoded;   // アップロード待ち
+    size_t mNumDecoding;
+    bool   mQuit;
+};
+
+} // namespace toy
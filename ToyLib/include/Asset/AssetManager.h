@@ -1,7 +1,13 @@
 #pragma once
+#include "Asset/Animation/AnimationCompression.h"
+#include "Asset/Material/TextureCompression.h"
+#include "Asset/AssetLoadQueue.h"
+#include "Asset/File/AssetFileSystem.h"
+#include "Asset/File/FileWatcher.h"
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace toy {
 
@@ -9,7 +15,7 @@ namespace toy {
 // AssetManager
 //
 // ToyLib における **アセット一元管理クラス**
-//  - テクスチャ、メッシュ、サウンド、音楽、フォント をキャッシュ管理
+//  - テクスチャ、メッシュ、サウンド、音楽、フォント、エフェクト定義 をキャッシュ管理
 //  - 同じファイルを複数回読み込まない（メモリ効率）
 //  - Embedded Texture（FBX/GLTF の埋め込み画像）にも対応
 //
@@ -20,6 +26,7 @@ class AssetManager
 {
 public:
     AssetManager();
+    ~AssetManager();
 
     //=========================================================
     // メッシュ（FBX/GLTF/OBJなど）取得
@@ -29,11 +36,59 @@ public:
     std::shared_ptr<class Mesh> GetMesh(const std::string& fileName,
                                         bool isRightHanded = false);
 
+    //=========================================================
+    // 非同期読み込み
+    //  - ファイル読み込み・デコードはワーカーで行い、GL への転送は
+    //    ProcessAsyncLoads()（Application::UpdateFrame から毎フレーム）で
+    //    時間予算の範囲だけ進める
+    //  - 戻り値の Get() はすぐ使える。テクスチャは届くまで白の
+    //    プレースホルダで描かれ、メッシュは届くまで空（何も描かれない）
+    //  - 読み込み中のものを GetTexture / GetMesh で要求すると、
+    //    その場で完了させてから返す
+    //=========================================================
+    AssetHandle<class Texture> LoadTextureAsync(const std::string& fileName);
+    AssetHandle<class Mesh>    LoadMeshAsync(const std::string& fileName,
+                                             bool isRightHanded = false);
+
+    // デコード済みのアセットを GPU へ転送（メインスレッド）
+    void ProcessAsyncLoads();
+
+    // 1 フレームに転送へ使ってよい時間（ミリ秒）
+    void  SetUploadBudget(float ms) { mUploadBudgetMs = ms; }
+    float GetUploadBudget() const { return mUploadBudgetMs; }
+
+    // 未完了の非同期読み込み数（ロード画面の進捗表示など）
+    size_t GetNumPendingLoads() const;
+
+    //=========================================================
+    // 焼き込み済みアニメーション（群衆描画用）
+    //  - GetMesh() で読んだメッシュの全クリップを焼き込んでキャッシュ
+    //  - sampleRate は初回だけ有効
+    //=========================================================
+    std::shared_ptr<class BakedAnimation> GetBakedAnimation(const std::string& fileName,
+                                                            float sampleRate = 30.0f);
+
     //=========================================================
     // テクスチャ取得（PNG, JPG, DDS など）
     //=========================================================
     std::shared_ptr<class Texture> GetTexture(const std::string& fileName);
 
+    //=========================================================
+    // テクスチャアトラス（複数の画像を 1 枚に詰めたもの）
+    //  - atlasName でキャッシュ。各画像の領域はファイル名で FindRegion
+    //  - 2 回目以降の fileNames は無視される
+    //=========================================================
+    std::shared_ptr<class TextureAtlas> GetTextureAtlas(const std::string& atlasName,
+                                                        const std::vector<std::string>& fileNames,
+                                                        int maxPageSize = 2048);
+
+    //=========================================================
+    // 配列テクスチャ（同じサイズの画像を層に積んだもの）
+    //  - arrayName でキャッシュ。fileNames[i] が i 層目
+    //=========================================================
+    std::shared_ptr<class Texture> GetTextureArray(const std::string& arrayName,
+                                                   const std::vector<std::string>& fileNames);
+
     //=========================================================
     // Embedded Texture 取得（aiTexture や GLB 内の画像データ）
     // nameKey : 識別用キー（"_EMBED_0" など）
@@ -58,31 +113,126 @@ public:
     std::shared_ptr<class TextFont> GetFont(const std::string& fileName,
                                             int pointSize);
 
+    //=========================================================
+    // 距離場フォント（TextFont の SDF モード）
+    //  - ファイルごとに 1 つ、基準サイズ（"font" の sdf_reference_size）で
+    //    グリフを描き、表示サイズは TextSpriteComponent::SetFontSize で決める
+    //  - サイズ・DPI が変わってもフォントもアトラスも増えない
+    //  - SDF を使えない環境では通常のフォント（拡大・縮小はぼける）
+    //=========================================================
+    std::shared_ptr<class TextFont> GetSdfFont(const std::string& fileName);
+
+    int  GetSdfReferenceSize() const { return mSdfReferenceSize; }
+    void SetSdfReferenceSize(int size) { mSdfReferenceSize = size; }
+
+    //=========================================================
+    // パーティクルエフェクト定義（JSON）
+    //  - ホットリロードが有効なら通常ファイルを監視し、書き換わったら
+    //    同じオブジェクトへ読み直す（パック内のものは監視しない）
+    //=========================================================
+    std::shared_ptr<class ParticleEffect> GetParticleEffect(const std::string& fileName);
+
+    // 監視中のファイルの変更を調べる（Application::UpdateFrame から毎フレーム）
+    void PollFileChanges();
+
+    // ホットリロード（以降に読み込むものに適用）
+    void SetHotReload(bool enabled) { mHotReload = enabled; }
+    bool IsHotReload() const { return mHotReload; }
+
+    // アニメーション圧縮の設定（以降に読み込むメッシュに適用）
+    const AnimationCompressionSettings& GetAnimationCompression() const { return mAnimationCompression; }
+    void SetAnimationCompression(const AnimationCompressionSettings& s) { mAnimationCompression = s; }
+
+    // テクスチャのミップ・異方性・圧縮の設定（以降に読み込むテクスチャに適用）
+    //  - Set は GPU の対応を確かめないので、必要なら Texture::ApplyDeviceLimits を通す
+    const TextureSettings& GetTextureSettings() const { return mTextureSettings; }
+    void SetTextureSettings(const TextureSettings& s) { mTextureSettings = s; }
+
+    //=========================================================
+    // 設定ファイル（Renderer_Settings.json の "texture" / "hot_reload" / "font"）
+    //  - GL コンテキスト作成後に呼ぶ（GPU の対応に合わせて落とす）
+    //  - ファイルが読めなくても、既定値を GPU の対応に合わせる処理は行う
+    //=========================================================
+    bool LoadSettings(const std::string& filePath);
+
     // アセットフォルダの基準パス（GameApp 側で設定）
     std::string GetAssetsPath() const { return mAssetsPath; }
-    void SetAssetsPath(const std::string& path) { mAssetsPath = path; }
+    void SetAssetsPath(const std::string& path)
+    {
+        mAssetsPath = path;
+        mFileSystem.SetRoot(path);
+    }
+
+    //=========================================================
+    // アセットパック（.tpak）
+    //  - マウントすると以降の読み込みはまずパックから探す
+    //    （無いものはアセットフォルダの通常ファイルを読む）
+    //  - 読み込みを始める前に呼ぶこと
+    //  - パックは ToyTools の TPakBuilder で作る
+    //=========================================================
+    bool MountPack(const std::string& packPath) { return mFileSystem.Mount(packPath); }
+
+    // 各アセットの Load が使う読み込み口
+    const AssetFileSystem& GetFileSystem() const { return mFileSystem; }
 
     // DPI スケール（UI などで使用）
     void SetWindowDisplayScale(float scale) { mWindowDisplayScale = scale; }
+    float GetWindowDisplayScale() const { return mWindowDisplayScale; }
 
     // 登録済みアセットをすべて破棄（シーン切り替え等）
     void UnloadData();
 
 private:
+    // 設定ファイルの各セクションを読む（LoadSettings から）
+    bool ReadSettings(const std::string& filePath);
+
+    // フォントを開く（パック内ならメモリから）
+    std::shared_ptr<class TextFont> LoadFont(const std::string& fileName, int pixelSize);
+
     //===========================
     // キャッシュ管理マップ群
     //===========================
     std::unordered_map<std::string, std::shared_ptr<class Texture>>     mTextures;
+    std::unordered_map<std::string, std::shared_ptr<class TextureAtlas>> mTextureAtlases;
     std::unordered_map<std::string, std::shared_ptr<class Mesh>>        mMeshes;
+    std::unordered_map<std::string, std::shared_ptr<class BakedAnimation>> mBakedAnimations;
     std::unordered_map<std::string, std::shared_ptr<class SoundEffect>> mSoundEffects;
     std::unordered_map<std::string, std::shared_ptr<class Music>>       mMusics;
     std::unordered_map<std::string, std::shared_ptr<class TextFont>>    mTextFonts;
+    std::unordered_map<std::string, std::shared_ptr<class ParticleEffect>> mParticleEffects;
 
     // アセットの基準パス（GameApp 側で設定）
     std::string mAssetsPath;
 
+    // パック → 通常ファイルの順に探す読み込み口
+    AssetFileSystem mFileSystem;
+
     // DPI スケール（UI 調整用）
     float mWindowDisplayScale;
+
+    // 距離場フォントを描く基準サイズ
+    int mSdfReferenceSize;
+
+    // アニメーション圧縮の設定
+    AnimationCompressionSettings mAnimationCompression;
+
+    // テクスチャの設定
+    TextureSettings mTextureSettings;
+
+    // 読み込み中のアセット（キャッシュ側には既に登録済み）
+    std::unordered_map<std::string, std::shared_ptr<AssetLoadJob>> mPendingTextures;
+    std::unordered_map<std::string, std::shared_ptr<AssetLoadJob>> mPendingMeshes;
+
+    // 1 フレームの転送予算（ミリ秒）
+    float mUploadBudgetMs;
+
+    // ホットリロード
+    FileWatcher mFileWatcher;
+    bool        mHotReload;
+
+    // 非同期読み込みのワーカー（初回の LoadAsync で起動）
+    //  - デコード中のジョブが this を参照するので最後に宣言し、最初に破棄する
+    std::unique_ptr<AssetLoadQueue> mLoadQueue;
 };
 
 } // namespace toy
@@ -6,6 +6,8 @@
 
 #include <mpg123.h>
 
+#include "Asset/File/AssetFileSystem.h"
+
 namespace toy {
 
 //======================================================================
@@ -16,6 +18,7 @@ namespace toy {
 //
 //   ※ mp3 はファイル全体を decode して持たず、部分的に ReadChunk()
 //      する「ストリーミング方式」なので、大容量BGMでもメモリ効率が高い
+//   ※ パック内の mp3 はマップ領域をそのまま mpg123 に読ませる
 //======================================================================
 class Music
 {
@@ -59,6 +62,13 @@ private:
     int            mChannels = 0;   // モノラル or ステレオ
     int            mEncoding = 0;   // mpg123 の内部エンコード（PCM 形式）
 
+    // パック内の mp3（mpg123 へは下のコールバックで渡す）
+    AssetData      mSource;
+    size_t         mReadPos  = 0;
+
+    static mpg123_ssize_t ReadCallback(void* handle, void* buffer, size_t size);
+    static off_t          SeekCallback(void* handle, off_t offset, int whence);
+
     //----------------------------------------------------------------------
     // mpg123 のグローバル初期化は一度だけ必要。
     // ToyLib 全体で複数の Music オブジェクトが使われることを考え、
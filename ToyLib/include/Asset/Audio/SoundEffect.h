@@ -1,6 +1,7 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <vector>
 
 #include <AL/al.h>
 #include <AL/alc.h>
@@ -12,6 +13,7 @@ namespace toy {
 //   - 効果音(SE)用の単発再生アセット
 //   - AssetManager によって管理される
 //   - WAV(16bit PCM) をメモリに読み込み → OpenAL バッファ化する
+//     （ファイルは AssetFileSystem 経由で 1 回で取得。パック内ならコピーなし）
 //
 //   ※ MP3 のようなストリーミングは行わず、全データ常駐方式。
 //     SE は短いので高速 & 再生遅延ゼロ。
@@ -36,20 +38,29 @@ public:
     //----------------------------------------------------------------------
     ALuint GetBuffer() const { return mBuffer; }
 
+    //----------------------------------------------------------------------
+    // GetDuration()
+    //   - 長さ（秒）。仮想ボイス（音源を持たない再生）の経過管理に使う
+    //----------------------------------------------------------------------
+    float GetDuration() const { return mDuration; }
+
 private:
     ALuint      mBuffer    = 0;   // OpenAL バッファ
+    float       mDuration  = 0.0f;
     std::string mFilePath;        // デバッグ・再読み込み用
 
     //----------------------------------------------------------------------
     // LoadWav16()
-    //   - WAV 解析（ヘッダチェック・チャンク解析・16bit PCM 取得）
-    //   - 成功時：outData = PCM 生データ
+    //   - メモリ上の WAV を解析（ヘッダチェック・チャンク解析・16bit PCM 取得）
+    //   - 成功時：outData / outSize = file 内の PCM 生データ（コピーしない）
     //             outFormat = AL_FORMAT_MONO16 / AL_FORMAT_STEREO16
     //             outFreq   = サンプルレート
     //----------------------------------------------------------------------
     bool LoadWav16(
-        const std::string& fullPath,
-        std::vector<char>& outData,
+        const uint8_t* file,
+        size_t fileSize,
+        const char*& outData,
+        size_t& outSize,
         ALenum& outFormat,
         ALsizei& outFreq
     );
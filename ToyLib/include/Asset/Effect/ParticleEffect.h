@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// ParticleEffectDesc
+//  - パーティクルエフェクトの定義（JSON の中身そのもの）
+//  - 位置・速度・大きさはワールド単位（エミッタの Actor のスケールが掛かる）
+//==============================================================
+struct ParticleEffectDesc
+{
+    // 見た目
+    std::string texture;                 // 空ならコンポーネントの SetTexture を使う
+    bool        blendAdd = true;         // false なら通常ブレンド（奥から並べ替えて描く）
+
+    // 発生
+    uint32_t maxParticles = 256;         // 同時に生きていられる数
+    float    spawnRate    = 30.0f;       // 1 秒あたりの発生数
+    uint32_t burst        = 0;           // 開始時（とリロード時）にまとめて出す数
+    float    lifeMin      = 1.0f;        // 粒の寿命（秒、この範囲で乱数）
+    float    lifeMax      = 1.0f;
+    float    spawnRadius  = 0.0f;        // 発生位置のばらつき（球の半径）
+
+    // 初速：direction を軸に coneAngle（度）以内の向き × speed、
+    //       さらに各軸 ±velocityRandom を足す
+    Vector3 direction      = Vector3::UnitY;
+    float   coneAngle      = 180.0f;
+    float   speedMin       = 0.0f;
+    float   speedMax       = 0.0f;
+    Vector3 velocityRandom = Vector3::Zero;
+
+    // 挙動
+    Vector3 gravity = Vector3::Zero;     // 加速度
+    float   drag    = 0.0f;              // 速度の減衰（毎秒、exp(-drag * dt) 倍）
+
+    // 寿命に沿った変化（t = 0〜1 のキー、間は線形補間）
+    struct SizeKey  { float t; float size; };
+    struct ColorKey { float t; float r, g, b, a; };
+    std::vector<SizeKey>  sizeOverLife  { { 0.0f, 1.0f } };
+    std::vector<ColorKey> colorOverLife { { 0.0f, 1.0f, 1.0f, 1.0f, 1.0f } };
+};
+
+//==============================================================
+// ParticleModule
+//  - 更新ループで粒全体に順に掛ける処理（コンパイル済みの平らな並び）
+//  - 積分（位置・寿命を進める）は常に最後に行うので含めない
+//==============================================================
+enum class ParticleModuleType
+{
+    Acceleration,   // vel += (x, y, z) * dt
+    Drag            // vel *= exp(-x * dt)
+};
+
+struct ParticleModule
+{
+    ParticleModuleType type;
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+//==============================================================
+// ParticleEffect
+//  - JSON のエフェクト定義を読み、更新用のモジュール列と
+//    描画用のカーブ表（大きさ・色）にコンパイルしたもの
+//  - AssetManager::GetParticleEffect でキャッシュされ、
+//    ファイルが書き換わると同じオブジェクトのまま読み直される
+//    （GetVersion が進むので、使う側はそれを見て作り直す）
+//
+//  {
+//      "texture": "fire.png",
+//      "blend": "add",                   // "add" / "alpha"
+//      "max_particles": 64,
+//      "spawn_rate": 30,
+//      "burst": 0,
+//      "lifetime": [0.25, 0.35],         // 数値 1 つでも可
+//      "spawn_radius": 0.1,
+//      "velocity": {
+//          "direction": [0, 1, 0],
+//          "cone_angle": 30,
+//          "speed": [1.0, 2.0],
+//          "random": [0.2, 0.0, 0.2]
+//      },
+//      "gravity": [0, 2.4, 0],
+//      "drag": 0.5,
+//      "size_over_life":  [[0, 2.0], [1, 5.0]],
+//      "color_over_life": [[0, 1, 1, 1, 1], [1, 1, 0.4, 0.1, 0]]
+//  }
+//==============================================================
+class ParticleEffect
+{
+public:
+    ParticleEffect();
+    ~ParticleEffect();
+
+    // ファイルから読む（失敗したら今の定義のまま）
+    bool Load(const std::string& fileName, class AssetManager* assetManager);
+
+    // 定義を差し替えてコンパイルする（コードで作る場合）
+    void Compile(const ParticleEffectDesc& desc);
+
+    const ParticleEffectDesc& GetDesc() const { return mDesc; }
+    const std::vector<ParticleModule>& GetModules() const { return mModules; }
+
+    std::shared_ptr<class Texture> GetTexture() const { return mTexture; }
+    bool IsBlendAdd() const { return mDesc.blendAdd; }
+
+    // 寿命 t（0〜1）での大きさ・色
+    float SampleSize(float t) const;
+    void  SampleColor(float t, float& r, float& g, float& b, float& a) const;
+
+    // 定義が変わるたびに進む
+    uint32_t GetVersion() const { return mVersion; }
+
+    const std::string& GetFileName() const { return mFileName; }
+
+private:
+    // カーブ表の分割数
+    static constexpr int kCurveSamples = 32;
+
+    ParticleEffectDesc          mDesc;
+    std::vector<ParticleModule> mModules;
+    std::shared_ptr<class Texture> mTexture;
+
+    float mSizeCurve[kCurveSamples];
+    float mColorCurve[kCurveSamples][4];
+
+    uint32_t    mVersion;
+    std::string mFileName;
+};
+
+} // namespace toy
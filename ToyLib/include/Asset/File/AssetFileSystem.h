@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+class AssetPack;
+
+//==============================================================
+// AssetData
+//  - AssetFileSystem::Read() で得たファイル内容
+//  - パック内の無圧縮エントリはマップ領域を直接指し（コピーなし）、
+//    パックはこのオブジェクトが生きている間マップされたままになる
+//  - 圧縮エントリとパック外のファイルは自前のバッファに持つ
+//==============================================================
+class AssetData
+{
+public:
+    AssetData() = default;
+    AssetData(AssetData&&) = default;
+    AssetData& operator=(AssetData&&) = default;
+
+    AssetData(const AssetData&) = delete;
+    AssetData& operator=(const AssetData&) = delete;
+
+    const uint8_t* GetData() const { return mData; }
+    size_t         GetSize() const { return mSize; }
+    bool           IsEmpty() const { return mData == nullptr; }
+
+    // マップ領域を直接指しているか
+    bool IsZeroCopy() const { return mPack != nullptr && mOwned.empty(); }
+
+    void Reset() { *this = AssetData(); }
+
+private:
+    friend class AssetFileSystem;
+
+    const uint8_t*                   mData = nullptr;
+    size_t                           mSize = 0;
+    std::vector<uint8_t>             mOwned;
+    std::shared_ptr<const AssetPack> mPack;
+};
+
+//==============================================================
+// AssetFileSystem
+//  - アセットの読み込み口。マウントしたパックを新しい順に探し、
+//    無ければアセットフォルダ（SetRoot）の通常ファイルを読む
+//  - パスは AssetManager に渡すものと同じ（アセットフォルダからの相対）
+//  - Read / IsPacked はワーカースレッドから同時に呼んでよい。
+//    Mount / Unmount は読み込みを始める前にメインスレッドで行うこと
+//==============================================================
+class AssetFileSystem
+{
+public:
+    AssetFileSystem();
+    ~AssetFileSystem();
+
+    // パック外のファイルを探すフォルダ（AssetManager::SetAssetsPath から）
+    void SetRoot(const std::string& root) { mRoot = root; }
+    const std::string& GetRoot() const { return mRoot; }
+
+    // パックを開いて追加（後から足したものが優先）
+    bool Mount(const std::string& packPath);
+    void UnmountAll();
+
+    // パック内にあるか（無ければ通常ファイルとして扱われる）
+    bool IsPacked(const std::string& path) const;
+
+    // パック内または通常ファイルとして存在するか
+    bool Exists(const std::string& path) const;
+
+    // 内容を得る（パック → 通常ファイルの順）
+    bool Read(const std::string& path, AssetData& out) const;
+
+    // パック外のときのフルパス
+    std::string GetFullPath(const std::string& path) const { return mRoot + path; }
+
+private:
+    std::string mRoot;
+    std::vector<std::shared_ptr<const AssetPack>> mPacks;
+};
+
+} // namespace toy
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Asset/File/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// パック内の 1 ファイル分（目次の 1 行、40 byte）
+//==============================================================
+struct PackEntry
+{
+    enum Compression : uint32_t
+    {
+        Stored = 0,   // 無圧縮（マップ領域をそのまま使える）
+        LZ4    = 1,   // LZ4 ブロック
+    };
+
+    uint64_t hash;          // 正規化したパスの FNV-1a
+    uint64_t offset;        // データ位置（kDataAlign 境界）
+    uint64_t storedSize;    // パック内のバイト数
+    uint64_t rawSize;       // 展開後のバイト数
+    uint32_t nameOffset;    // 名前表内の位置（ハッシュ衝突の確認用）
+    uint32_t compression;
+};
+static_assert(sizeof(PackEntry) == 40, "PackEntry must be 40 bytes");
+
+//==============================================================
+// AssetPack
+//  - アセットフォルダを 1 ファイルにまとめた読み取り専用アーカイブ
+//  - 開くときはファイルを 1 回 mmap するだけで、目次はハッシュ順に
+//    並んでいるので二分探索で引く（個別の open / read は発生しない）
+//  - 無圧縮のエントリはマップ領域を直接指すのでコピーしない
+//  - 配置：ヘッダ 64 byte → 目次 → 名前表 → データ（各 kDataAlign 境界）
+//==============================================================
+class AssetPack
+{
+public:
+    // 形式を変えたら上げる
+    static constexpr uint32_t    kVersion   = 1;
+    static constexpr size_t      kDataAlign = 64;
+    static constexpr const char* kExtension = ".tpak";
+
+    AssetPack();
+    ~AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // mmap して目次を検証する
+    bool Open(const std::string& packPath);
+    void Close();
+
+    // パスからエントリを引く（無ければ nullptr）
+    const PackEntry* Find(const std::string& path) const;
+
+    // 無圧縮エントリのデータ（圧縮エントリは nullptr）
+    const uint8_t* GetStoredData(const PackEntry& entry) const;
+
+    // 展開して out に書く（無圧縮ならコピー）
+    bool Extract(const PackEntry& entry, std::vector<uint8_t>& out) const;
+
+    // これから読むエントリの先読みを促す
+    void Prefetch(const PackEntry& entry) const;
+
+    size_t GetNumEntries() const { return mNumEntries; }
+    const std::string& GetPath() const { return mPath; }
+
+    /**
+     * @brief rootDir 以下の全ファイルからパックを作る。
+     *
+     * - パスは rootDir からの相対（'/' 区切り）で登録する
+     * - compress = true なら LZ4 で縮むものだけ圧縮する
+     *   （画像・音声など既に圧縮済みの形式と .tmesh は無圧縮のまま）
+     */
+    static bool Build(const std::string& rootDir,
+                      const std::string& packPath,
+                      bool compress = true);
+
+    // パスの正規化（'\' → '/'、"./" と先頭の '/' を除き、".." を畳む）
+    static std::string NormalizePath(const std::string& path);
+
+    // 正規化済みパスのハッシュ
+    static uint64_t HashPath(const std::string& normalized);
+
+private:
+    MappedFile       mFile;
+    std::string      mPath;
+    const PackEntry* mEntries;
+    size_t           mNumEntries;
+    const char*      mNames;
+    size_t           mNamesSize;
+};
+
+} // namespace toy
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// FileWatcher
+//  - 登録したファイルの更新時刻を一定間隔で調べ、変わったものの
+//    コールバックを呼ぶ（エフェクト定義などのホットリロード用）
+//  - 調べるのは Poll() を呼んだスレッド（メインスレッド想定）で、
+//    間隔の間は時刻を見るだけなのでフレームごとに呼んでよい
+//  - コールバックが false を返したら（書きかけでパース失敗など）
+//    時刻を更新せず、次の Poll でもう一度呼ぶ
+//==============================================================
+class FileWatcher
+{
+public:
+    using Callback = std::function<bool()>;
+
+    FileWatcher();
+
+    // フルパスを登録（同じパスは上書き）
+    void Watch(const std::string& fullPath, Callback callback);
+    void Clear();
+
+    // 間隔が来ていれば変更を調べる
+    void Poll();
+
+    // 調べる間隔（秒）
+    void  SetInterval(float seconds) { mInterval = seconds; }
+    float GetInterval() const { return mInterval; }
+
+    size_t GetNumWatched() const { return mEntries.size(); }
+
+private:
+    struct Entry
+    {
+        std::string                     path;
+        std::filesystem::file_time_type time;
+        Callback                        callback;
+    };
+    std::vector<Entry> mEntries;
+
+    float mInterval;
+    std::chrono::steady_clock::time_point mLastPoll;
+};
+
+} // namespace toy
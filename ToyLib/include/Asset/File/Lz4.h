@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// Lz4
+//  - LZ4 ブロック形式の圧縮 / 展開（フレーム形式のヘッダは持たない）
+//  - アセットパックのエントリ圧縮用。展開後のサイズはパック側の
+//    目次に持つので、ここでは呼び出し側が知っている前提
+//  - 圧縮は 1 パスの貪欲法（速度優先、圧縮率は参照実装の fast 相当）
+//==============================================================
+namespace Lz4 {
+
+/**
+ * @brief src を LZ4 ブロック形式で圧縮して out に書く（out は上書き）。
+ */
+void Compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out);
+
+/**
+ * @brief 展開する。dstSize ぴったりに展開できなければ false。
+ *
+ * - 壊れたデータでも dst の範囲外には書かない
+ */
+bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+} // namespace Lz4
+} // namespace toy
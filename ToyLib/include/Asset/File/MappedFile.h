@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace toy {
+
+//==============================================================
+// MappedFile
+//  - ファイル全体を読み取り専用で mmap する（Windows は MapViewOfFile）
+//  - MeshCache / AssetPack が共用する
+//==============================================================
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 開いてマップする（空ファイルは失敗扱い）
+    bool Open(const std::string& path);
+
+    // マップ解除
+    void Close();
+
+    bool           IsOpen()  const { return mData != nullptr; }
+    const uint8_t* GetData() const { return mData; }
+    size_t         GetSize() const { return mSize; }
+
+    // これから読む範囲の先読みを OS に促す（効かない環境では何もしない）
+    void Prefetch(size_t offset, size_t size) const;
+
+private:
+    const uint8_t* mData;
+    size_t         mSize;
+#ifdef _WIN32
+    void* mFile;
+    void* mMapping;
+#else
+    int   mFd;
+#endif
+};
+
+} // namespace toy
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// Glyph
+//  - アトラス内の 1 文字
+//  - x, y, width, height はアトラス上の画素の矩形（空白は 0）
+//  - offsetX / offsetY はペン位置（行の上端）から画素の左上までのずれ
+//    （y は下向き）
+//==============================================================
+struct Glyph
+{
+    int x       = 0;
+    int y       = 0;
+    int width   = 0;
+    int height  = 0;
+    int offsetX = 0;
+    int offsetY = 0;
+    int advance = 0;
+};
+
+//==============================================================
+// GlyphAtlas
+//  - TextFont（ファイル＋サイズ）ごとに 1 枚持つグリフのキャッシュ
+//  - 初めて使う文字だけ SDL_ttf で白のグリフを描き、棚詰め（shelf）で
+//    追記する。GPU へは変わった行だけ送る
+//  - 色は頂点色で付けるので、同じフォントの文字はすべて 1 枚を共有する
+//  - 埋まったら高さを倍にし、上限でも足りなければ空にして詰め直す。
+//    どちらも GetVersion が進むので、UV を持っている側は作り直す
+//==============================================================
+class GlyphAtlas
+{
+public:
+    explicit GlyphAtlas(class TextFont* font);
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    // 文字を引く（無ければ描いて追記。描けない文字は空のグリフ）
+    const Glyph& GetGlyph(uint32_t codepoint);
+
+    // 2 文字の間のカーニング（ピクセル）
+    int GetKerning(uint32_t prev, uint32_t codepoint) const;
+
+    // 行の高さ（ピクセル）
+    int GetLineHeight() const { return mLineHeight; }
+
+    // 追記分を GPU へ送ってテクスチャを返す（メインスレッド）
+    std::shared_ptr<class Texture> GetTexture();
+
+    // 既存の UV が無効になる（拡張・詰め直し）たびに進む
+    uint32_t GetVersion() const { return mVersion; }
+
+    // 詰め直し（既存の文字が消える）たびに進む
+    uint32_t GetGeneration() const { return mGeneration; }
+
+    int    GetWidth()     const { return mWidth; }
+    int    GetHeight()    const { return mHeight; }
+    size_t GetNumGlyphs() const { return mGlyphs.size(); }
+
+private:
+    // 棚詰めで領域を取る（入らなければ拡張・詰め直しを試す）
+    bool Allocate(int width, int height, int& outX, int& outY);
+
+    // 空にして詰め直す（上限まで埋まったとき）
+    void Reset();
+
+    // 文字を描いてアトラスへ書く
+    void Rasterize(uint32_t codepoint, Glyph& glyph);
+
+    class TextFont* mFont;
+
+    std::unordered_map<uint32_t, Glyph> mGlyphs;
+
+    // CPU 側の画素（RGBA8、白＋アルファ）
+    std::vector<uint8_t> mPixels;
+    int mWidth;
+    int mHeight;
+    int mMaxHeight;
+
+    // 棚
+    int mShelfX;
+    int mShelfY;
+    int mShelfHeight;
+
+    // GPU へ送っていない行の範囲（[mDirtyBegin, mDirtyEnd)）
+    int  mDirtyBegin;
+    int  mDirtyEnd;
+    bool mRecreate;      // サイズが変わったので作り直す
+
+    int      mLineHeight;
+    uint32_t mVersion;
+    uint32_t mGeneration;
+
+    std::shared_ptr<class Texture> mTexture;
+};
+
+} // namespace toy
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Asset/File/AssetFileSystem.h"
+
+#include <memory>
 #include <string>
 #include <SDL3_ttf/SDL_ttf.h>
 
@@ -24,6 +27,14 @@ public:
     //------------------------------------------------------------------
     bool Load(const std::string& filePath, int pointSize);
 
+    //------------------------------------------------------------------
+    // Load（メモリから）
+    //   - アセットパック内のフォント用。SDL_ttf はグリフを描くたびに
+    //     元データを読むので、data は Unload() まで保持する
+    //   - filePath は表示・識別用
+    //------------------------------------------------------------------
+    bool Load(AssetData data, const std::string& filePath, int pointSize);
+
     //------------------------------------------------------------------
     // Unload
     //   - TTF_CloseFont(mFont)
@@ -37,12 +48,31 @@ public:
     //------------------------------------------------------------------
     bool IsValid() const { return mFont != nullptr; }
 
+    //------------------------------------------------------------------
+    // 距離場（SDF）モード
+    //   - TTF_SetFontSDF で、グリフのアルファに符号付き距離
+    //     （0.5 が輪郭）を描かせる。1 つのサイズで描いたアトラスを
+    //     距離場シェーダでどの大きさにも拡大・縮小できる
+    //   - FreeType が SDF に対応していなければ false（通常のまま）
+    //   - 切り替えるとグリフキャッシュは作り直す
+    //------------------------------------------------------------------
+    bool SetSdf(bool enable);
+    bool IsSdf() const { return mIsSdf; }
+
     //------------------------------------------------------------------
     // SDL_ttf の生フォントポインタ
     //   - Renderer::CreateTextTexture() などが利用
     //------------------------------------------------------------------
     TTF_Font* GetNativeFont() const { return mFont; }
 
+    //------------------------------------------------------------------
+    // GetGlyphAtlas
+    //   - このフォント（サイズ）のグリフキャッシュ。初回に作る
+    //   - TextSpriteComponent はこれから頂点を組むだけで、
+    //     文字列ごとのテクスチャは作らない
+    //------------------------------------------------------------------
+    class GlyphAtlas* GetGlyphAtlas();
+
     //------------------------------------------------------------------
     // 情報取得
     //------------------------------------------------------------------
@@ -57,6 +87,13 @@ private:
     TTF_Font*    mFont       = nullptr;
     std::string  mFilePath   = "";
     int          mPointSize  = 0;
+    bool         mIsSdf      = false;
+
+    // メモリから開いたときの元データ
+    AssetData    mSource;
+
+    // グリフキャッシュ（フォントを開き直したら捨てる）
+    std::unique_ptr<class GlyphAtlas> mGlyphAtlas;
 };
 
 } // namespace toy
@@ -42,16 +42,15 @@ struct VertexBoneData
 // BoneInfo
 //   - 各ボーンごとの変換情報
 //   - BoneOffset: モデル空間 → ボーンローカルへのオフセット行列
-//   - FinalTransformation: アニメーション適用後の最終行列（スキニング用）
+//   - アニメーション後の最終行列は Mesh には持たせず、
+//     再生側（AnimationPlayer）のバッファに書き出す
 //==============================================================
 struct BoneInfo
 {
     Matrix4 BoneOffset;          // オフセット行列（BindPoseで埋める）
-    Matrix4 FinalTransformation; // アニメ後の最終行列（GPUに送る）
 
     BoneInfo()
         : BoneOffset(Matrix4::Identity)
-        , FinalTransformation(Matrix4::Identity)
     {
     }
 };
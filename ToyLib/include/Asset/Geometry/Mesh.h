@@ -2,14 +2,17 @@
 
 #include "Utils/MathUtil.h"
 #include "Asset/Animation/AnimationClip.h"
+#include "Asset/Animation/Skeleton.h"
+#include "Asset/Animation/AnimationPose.h"
 
 #include <vector>
 #include <string>
 #include <map>
 #include <memory>
 
-#include <assimp/scene.h>
-#include <assimp/Importer.hpp>
+struct aiScene;
+struct aiMesh;
+struct aiNode;
 
 namespace toy {
 
@@ -22,12 +25,26 @@ public:
     Mesh();
     ~Mesh();
 
-    // メッシュファイルを読み込む
+    // 非同期読み込みで、ワーカーが組み立てた Mesh を中身ごと移す
+    Mesh& operator=(Mesh&&);
+
+    // メッシュファイルを読み込む（Decode() → Upload() を続けて行う）
     // isRightHanded = true のとき右手系 → 左手系などの変換を行う想定
     virtual bool Load(const std::string& fileName,
                       class AssetManager* assetMamager,
                       bool isRightHanded = false);
 
+    // 読み込み前半：ファイル読み込みと変換（GL を使わないのでワーカーから呼べる）
+    // <ファイル名>.tmesh キャッシュが有効ならそちらから読み、
+    // 無ければ Assimp で読み込んでキャッシュを書き出す
+    bool Decode(const std::string& fileName,
+                class AssetManager* assetMamager,
+                bool isRightHanded = false);
+
+    // 読み込み後半：VAO / マテリアルの作成（メインスレッド）
+    //  asyncTextures : 外部テクスチャを LoadTextureAsync で頼む
+    void Upload(class AssetManager* assetMamager, bool asyncTextures);
+
     // メッシュとリソースの解放
     void Unload();
 
@@ -47,13 +64,36 @@ public:
     // スペキュラー強度
     float GetSpecPower() const { return mSpecPower; }
 
-    // Assimp のシーンアクセス（必要があれば）
-    const aiScene* GetScene() const { return mScene; }
+    // ノード階層（ボーン以外のノードも含む）
+    const Skeleton& GetSkeleton() const { return mSkeleton; }
 
     // 指定時刻のボーン姿勢（スキンメッシュ用）を計算
+    // Mesh の状態は一切書き換えず、結果と作業領域はすべて呼び出し側が持つ
+    // （同じ Mesh を共有する複数キャラを別スレッドで同時に計算してよい）
+    //  outTransforms : ボーン数ぶんの最終行列
+    //  globalPose    : ノードごとのグローバル行列（作業領域、使い回し推奨）
+    //  cursor        : 前回のキー位置（再生側で保持する）
+    //  skipLeafLevels: 末端から何段をキー補間せずバインド姿勢にするか（遠景 LOD）
     void ComputePoseAtTime(float animationTime,
-                           const aiAnimation* pAnimation,
-                           std::vector<Matrix4>& outTransforms);
+                           const AnimationClip& clip,
+                           std::vector<Matrix4>& outTransforms,
+                           std::vector<Matrix4>& globalPose,
+                           AnimationCursor* cursor = nullptr,
+                           int skipLeafLevels = 0) const;
+
+    // 指定時刻のローカル姿勢（ノードごとの TRS）だけを求める
+    //  - ブレンドやレイヤー合成はこの段階で行い、最後に
+    //    ComputeSkinningMatrices() で 1 回だけ階層計算する
+    void SampleLocalPose(float animationTime,
+                         const AnimationClip& clip,
+                         AnimationPose& outPose,
+                         AnimationCursor* cursor = nullptr,
+                         int skipLeafLevels = 0) const;
+
+    // ローカル姿勢から階層計算してスキニング行列を求める
+    void ComputeSkinningMatrices(const AnimationPose& pose,
+                                 std::vector<Matrix4>& outTransforms,
+                                 std::vector<Matrix4>& globalPose) const;
 
     // 読み込まれているアニメーションクリップ一覧
     const std::vector<class AnimationClip>& GetAnimationClips() const
@@ -64,73 +104,115 @@ public:
     // アニメーションが1つ以上存在するか
     bool HasAnimation() const { return !mAnimationClips.empty(); }
 
+    // 骨格とクリップを直接与える（手続き生成・ツール・ベンチマーク用）
+    //  - skeleton は mNames / mParents / mLocalBind を埋めたもの（親が先）
+    //  - boneNames の順にボーン番号を振る（オフセットは単位行列）
+    //  - 残りの対応表は読み込み時と同じく BindSkeleton で作る
+    void SetAnimationData(const Skeleton& skeleton,
+                          const std::vector<std::string>& boneNames,
+                          std::vector<AnimationClip> clips);
+
+    // ローカル空間のバウンディングスフィア（LOD 選択用）
+    const Vector3& GetBoundingCenter() const { return mBoundingCenter; }
+    float GetBoundingRadius() const { return mBoundingRadius; }
+
+    // サブメッシュ中で最大の LOD 段数
+    int GetNumLods() const { return mNumLods; }
+
 private:
+    // Assimp で読み込み、キャッシュ用データも組み立てる
+    //  - fs を渡すと fullName をアセット相対パスとして fs 経由で読む（パック内）
+    bool LoadFromFile(const std::string& fullName,
+                      bool isRightHanded,
+                      struct MeshCacheData& cacheData,
+                      const class AssetFileSystem* fs = nullptr);
+
+    // キャッシュの内容から復元（VAO / マテリアル以外）
+    void LoadFromCache(const struct MeshCacheData& cacheData);
+
     // メッシュデータ読み込み（頂点/インデックス、ボーン有無の判定）
-    void LoadMeshData();
+    void LoadMeshData(const aiScene* scene, struct MeshCacheData& cacheData);
+
+    // マテリアル記述の読み込み
+    void LoadMaterials(const aiScene* scene, struct MeshCacheData& cacheData);
+
+    // ノード階層を行きがけ順のフラット配列へ焼く
+    void LoadSkeleton(const aiNode* pNode, int parent);
 
-    // マテリアル読み込み
-    void LoadMaterials(class AssetManager* assetMamager);
+    // アニメーションクリップ読み込み（キー列を SoA にコピー）
+    void LoadAnimations(const aiScene* scene);
 
-    // アニメーションクリップ読み込み
-    void LoadAnimations();
+    // ノード ↔ ボーン / チャネルの対応表を作る（読み込み時に 1 回）
+    void BindSkeleton();
+
+    // 全クリップをキー削減＋量子化（読み込み後、キャッシュ書き出しの後）
+    void CompressAnimations(const struct AnimationCompressionSettings& settings);
 
     // 通常メッシュ生成（ボーンなし）
-    void CreateMesh(const aiMesh* m);
+    void CreateMesh(const aiMesh* m, struct MeshCacheData& cacheData);
 
     // スキンメッシュ生成（ボーンあり）
-    void CreateMeshBone(const aiMesh* m);
+    void CreateMeshBone(const aiMesh* m, struct MeshCacheData& cacheData);
+
+    // 簡略化 LOD を生成（lods[0] は元のインデックス）＋バウンディング更新
+    std::vector<std::vector<unsigned int>> BuildLods(const std::vector<float>& verts,
+                                                     const std::vector<unsigned int>& indices);
+
+    // パック済みサブメッシュから VAO を作成（verts は物理判定用の xyz）
+    void CreateVertexArray(const struct CachedSubMesh& sub, const float* verts);
+
+    // マテリアル記述から Material を作成
+    void CreateMaterial(const struct CachedMaterial& desc,
+                        class AssetManager* assetMamager,
+                        bool asyncTextures);
 
     // 単一 aiMesh のボーン情報を収集
     void LoadBones(const aiMesh* m, std::vector<struct VertexBoneData>& bones);
 
-    // ボーン階層を再帰的に巡回してボーン行列を計算
-    void ComputeBoneHierarchy(float animationTime,
-                              const aiNode* pNode,
-                              const Matrix4& parentTransform,
-                              const aiAnimation* pAnimation);
-
-    // ノード名に一致するアニメーションチャネルを探す
-    const aiNodeAnim* FindNodeAnim(const aiAnimation* pAnimation,
-                                   const std::string& nodeName);
+    // 1 チャネル分の TRS をキー補間で求める（keys は cursor->mKeys の該当位置）
+    static void SampleChannel(BoneTransform& out,
+                              float animationTime,
+                              const NodeAnimation& nodeAnim,
+                              unsigned int* keys);
 
     // 補間計算（スケール / 回転 / 平行移動）
-    void CalcInterpolatedScaling(Vector3& outVec,
-                                 float animationTime,
-                                 const aiNodeAnim* pNodeAnim);
-
-    void CalcInterpolatedRotation(Quaternion& outQuat,
-                                  float animationTime,
-                                  const aiNodeAnim* pNodeAnim);
-
-    void CalcInterpolatedPosition(Vector3& outVec,
-                                  float animationTime,
-                                  const aiNodeAnim* pNodeAnim);
-
-    // 補間に使うキーインデックスを探す
-    unsigned int FindScaling(float animationTime,
-                             const aiNodeAnim* pNodeAnim);
-    unsigned int FindRotation(float animationTime,
-                              const aiNodeAnim* pNodeAnim);
-    unsigned int FindPosition(float animationTime,
-                              const aiNodeAnim* pNodeAnim);
+    //  cursor : キー位置のキャッシュ（nullptr なら毎回二分探索）
+    static void CalcInterpolatedScaling(Vector3& outVec,
+                                        float animationTime,
+                                        const NodeAnimation& nodeAnim,
+                                        unsigned int* cursor);
+
+    static void CalcInterpolatedRotation(Quaternion& outQuat,
+                                         float animationTime,
+                                         const NodeAnimation& nodeAnim,
+                                         unsigned int* cursor);
+
+    static void CalcInterpolatedPosition(Vector3& outVec,
+                                         float animationTime,
+                                         const NodeAnimation& nodeAnim,
+                                         unsigned int* cursor);
+
+    // 補間に使うキーインデックスを探す（times は 2 要素以上）
+    static unsigned int FindKey(float animationTime,
+                                const std::vector<float>& times,
+                                unsigned int* cursor);
 
 private:
-    // Assimp シーンデータ
-    Assimp::Importer mImporter;
-    const aiScene*   mScene;
-
     // ボーン名 → ボーンインデックス
     std::map<std::string, unsigned int> mBoneMapping;
 
     // ボーン数
     unsigned int mNumBones;
 
-    // ボーンごとのオフセット行列・最終変換行列
+    // ボーンごとのオフセット行列
     std::vector<struct BoneInfo> mBoneInfo;
 
     // ルートノードの逆変換行列
     Matrix4 mGlobalInverseTransform;
 
+    // ノード階層（親が先に並ぶフラット配列）
+    Skeleton mSkeleton;
+
     // 頂点配列（1ファイルに複数メッシュがある場合も考慮）
     std::vector<std::shared_ptr<class VertexArray>> mVertexArray;
 
@@ -145,6 +227,18 @@ private:
 
     // スペキュラー係数
     float mSpecPower;
+
+    // バウンディングスフィア（全サブメッシュ）
+    Vector3 mBoundingMin;
+    Vector3 mBoundingMax;
+    Vector3 mBoundingCenter;
+    float   mBoundingRadius;
+
+    // LOD 段数（LOD0 を含む）
+    int mNumLods;
+
+    // Decode() から Upload() まで持ち越すデータ（それ以外は nullptr）
+    std::unique_ptr<struct MeshLoadData> mPending;
 };
 
 } // namespace toy
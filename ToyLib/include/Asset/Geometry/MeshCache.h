@@ -0,0 +1,168 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+#include "Asset/Geometry/VertexFormat.h"
+#include "Asset/Animation/AnimationClip.h"
+#include "Asset/Animation/Skeleton.h"
+#include "Asset/File/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// サブメッシュ 1 つ分
+//  - vertices / indices はキャッシュ読み込み時は mmap 領域を、
+//    Assimp からの変換時は MeshCacheData::Retain した領域を指す
+//  - indices は全 LOD を連結したもの（lodCounts[0] が元メッシュ）
+//==============================================================
+struct CachedSubMesh
+{
+    bool                      skinned       = false;
+    unsigned int              materialIndex = 0;
+    unsigned int              numVerts      = 0;
+    VertexQuantization        quant;
+    const void*               vertices      = nullptr;  // PackedVertex / PackedSkinnedVertex
+    const unsigned int*       indices       = nullptr;
+    std::vector<unsigned int> lodCounts;
+};
+
+//==============================================================
+// マテリアル 1 つ分
+//  - flags で「ファイルに値があったか」を持ち、無い項目は
+//    Material の初期値のままにする（Assimp 読み込み時と同じ挙動）
+//==============================================================
+struct CachedMaterial
+{
+    enum Flags : uint32_t
+    {
+        HasAmbient   = 1 << 0,
+        HasDiffuse   = 1 << 1,
+        HasSpecular  = 1 << 2,
+        HasShininess = 1 << 3,
+        HasTexture   = 1 << 4,   // 外部ファイル（texturePath）
+        HasEmbedded  = 1 << 5,   // 埋め込み画像（embeddedKey + データ）
+    };
+
+    uint32_t       flags     = 0;
+    Vector3        ambient   = Vector3::Zero;
+    Vector3        diffuse   = Vector3::Zero;
+    Vector3        specular  = Vector3::Zero;
+    float          specPower = 32.0f;
+    std::string    texturePath;
+    std::string    embeddedKey;
+    const uint8_t* embeddedData = nullptr;
+    size_t         embeddedSize = 0;
+};
+
+//==============================================================
+// ボーン 1 本分（名前とオフセット行列）
+//==============================================================
+struct CachedBone
+{
+    std::string name;
+    Matrix4     offset;
+};
+
+//==============================================================
+// Mesh を復元するのに必要なデータ一式
+//==============================================================
+struct MeshCacheData
+{
+    std::vector<CachedSubMesh>  subMeshes;
+    std::vector<CachedMaterial> materials;
+    std::vector<CachedBone>     bones;
+    Skeleton                    skeleton;
+    std::vector<AnimationClip>  clips;
+
+    Matrix4 globalInverse = Matrix4::Identity;
+    Vector3 boundsMin     = Vector3::Zero;
+    Vector3 boundsMax     = Vector3::Zero;
+    int     numLods       = 1;
+
+    // 変換時のバッファを書き出しまで保持し、その先頭を返す
+    // （std::list なので追加しても既存の領域は動かない）
+    const void* Retain(const void* data, size_t size);
+
+private:
+    std::list<std::vector<uint8_t>> mStorage;
+};
+
+//==============================================================
+// MeshCache
+//  - Assimp で読んだ結果をバイナリに焼いておき、次回以降は
+//    ファイルを 1 回 mmap して頂点/インデックスをそのまま GL へ転送する
+//  - ヘッダに元ファイルの内容ハッシュを持ち、不一致なら使わない
+//  - ファイル配置：<元ファイル>.tmesh（書き込めなければ作らないだけ）
+//==============================================================
+class MeshCache
+{
+public:
+    // 形式を変えたら上げる（古いキャッシュは自動で作り直される）
+    static constexpr uint32_t kVersion = 2;
+    static constexpr const char* kExtension = ".tmesh";
+
+    MeshCache();
+    ~MeshCache();
+
+    MeshCache(const MeshCache&) = delete;
+    MeshCache& operator=(const MeshCache&) = delete;
+
+    /**
+     * @brief 元ファイルの内容ハッシュ（FNV-1a 64bit）。
+     *
+     * - 読み込みオプション（右手系フラグ）と形式バージョンも混ぜる
+     * - glTF の外部 .bin など、参照先ファイルの変更は検出しない
+     */
+    static bool HashSourceFile(const std::string& path,
+                               bool isRightHanded,
+                               uint64_t& outHash);
+
+    /**
+     * @brief メモリ上の元データの内容ハッシュ（HashSourceFile と同じ値）。
+     */
+    static uint64_t HashSourceData(const void* data, size_t size, bool isRightHanded);
+
+    /**
+     * @brief キャッシュを mmap して解析する。
+     *
+     * - ハッシュ / バージョン不一致、破損時は false
+     * - 成功時の GetData() の頂点・インデックスはマップ領域を指すので、
+     *   GL へ転送し終えるまで MeshCache を破棄しないこと
+     */
+    bool Open(const std::string& cachePath, uint64_t sourceHash);
+
+    /**
+     * @brief メモリ上のキャッシュを解析する（アセットパック用）。
+     *
+     * - data はコピーしないので、GL へ転送し終えるまで生かしておくこと
+     */
+    bool OpenMemory(const void* data, size_t size, uint64_t sourceHash);
+
+    // マップ解除（OpenMemory の場合は参照を外すだけ）
+    void Close();
+
+    const MeshCacheData& GetData() const { return mData; }
+
+    /**
+     * @brief キャッシュを書き出す（一時ファイルに書いてから置き換え）。
+     */
+    static bool Write(const std::string& cachePath,
+                      uint64_t sourceHash,
+                      const MeshCacheData& data);
+
+private:
+    bool Parse(uint64_t sourceHash);
+
+    MappedFile     mFile;      // Open() のときだけ使う
+    const uint8_t* mMapped;    // 解析対象（mFile か外部のメモリ）
+    size_t         mSize;
+
+    MeshCacheData mData;
+};
+
+} // namespace toy
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace toy {
+namespace MeshOptimizer {
+
+/**
+ * @brief 頂点キャッシュ効率（ACMR）を計算する。
+ *
+ * - ACMR = キャッシュミス数 / 三角形数（理想は 0.5 付近、最悪 3.0）
+ * - FIFO キャッシュを cacheSize エントリでシミュレートする
+ */
+float ComputeACMR(const std::vector<unsigned int>& indices,
+                  unsigned int numVerts,
+                  unsigned int cacheSize = 16);
+
+/**
+ * @brief Tipsify による頂点キャッシュ向け三角形並べ替え。
+ *
+ * - 隣接三角形を「扇」状にたどり、キャッシュに残っている頂点を優先する
+ * - outClusters を渡すと、キャッシュが途切れる位置（クラスタ境界）の
+ *   三角形番号を返す（OptimizeOverdraw で使用）
+ */
+void OptimizeVertexCache(std::vector<unsigned int>& indices,
+                         unsigned int numVerts,
+                         std::vector<unsigned int>* outClusters = nullptr,
+                         unsigned int cacheSize = 16);
+
+/**
+ * @brief クラスタ単位の並べ替えによるオーバードロー削減。
+ *
+ * - 各クラスタの「外向き度合い」（重心方向と平均法線の内積）が
+ *   大きいものから描くことで、手前の面で奥の面を早期 Z 棄却させる
+ * - クラスタ内部の順序は維持するので ACMR はほぼ変わらない
+ * - 大きすぎるクラスタは maxClusterTriangles ごとに分割してから並べる
+ *   （分割点でキャッシュが数頂点分冷えるだけ）
+ * - verts : xyz * numVerts
+ */
+void OptimizeOverdraw(std::vector<unsigned int>& indices,
+                      const float* verts,
+                      unsigned int numVerts,
+                      const std::vector<unsigned int>& clusters,
+                      unsigned int maxClusterTriangles = 256);
+
+/**
+ * @brief 頂点フェッチ順の最適化。
+ *
+ * - インデックスに初めて現れた順に頂点番号を振り直す
+ * - indices を書き換え、旧番号 → 新番号の対応表を返す
+ *   （参照されない頂点は末尾に回す）
+ * - 頂点データの並べ替えは RemapVertexStream で行う
+ */
+std::vector<unsigned int> OptimizeVertexFetch(std::vector<unsigned int>& indices,
+                                              unsigned int numVerts);
+
+/**
+ * @brief 対応表に従って頂点ストリーム（components 要素 / 頂点）を並べ替える。
+ */
+template <typename T>
+void RemapVertexStream(std::vector<T>& data,
+                       unsigned int components,
+                       const std::vector<unsigned int>& remap)
+{
+    std::vector<T> result(data.size());
+    for (std::size_t v = 0; v < remap.size(); v++)
+    {
+        for (unsigned int c = 0; c < components; c++)
+        {
+            result[remap[v] * components + c] = data[v * components + c];
+        }
+    }
+    data.swap(result);
+}
+
+} // namespace MeshOptimizer
+} // namespace toy
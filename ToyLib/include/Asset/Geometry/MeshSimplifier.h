@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+namespace toy {
+namespace MeshSimplifier {
+
+/**
+ * @brief 二次誤差（Quadric Error Metric）による辺縮約でインデックスを間引く。
+ *
+ * - 頂点を既存頂点へ寄せる「ハーフエッジ縮約」のみを行うため、
+ *   頂点バッファは一切変更せず、インデックス列だけを生成する。
+ *   （法線・UV・ボーンウェイトは元の頂点のものがそのまま使われる）
+ * - UV シーム上の頂点（同一座標に複数頂点がある）はロックし、
+ *   境界辺上の頂点は境界に沿ってのみ縮約する。
+ * - verts : xyz * numVerts
+ * - targetIndexCount : 目標インデックス数（到達できない場合もある）
+ * - maxError : 許容誤差（メッシュ半径に対する比率）
+ *
+ * @return 簡略化後のインデックス列（三角形リスト）
+ */
+std::vector<unsigned int> Simplify(
+    const float* verts,
+    unsigned int numVerts,
+    const unsigned int* indices,
+    unsigned int numIndices,
+    unsigned int targetIndexCount,
+    float maxError = 0.05f,
+    float* outError = nullptr
+);
+
+/**
+ * @brief LOD チェーンを生成する。
+ *
+ * - 戻り値の [0] は元のインデックス列（LOD0）
+ * - 以降、前段の約半分を目標に最大 maxLevels-1 段まで生成する
+ * - 十分に減らなかった段（ロック頂点が多いメッシュ等）はそこで打ち切る
+ * - minTriangles 未満の小さなメッシュは LOD0 のみ返す
+ */
+std::vector<std::vector<unsigned int>> GenerateLodChain(
+    const float* verts,
+    unsigned int numVerts,
+    const std::vector<unsigned int>& indices,
+    int maxLevels = 4,
+    unsigned int minTriangles = 64
+);
+
+} // namespace MeshSimplifier
+} // namespace toy
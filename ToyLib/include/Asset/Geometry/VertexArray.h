@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Utils/MathUtil.h"
+#include "Asset/Geometry/VertexFormat.h"
 #include <memory>
 #include <vector>
 
@@ -53,6 +54,29 @@ public:
                 unsigned int numIndices,
                 const unsigned int* indices);
 
+    //=====================================================
+    // ▼ 量子化インターリーブ（Mesh 用 / スキンなし）
+    //   packed : PackedVertex * numVerts（1 本の VBO）
+    //   q      : 位置の復元パラメータ（シェーダへ渡す）
+    //   verts  : 物理判定用の元座標 xyz（GPU には送らない）
+    //=====================================================
+    VertexArray(const PackedVertex* packed,
+                unsigned int numVerts,
+                const VertexQuantization& q,
+                const float* verts,
+                const unsigned int* indices,
+                unsigned int numIndices);
+
+    //=====================================================
+    // ▼ 量子化インターリーブ（Mesh 用 / スキンあり）
+    //=====================================================
+    VertexArray(const PackedSkinnedVertex* packed,
+                unsigned int numVerts,
+                const VertexQuantization& q,
+                const float* verts,
+                const unsigned int* indices,
+                unsigned int numIndices);
+
     //=====================================================
     // ▼ 雨粒やフルスクリーンエフェクト等の特殊用途
     //   （頂点が vec2 のみ）
@@ -82,6 +106,13 @@ public:
     unsigned int GetNumVerts() const   { return mNumVerts; }
     unsigned int GetNumIndices() const { return mNumIndices; }
 
+    //-----------------------------------------------
+    // 量子化フォーマットかどうか / 位置の復元パラメータ
+    //  ・シェーダ側 uQuantized / uPosScale / uPosOffset に対応
+    //-----------------------------------------------
+    bool IsQuantized() const { return mIsQuantized; }
+    const VertexQuantization& GetQuantization() const { return mQuantization; }
+
     //-----------------------------------------------
     // 三角形ポリゴン（ローカル）取得
     //-----------------------------------------------
@@ -92,6 +123,23 @@ public:
     //-----------------------------------------------
     std::vector<struct Polygon> GetWorldPolygons(const Matrix4& worldTransform) const;
 
+    //-----------------------------------------------
+    // LOD（詳細度）
+    //  ・lods[0] は元のインデックス列、以降が簡略化済み
+    //  ・全レベルを 1 本の IBO に連結して再転送する
+    //  ・頂点バッファは全レベルで共有
+    //-----------------------------------------------
+    void SetLodIndices(const std::vector<std::vector<unsigned int>>& lods);
+
+    // 連結済みのインデックス列とレベルごとの個数から設定（キャッシュ読み込み用）
+    void SetLodIndices(const unsigned int* packedIndices,
+                       const std::vector<unsigned int>& lodCounts);
+    int  GetNumLods() const { return static_cast<int>(mLodLevels.size()); }
+
+    // 指定 LOD のインデックス数 / glDrawElements に渡すオフセット
+    unsigned int GetLodNumIndices(int lod) const;
+    const void*  GetLodIndexOffset(int lod) const;
+
 private:
     // 頂点数・インデックス数
     unsigned int mNumVerts   = 0;
@@ -108,6 +156,12 @@ private:
     unsigned int mVertexBufferID = 0;
     unsigned int mIndexBufferID  = 0;
 
+    //-----------------------------------------------
+    // 量子化情報
+    //-----------------------------------------------
+    bool               mIsQuantized = false;
+    VertexQuantization mQuantization;
+
     //-----------------------------------------------
     // マテリアルインデックスとして使う TextureID
     //-----------------------------------------------
@@ -118,6 +172,16 @@ private:
     //-----------------------------------------------
     std::vector<struct Polygon> mPolygons;
 
+    //-----------------------------------------------
+    // LOD ごとの IBO 内範囲（[0] は常に元メッシュ）
+    //-----------------------------------------------
+    struct LodRange
+    {
+        unsigned int offset;      // 先頭インデックス位置
+        unsigned int numIndices;  // インデックス数
+    };
+    std::vector<LodRange> mLodLevels;
+
 private:
     //-----------------------------------------------
     // ローカル頂点 → Polygon（三角形リスト）へ変換
@@ -125,6 +189,14 @@ private:
     void CreatePolygons(const float* verts,
                         const unsigned int* indices,
                         unsigned int numIndices);
+
+    //-----------------------------------------------
+    // 量子化インターリーブ共通：VAO / VBO / IBO と
+    // 位置・法線・UV の属性設定（stride は頂点構造体サイズ）
+    //-----------------------------------------------
+    void CreatePackedBuffers(const void* packed,
+                             unsigned int stride,
+                             const unsigned int* indices);
 };
 
 } // namespace toy
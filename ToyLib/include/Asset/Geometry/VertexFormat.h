@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+#include <cstdint>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// 量子化インターリーブ頂点（Mesh 用）
+//   - 位置 : snorm16 x3（メッシュの AABB 内に正規化）＋パディング
+//   - 法線 : 八面体エンコード snorm16 x2
+//   - UV   : half x2
+//   → 16 byte / 頂点（float 版は 32 byte）
+//==============================================================
+struct PackedVertex
+{
+    int16_t  pos[4];     // xyz + pad
+    int16_t  normal[2];  // octahedral
+    uint16_t uv[2];      // half float
+};
+
+//==============================================================
+// 量子化インターリーブ頂点（スキンメッシュ用）
+//   - PackedVertex ＋ ボーン ID uint8 x4 ＋ ウェイト unorm8 x4
+//   → 24 byte / 頂点（float/int 版は 64 byte）
+//==============================================================
+struct PackedSkinnedVertex
+{
+    int16_t  pos[4];
+    int16_t  normal[2];
+    uint16_t uv[2];
+    uint8_t  bones[4];
+    uint8_t  weights[4];
+};
+
+static_assert(sizeof(PackedVertex) == 16, "PackedVertex must be 16 bytes");
+static_assert(sizeof(PackedSkinnedVertex) == 24, "PackedSkinnedVertex must be 24 bytes");
+
+//==============================================================
+// 位置の復元パラメータ
+//   pos = quantized(-1..1) * scale + offset
+//==============================================================
+struct VertexQuantization
+{
+    Vector3 offset = Vector3::Zero;
+    Vector3 scale  = Vector3(1.0f, 1.0f, 1.0f);
+};
+
+namespace VertexFormat {
+
+// float → half（丸めあり）
+uint16_t FloatToHalf(float f);
+
+// 単位ベクトル → 八面体エンコード（snorm16 x2）
+void EncodeOctahedral(float x, float y, float z, int16_t out[2]);
+
+// 頂点群の AABB から位置の復元パラメータを求める
+VertexQuantization ComputeQuantization(const float* verts, unsigned int numVerts);
+
+// 通常メッシュ用にパック
+void PackVertices(unsigned int numVerts,
+                  const float* verts,
+                  const float* norms,
+                  const float* uvs,
+                  const VertexQuantization& q,
+                  std::vector<PackedVertex>& out);
+
+// スキンメッシュ用にパック（ウェイトは合計 255 になるよう丸める）
+void PackSkinnedVertices(unsigned int numVerts,
+                         const float* verts,
+                         const float* norms,
+                         const float* uvs,
+                         const unsigned int* boneids,
+                         const float* weights,
+                         const VertexQuantization& q,
+                         std::vector<PackedSkinnedVertex>& out);
+
+} // namespace VertexFormat
+} // namespace toy
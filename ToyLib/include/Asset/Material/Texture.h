@@ -1,7 +1,11 @@
 #pragma once
 
 #include "Utils/MathUtil.h"
+#include "Asset/Material/TextureCompression.h"
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace toy {
 
@@ -10,6 +14,7 @@ namespace toy {
 //   ・OpenGL テクスチャを管理するクラス
 //   ・画像ファイル / メモリからの読み込み
 //   ・描画用テクスチャ / フォント描画用
+//   ・配列テクスチャ（GL_TEXTURE_2D_ARRAY）
 //   ・シャドウマップ / ポストエフェクト用の生成
 //============================================================
 class Texture
@@ -22,9 +27,21 @@ public:
     // 読み込み系
     // --------------------------------------------------------
 
-    // SDL3_image を用いた画像ファイル読み込み
+    // SDL3_image を用いた画像ファイル読み込み（Decode() → Upload()）
     bool Load(const std::string& fileName, class AssetManager* assetManager);
 
+    // 読み込み前半：デコード・ミップ生成・BC 圧縮（GL を使わないのでワーカーから呼べる）
+    //  - 設定は AssetManager::GetTextureSettings()
+    //  - 圧縮する設定なら結果を <元ファイル>.ttex に残し、次回はそれを mmap する
+    bool Decode(const std::string& fileName, class AssetManager* assetManager);
+
+    // 読み込み後半：デコード済みの全ミップを GL へ転送（メインスレッド）
+    bool Upload();
+
+    // GPU が対応していない圧縮形式・異方性フィルタを設定から外す
+    //  - GL コンテキスト作成後に呼ぶこと（AssetManager::LoadSettings から）
+    static void ApplyDeviceLimits(TextureSettings& settings);
+
     // 埋め込み画像読み込み（Assimp の aiTexture 用）
     bool LoadFromMemory(const void* data, int size);                   // データサイズのみ（画像フォーマットを判別）
     bool LoadFromMemory(const void* data, int width, int height);      // RGBAピクセル直接
@@ -32,6 +49,41 @@ public:
     // SDL_ttf 等から受け取ったピクセルデータによるテクスチャ生成
     bool CreateFromPixels(const void* pixels, int width, int height, bool hasAlpha = true);
 
+    // CreateFromPixels で作ったテクスチャの一部を書き換える（RGBA8、行は詰めた並び）
+    //  - グリフアトラスへの追記など、作り直さずに差分だけ送る用
+    bool UpdatePixels(int x, int y, int width, int height, const void* pixels);
+
+    // RGBA8 の詰めた配列から作成（settings の mipmaps / anisotropy を使う、圧縮はしない）
+    bool CreateFromRGBA(const uint8_t* rgba,
+                        int width,
+                        int height,
+                        const TextureSettings& settings = TextureSettings());
+
+    // 画像ファイルを RGBA8 の詰めた配列へデコード（GL を使わない）
+    //  - アトラスや配列テクスチャの素材を読む用
+    static bool DecodeRGBA(const std::string& fileName,
+                           class AssetManager* assetManager,
+                           std::vector<uint8_t>& outPixels,
+                           int& outWidth,
+                           int& outHeight);
+
+    // --------------------------------------------------------
+    // 配列テクスチャ（GL_TEXTURE_2D_ARRAY）
+    //  - 同じサイズの画像を層に積み、1 回のバインドで使い分ける
+    //  - シェーダ側は sampler2DArray ＋ 層番号で読む
+    // --------------------------------------------------------
+
+    // RGBA8 の層を並べて作成（layers[i] が i 層目）
+    //  - settings の mipmaps / anisotropy を使う（圧縮はしない）
+    bool CreateArray(const std::vector<const uint8_t*>& layers,
+                     int width,
+                     int height,
+                     const TextureSettings& settings = TextureSettings());
+
+    // 画像ファイルを順に層として読み込む（全ファイル同じサイズであること）
+    bool LoadArray(const std::vector<std::string>& fileNames,
+                   class AssetManager* assetManager);
+
     // --------------------------------------------------------
     // 特殊テクスチャ生成
     // --------------------------------------------------------
@@ -39,6 +91,10 @@ public:
     // 空のレンダリング用テクスチャ作成（FBO 等で利用）
     void CreateForRendering(int w, int h, unsigned int format);
 
+    // 計算結果を格納するデータテクスチャ（RGBA32F、補間なし）
+    //  - ボーン行列の焼き込みなど、シェーダから texelFetch で読む用途
+    bool CreateFloatData(const float* rgba, int width, int height);
+
     // グローエフェクト・レンズフレアなど用の円グラデーション
     bool CreateAlphaCircle(int size,
                            float centerX,
@@ -61,12 +117,21 @@ public:
     void Unload();
 
     // テクスチャをアクティブ化 → 指定テクスチャユニットへ
+    //  - 未読み込みなら 1x1 の白いプレースホルダを結ぶ
+    //  - 配列テクスチャは GL_TEXTURE_2D_ARRAY に結ぶ
     void SetActive(int unit);
 
+    // GL テクスチャができているか（非同期読み込みの完了判定）
+    bool IsLoaded() const { return mTextureID != 0; }
+
     // サイズ取得
     int GetWidth()  const { return mWidth; }
     int GetHeight() const { return mHeight; }
 
+    // 配列テクスチャか / 層の数（通常のテクスチャは 1）
+    bool IsArray()      const { return mIsArray; }
+    int  GetNumLayers() const { return mNumLayers; }
+
     // --------------------------------------------------------
     // シャドウマップ用テクスチャ生成（深度テクスチャ）
     // --------------------------------------------------------
@@ -82,6 +147,13 @@ private:
     // サイズ
     int mWidth  = 0;
     int mHeight = 0;
+
+    // 配列テクスチャ
+    bool mIsArray   = false;
+    int  mNumLayers = 1;
+
+    // Decode() 済みで Upload() 待ちのデータ
+    std::unique_ptr<struct TextureLoadData> mPending;
 };
 
 } // namespace toy
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// TextureRegion
+//  - テクスチャの一部（アトラス内の 1 枚、配列テクスチャの 1 層）
+//  - UV は左上 (u0, v0) から右下 (u1, v1)
+//  - width / height は元画像のピクセルサイズ（描画サイズの基準）
+//  - layer は配列テクスチャの層番号（通常のテクスチャでは 0）
+//==============================================================
+struct TextureRegion
+{
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 1.0f;
+    float v1 = 1.0f;
+    int   width  = 0;
+    int   height = 0;
+    int   layer  = 0;
+};
+
+//==============================================================
+// TextureAtlas
+//  - 小さな画像を 1 枚（収まらなければ複数ページ）に詰めて、
+//    スプライトやビルボードが同じテクスチャを共有できるようにする
+//  - 詰め方はスカイライン法（bottom-left）。高さの大きい順に置く
+//  - 画像の周りに padding 分だけ端の画素を複製し、ミップや
+//    バイリニアで隣の画像がにじまないようにする
+//  - 1 ページなら通常のテクスチャ、複数ページなら配列テクスチャ
+//    （ページ = 層、TextureRegion::layer）になる
+//==============================================================
+class TextureAtlas
+{
+public:
+    TextureAtlas();
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /**
+     * @brief RGBA8 の画像を登録する（Build 前）。
+     *
+     * - 同じ名前は上書き
+     */
+    bool AddImage(const std::string& name, const uint8_t* rgba, int width, int height);
+
+    /**
+     * @brief 画像ファイルを読んで登録する（名前はファイル名）。
+     */
+    bool AddFile(const std::string& fileName, class AssetManager* assetManager);
+
+    /**
+     * @brief 登録した画像を詰めて GL テクスチャを作る。
+     *
+     * - maxPageSize : 1 ページの最大辺（2 の冪。足りる範囲で小さく取る）
+     * - padding     : 画像の周囲に複製する画素数
+     * - 1 枚でもページに収まらない画像があれば false
+     * - 成功すると登録した画素は破棄する（再 Build は AddImage からやり直し）
+     */
+    bool Build(int maxPageSize = 2048, int padding = 2, class AssetManager* assetManager = nullptr);
+
+    // 名前から領域を引く（無ければ nullptr）
+    const TextureRegion* FindRegion(const std::string& name) const;
+
+    // 詰めた結果のテクスチャ（Build 前は nullptr）
+    std::shared_ptr<class Texture> GetTexture() const { return mTexture; }
+
+    int GetNumPages()  const { return mNumPages; }
+    int GetPageSize()  const { return mPageSize; }
+
+private:
+    struct Source
+    {
+        std::string          name;
+        std::vector<uint8_t> pixels;
+        int                  width  = 0;
+        int                  height = 0;
+    };
+
+    std::vector<Source>                            mSources;
+    std::unordered_map<std::string, TextureRegion> mRegions;
+    std::shared_ptr<class Texture>                 mTexture;
+
+    int mNumPages;
+    int mPageSize;
+};
+
+} // namespace toy
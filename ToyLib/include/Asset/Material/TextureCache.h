@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Asset/Material/TextureCompression.h"
+#include "Asset/File/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//==============================================================
+// ミップ 1 段分
+//  - data はキャッシュ読み込み時は mmap 領域を、
+//    画像からの変換時は TextureCacheData::Retain した領域を指す
+//==============================================================
+struct TextureLevel
+{
+    int            width  = 0;
+    int            height = 0;
+    const uint8_t* data   = nullptr;
+    size_t         size   = 0;
+};
+
+//==============================================================
+// Texture を GL へ転送するのに必要なデータ一式
+//==============================================================
+struct TextureCacheData
+{
+    TextureFormat             format = TextureFormat::RGBA8;
+    std::vector<TextureLevel> levels;   // [0] が元の解像度
+
+    // 変換時のバッファを書き出し・転送まで保持し、その先頭を返す
+    const uint8_t* Retain(std::vector<uint8_t>&& data);
+
+private:
+    std::list<std::vector<uint8_t>> mStorage;
+};
+
+//==============================================================
+// TextureCache
+//  - ミップ生成と BC 圧縮の結果をバイナリに焼いておき、次回以降は
+//    ファイルを 1 回 mmap して各段をそのまま GL へ転送する
+//  - ヘッダに元ファイルの内容ハッシュ（設定込み）を持ち、不一致なら使わない
+//  - ファイル配置：<元ファイル>.ttex（書き込めなければ作らないだけ）
+//==============================================================
+class TextureCache
+{
+public:
+    // 形式を変えたら上げる（古いキャッシュは自動で作り直される）
+    static constexpr uint32_t kVersion = 1;
+    static constexpr const char* kExtension = ".ttex";
+
+    TextureCache();
+    ~TextureCache();
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    /**
+     * @brief 元画像の内容ハッシュ（FNV-1a 64bit）。
+     *
+     * - ミップ有無・圧縮モードと形式バージョンも混ぜる
+     */
+    static uint64_t HashSourceData(const void* data, size_t size, const TextureSettings& settings);
+
+    /**
+     * @brief キャッシュを mmap して解析する。
+     *
+     * - ハッシュ / バージョン不一致、破損時は false
+     * - 成功時の各段はマップ領域を指すので、GL へ転送し終えるまで破棄しないこと
+     */
+    bool Open(const std::string& cachePath, uint64_t sourceHash);
+
+    /**
+     * @brief メモリ上のキャッシュを解析する（アセットパック用）。
+     */
+    bool OpenMemory(const void* data, size_t size, uint64_t sourceHash);
+
+    // マップ解除（OpenMemory の場合は参照を外すだけ）
+    void Close();
+
+    const TextureCacheData& GetData() const { return mData; }
+
+    /**
+     * @brief キャッシュを書き出す（一時ファイルに書いてから置き換え）。
+     */
+    static bool Write(const std::string& cachePath,
+                      uint64_t sourceHash,
+                      const TextureCacheData& data);
+
+private:
+    bool Parse(uint64_t sourceHash);
+
+    MappedFile     mFile;      // Open() のときだけ使う
+    const uint8_t* mMapped;    // 解析対象（mFile か外部のメモリ）
+    size_t         mSize;
+
+    TextureCacheData mData;
+};
+
+} // namespace toy
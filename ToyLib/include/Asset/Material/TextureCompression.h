@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace toy {
+
+//======================================================================
+// TextureFormat
+//   - GPU へ転送するときの形式（キャッシュにもこの値で保存する）
+//======================================================================
+enum class TextureFormat : uint32_t
+{
+    RGBA8 = 0,   // 無圧縮
+    BC1   = 1,   // RGB 4bpp（不透明用、DXT1）
+    BC3   = 2,   // RGBA 8bpp（BC1 ＋ 補間アルファ、DXT5）
+    BC7   = 3,   // RGBA 8bpp（BPTC、BC3 より高画質）
+};
+
+//======================================================================
+// TextureCompressionMode
+//   - Auto : 不透明なら BC1、アルファがあれば BC3
+//   - BC7  : すべて BC7（非対応の GPU では Auto に落とす）
+//======================================================================
+enum class TextureCompressionMode : uint32_t
+{
+    None = 0,
+    Auto = 1,
+    BC7  = 2,
+};
+
+//======================================================================
+// TextureSettings
+//   - 画像ファイルから読むテクスチャの設定
+//     （Renderer_Settings.json の "texture"、AssetManager::LoadSettings）
+//   - 既定値は GPU の対応を問わず使える組み合わせ
+//======================================================================
+struct TextureSettings
+{
+    bool                   mipmaps     = true;
+    float                  anisotropy  = 1.0f;   // 1 で無効
+    TextureCompressionMode compression = TextureCompressionMode::None;
+    bool                   cache       = true;   // <元ファイル>.ttex を使う・書き出す
+};
+
+//======================================================================
+// TextureCompression
+//   - ミップ生成と BC1 / BC3 / BC7 へのエンコード（CPU、オフライン用）
+//   - 入力はすべて RGBA8 の詰めた配列
+//======================================================================
+namespace TextureCompression {
+
+/**
+ * @brief 2x2 ボックスフィルタで 1x1 までのミップを作る。
+ *
+ * - outLevels[0] が 1 段目（元画像の半分）。奇数サイズは端を繰り返す
+ */
+void GenerateMips(const uint8_t* rgba,
+                  int width,
+                  int height,
+                  std::vector<std::vector<uint8_t>>& outLevels);
+
+/**
+ * @brief 1 画素でもアルファが 255 未満なら true。
+ */
+bool HasAlpha(const uint8_t* rgba, size_t numPixels);
+
+/**
+ * @brief 1 段分のバイト数（圧縮形式は 4x4 ブロック単位に切り上げ）。
+ */
+size_t ComputeLevelSize(TextureFormat format, int width, int height);
+
+/**
+ * @brief 1 段分をエンコードして out に追記する（RGBA8 ならそのままコピー）。
+ *
+ * - 4 の倍数でない端のブロックは端の画素を繰り返して埋める
+ */
+void Encode(TextureFormat format,
+            const uint8_t* rgba,
+            int width,
+            int height,
+            std::vector<uint8_t>& out);
+
+} // namespace TextureCompression
+} // namespace toy
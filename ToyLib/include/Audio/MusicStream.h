@@ -0,0 +1,133 @@
+// Audio/MusicStream.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <AL/al.h>
+#include <AL/alc.h>
+
+#include "Audio/PcmRingBuffer.h"
+
+namespace toy {
+
+//--------------------------------------
+// BGM ストリーミングの設定（Renderer_Settings.json の "audio" → "bgm"）
+//  - 時間はすべて秒
+//--------------------------------------
+struct MusicStreamSettings
+{
+    int   minBuffers  = 3;        // 常にキューに積んでおくバッファ数
+    int   maxBuffers  = 12;       // 作る OpenAL バッファの上限
+    float minChunk    = 0.025f;   // 1 バッファの長さの下限
+    float maxChunk    = 0.25f;    // 1 バッファの長さの上限
+    float minLead     = 0.2f;     // キューに積んでおく長さの下限
+    float maxLead     = 1.0f;     // キューに積んでおく長さの上限
+    float ringSeconds = 2.0f;     // デコード済みで貯めておく長さ
+    float crossfade   = 1.5f;     // CrossfadeBGM の既定のフェード時間
+};
+
+//--------------------------------------
+// 統計（デバッグ表示用）
+//--------------------------------------
+struct MusicStreamStats
+{
+    int   numBuffers      = 0;      // 作った OpenAL バッファ数
+    int   numQueued       = 0;      // キューに積んでいるバッファ数
+    float queuedSeconds   = 0.0f;   // キューに積んでいる長さ
+    float bufferedSeconds = 0.0f;   // リングに貯まっている長さ
+    int   underruns       = 0;      // 途切れた回数（累計）
+};
+
+//--------------------------------------
+// MusicStream
+//  - 1 曲ぶんのストリーミング再生（OpenAL ソース 1 つ + バッファ群）
+//  - デコード（Music::ReadChunk）はオーディオスレッドが Decode で行い、
+//    PCM をリングへ書く。ゲームスレッドは Service でリングから
+//    OpenAL のバッファへ移すだけなので、フレーム内でデコードしない
+//  - 1 バッファの長さとキューに積む長さは、直近の重いフレームの時間から決める
+//    （長いフレームでも途切れないだけ先に積み、軽いときは遅延を減らす）
+//  - Open / Close / Decode は SoundMixer のストリーム用ミューテックスを
+//    持った状態で呼ぶ。Service はゲームスレッドからロックなしで呼ぶ
+//--------------------------------------
+class MusicStream
+{
+public:
+    MusicStream();
+    ~MusicStream();
+
+    MusicStream(const MusicStream&) = delete;
+    MusicStream& operator=(const MusicStream&) = delete;
+
+    //---- ゲームスレッド（ロックを持って） ----
+    bool Open(std::shared_ptr<class Music> music, bool loop,
+              const MusicStreamSettings& settings);
+    void Close();
+
+    // OpenAL のソース・バッファを破棄（コンテキストを壊す前に）
+    void Release();
+
+    //---- オーディオスレッド（ロックを持って） ----
+    // リングの空きぶんをデコードする（返値は書いたバイト数）
+    size_t Decode(std::vector<unsigned char>& scratch);
+
+    //---- ゲームスレッド ----
+    // リング → OpenAL のキュー、フェード、途切れたときの再開
+    //  - peakFrame は直近の重いフレームの時間（秒）
+    void Service(float deltaTime, float peakFrame, float volume);
+
+    // フェード（seconds <= 0 ならすぐに）
+    void SetFade(float fade);
+    void FadeTo(float target, float seconds);
+
+    bool IsOpen() const { return mMusic != nullptr; }
+
+    // フェードアウトし終えた / ループしない曲を最後まで鳴らした
+    bool IsFadedOut() const { return mFadeTarget <= 0.0f && mFade <= 0.0f; }
+    bool IsFinished() const;
+
+    const std::shared_ptr<class Music>& GetMusic() const { return mMusic; }
+
+    MusicStreamStats GetStats() const;
+
+private:
+    // 使っていないバッファを取る（足りなければ上限まで作る）
+    ALuint AcquireBuffer();
+
+    // 再生済みのバッファを外して空きへ戻す
+    void UnqueueProcessed();
+
+    float BytesToSeconds(size_t bytes) const;
+
+    std::shared_ptr<class Music> mMusic;
+    bool mLoop;
+
+    MusicStreamSettings mSettings;
+
+    // デコード済み PCM（オーディオスレッド → ゲームスレッド）
+    PcmRingBuffer     mRing;
+    std::atomic<bool> mEndOfStream;   // ループしない曲をデコードし終えた
+
+    // OpenAL
+    ALuint              mSource;
+    std::vector<ALuint> mBuffers;       // 作ったバッファすべて
+    std::vector<ALuint> mFreeBuffers;   // キューに積んでいないもの
+    std::vector<unsigned char> mUpload; // リング → alBufferData の一時領域
+
+    ALenum mFormat;
+    long   mRate;
+    size_t mFrameBytes;      // 1 サンプル × 全チャンネルのバイト数
+    size_t mQueuedBytes;
+    int    mNumQueued;
+    bool   mStarted;
+    int    mUnderruns;
+
+    // フェード（0〜1、音量に掛ける）
+    float mFade;
+    float mFadeTarget;
+    float mFadeSpeed;        // 1 秒あたりの変化量
+};
+
+} // namespace toy
@@ -0,0 +1,107 @@
+// Audio/PcmRingBuffer.h
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace toy {
+
+//--------------------------------------
+// PcmRingBuffer
+//  - デコード済み PCM（バイト列）を渡すための単一生産者・単一消費者のリング
+//  - Write はオーディオスレッド（デコード側）、Read はゲームスレッド（OpenAL 側）
+//    からだけ呼ぶ。どちらもロックを取らない
+//  - 容量は 2 のべき乗に切り上げる（添字はマスクで回す）
+//  - Reset は両側が触っていないときだけ呼ぶ
+//--------------------------------------
+class PcmRingBuffer
+{
+public:
+    PcmRingBuffer()
+    : mMask(0)
+    , mWritePos(0)
+    , mReadPos(0)
+    {
+    }
+
+    // 容量を決めて空にする
+    void Reset(size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        if (mData.size() != size)
+        {
+            mData.assign(size, 0);
+        }
+        mMask = size - 1;
+        mWritePos.store(0, std::memory_order_relaxed);
+        mReadPos.store(0, std::memory_order_relaxed);
+    }
+
+    size_t GetCapacity() const { return mData.size(); }
+
+    // 読める量（消費者側で使う）
+    size_t GetReadable() const
+    {
+        return mWritePos.load(std::memory_order_acquire) -
+               mReadPos.load(std::memory_order_relaxed);
+    }
+
+    // 書ける量（生産者側で使う）
+    size_t GetWritable() const
+    {
+        return mData.size() -
+               (mWritePos.load(std::memory_order_relaxed) -
+                mReadPos.load(std::memory_order_acquire));
+    }
+
+    // 書き込み（入り切らない分は書かない。返値は書いたバイト数）
+    size_t Write(const unsigned char* src, size_t bytes)
+    {
+        const size_t w = mWritePos.load(std::memory_order_relaxed);
+        const size_t n = std::min(bytes, GetWritable());
+        Copy(mData.data(), w, src, n);
+        mWritePos.store(w + n, std::memory_order_release);
+        return n;
+    }
+
+    // 読み出し（返値は読んだバイト数）
+    size_t Read(unsigned char* dst, size_t bytes)
+    {
+        const size_t r = mReadPos.load(std::memory_order_relaxed);
+        const size_t n = std::min(bytes, GetReadable());
+
+        const size_t begin = r & mMask;
+        const size_t first = std::min(n, mData.size() - begin);
+        std::memcpy(dst, mData.data() + begin, first);
+        std::memcpy(dst + first, mData.data(), n - first);
+
+        mReadPos.store(r + n, std::memory_order_release);
+        return n;
+    }
+
+private:
+    // 折り返しを考えてリングへ書く
+    void Copy(unsigned char* ring, size_t pos, const unsigned char* src, size_t n)
+    {
+        const size_t begin = pos & mMask;
+        const size_t first = std::min(n, mData.size() - begin);
+        std::memcpy(ring + begin, src, first);
+        std::memcpy(ring, src + first, n - first);
+    }
+
+    std::vector<unsigned char> mData;
+    size_t mMask;
+
+    // 書いた総量 / 読んだ総量（差が溜まっている量）
+    std::atomic<size_t> mWritePos;
+    std::atomic<size_t> mReadPos;
+};
+
+} // namespace toy
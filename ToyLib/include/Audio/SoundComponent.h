@@ -1,17 +1,16 @@
 // Audio/SoundComponent.h
 #pragma once
 #include "Engine/Core/Component.h"
+#include "Audio/VoicePool.h"
 #include <string>
 
-#include <AL/al.h>
-#include <AL/alc.h>
-
 namespace toy {
 
 //----------------------------------------------
 // SoundComponent
 //  - Actor に取り付けて使用する 3D/2D サウンド再生コンポーネント
-//  - OpenAL の "ソース" を 1 つ保持
+//  - 再生は SoundMixer の VoicePool を通す（ソースは持たず、ボイスのハンドルだけ）
+//  - 遠くて聞こえない間やソースが足りない間は仮想ボイスとして経過だけ進む
 //  - 距離減衰やループ、オート再生、排他制御などをサポート
 //----------------------------------------------
 class SoundComponent : public Component
@@ -37,6 +36,11 @@ public:
     //  - useAttenuation = true の場合、Actor のワールド位置から距離減衰を行う
     void SetUseDistanceAttenuation(bool useAttenuation) { mUseDistanceAttenuation = useAttenuation; }
 
+    // ソースの取り合いでの扱い（次の Play から）
+    //  - category は分類ごとの同時発音数、priority は大きいほど優先
+    void SetCategory(SoundCategory category) { mCategory = category; }
+    void SetPriority(int priority) { mPriority = priority; }
+
     // 排他モード
     //  - true の場合、他の SoundComponent が同じ音を再生中なら再生しない
     void SetExclusive(bool isExclusive) { mIsExclusive = isExclusive; }
@@ -58,7 +62,10 @@ private:
 
     bool  mHasPlayed = false;                // AutoPlay 用フラグ
 
-    ALuint mSource = 0;                      // OpenAL ソース（このコンポ用）
+    SoundCategory mCategory = SoundCategory::Effect;
+    int           mPriority = 0;
+
+    VoiceHandle mVoice = 0;                  // 再生中のボイス（0 は無し）
 };
 
 } // namespace toy
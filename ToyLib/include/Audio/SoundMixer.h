@@ -4,11 +4,16 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #include <AL/al.h>
 #include <AL/alc.h>
 
 #include "Utils/MathUtil.h"      // Matrix4 / Vector3
+#include "Audio/VoicePool.h"
+#include "Audio/MusicStream.h"
 
 namespace toy {
 
@@ -20,7 +25,9 @@ class SoundEffect;
 // サウンド制御クラス
 //  - OpenAL を使った BGM/SE ミキサー
 //  - AssetManager から Music/SoundEffect を取得して再生
-//  - BGM はストリーミング再生、SE はワンショット再生を想定
+//  - BGM はストリーミング再生（デコードは専用のオーディオスレッド）、
+//    SE は VoicePool のソースを使い回して再生
+//  - BGM は 2 本のストリームを持ち、曲の切り替えをクロスフェードできる
 //--------------------------------------
 class SoundMixer
 {
@@ -37,16 +44,37 @@ public:
     void SetVolume(float volume);
 
     // BGM 読み込み＆制御
+    //  - PlayBGM は読み込んだ曲を先頭から。鳴っている曲は fadeTime で
+    //    クロスフェードする（0 なら切り替え）
     bool LoadBGM(const std::string& fileName);
-    void PlayBGM();
-    void StopBGM();
+    void PlayBGM(float fadeTime = 0.0f);
+    void StopBGM(float fadeTime = 0.0f);
+    void SetBGMLoop(bool loop) { mBgmLoop = loop; }
 
-    // 効果音のワンショット再生
-    void PlaySoundEffect(const std::string& fileName);
+    // 読み込み＋クロスフェード（fadeTime < 0 なら設定の "crossfade"）
+    void CrossfadeBGM(const std::string& fileName, float fadeTime = -1.0f);
+
+    // 今の曲のストリーミング状況（バッファ数・先読み量・途切れた回数）
+    MusicStreamStats GetBGMStats() const;
+
+    // 効果音のワンショット再生（2D、音量は全体ボリューム）
+    //  - ソースが足りなければ優先度の低いものから仮想ボイスになる
+    void PlaySoundEffect(const std::string& fileName,
+                         SoundCategory category = SoundCategory::Effect,
+                         int priority = 0);
+
+    // ボイス（SE 用ソースの割り当て）。SoundComponent もここから鳴らす
+    VoicePool*        GetVoicePool()        { return &mVoicePool; }
+    const VoiceStats& GetVoiceStats() const { return mVoicePool.GetStats(); }
+
+    // 設定読み込み（Renderer_Settings.json の "audio"）
+    //  - ソースを作り直すので、鳴らし始める前に呼ぶ
+    bool LoadSettings(const std::string& filePath);
 
     // 毎フレーム呼び出し
     //  - BGM のストリーミング更新
     //  - カメラ位置（invViewMatrix）からリスナー位置・向きを更新
+    //  - ボイスの経過・音源の割り当て直し
     void Update(float deltaTime, const Matrix4& invViewMatrix);
 
 private:
@@ -54,9 +82,12 @@ private:
     void InitOpenAL();
     void ShutdownOpenAL();
 
-    // BGM 用ソース/バッファの初期化/破棄
-    void InitBGMSource();
-    void ShutdownBGMSource();
+    // オーディオスレッドの開始/終了
+    void StartStreamThread();
+    void StopStreamThread();
+
+    // オーディオスレッドのメインループ（BGM のデコード）
+    void StreamThreadLoop();
 
 private:
     AssetManager* mAssetManager;     // アセット取得用ポインタ（非所有）
@@ -65,21 +96,28 @@ private:
     ALCdevice*  mDevice   = nullptr;
     ALCcontext* mContext  = nullptr;
 
-    // 効果音（ワンショット再生用ソース群）
-    std::vector<ALuint> mOneShotSources;
+    // 効果音（固定数のソースを優先度順に割り当てる）
+    VoicePool mVoicePool;
 
-    // --- BGM ストリーミング用設定 ---
-    static constexpr int BGM_NUM_BUFFERS = 4;          // ローテーションするバッファ数
-    static constexpr int BGM_CHUNK_SIZE  = 32 * 1024;  // 一度にデコードするバイト数
+    // --- BGM ストリーミング ---
+    static constexpr int BGM_NUM_STREAMS = 2;          // 今の曲 + フェードアウト中の曲
+    static constexpr int BGM_DECODE_SIZE = 32 * 1024;  // 一度にデコードするバイト数
 
-    ALuint mBgmSource = 0;                             // BGM 再生用のソース
-    ALuint mBgmBuffers[BGM_NUM_BUFFERS]{};             // BGM 用バッファ群
+    MusicStream mBgmStreams[BGM_NUM_STREAMS];
+    int         mBgmActive = 0;                        // 今の曲のストリーム
+    MusicStreamSettings mBgmSettings;
 
-    bool  mBgmPlaying = false;                         // 再生中フラグ
     bool  mBgmLoop    = true;                          // ループ再生するか
+    float mPeakFrame  = 1.0f / 60.0f;                  // 直近の重いフレームの時間（秒）
+
+    std::shared_ptr<Music> mCurrentBGM;                // 読み込んだ BGM
 
-    std::shared_ptr<Music> mCurrentBGM;                // 現在再生中の BGM
-    std::vector<unsigned char> mBgmDecodeBuffer;       // デコード先バッファ（mpg123 → PCM）
+    // オーディオスレッド（Open/Close/Decode は mStreamMutex で保護、
+    // PCM の受け渡しはストリームのリングでロックなし）
+    std::thread             mStreamThread;
+    std::mutex              mStreamMutex;
+    std::condition_variable mStreamCond;
+    bool                    mStreamQuit = false;
 
     // 共通設定（ミュート系／音量）
     bool  mBgmEnabled   = true;                        // BGM 全体の ON/OFF
@@ -0,0 +1,170 @@
+// Audio/VoicePool.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AL/al.h>
+#include <AL/alc.h>
+
+#include "Utils/MathUtil.h"
+
+namespace toy {
+
+//--------------------------------------
+// 音の分類（分類ごとに同時発音数の上限を持つ）
+//--------------------------------------
+enum class SoundCategory
+{
+    Effect,     // 効果音（SoundMixer::PlaySoundEffect の既定）
+    Ambient,    // 環境音（焚き火・鳴き声などのループ）
+    Voice,      // 台詞
+    UI,         // メニュー音
+    Count
+};
+
+// 再生したボイスの識別子（0 は無効、止まった後は別のボイスと混ざらない）
+using VoiceHandle = uint32_t;
+
+//--------------------------------------
+// 再生の指定
+//--------------------------------------
+struct VoiceParams
+{
+    std::shared_ptr<class SoundEffect> sound;
+    SoundCategory category = SoundCategory::Effect;
+    int   priority   = 0;       // 大きいほど優先（音源の取り合い・追い出し）
+    float volume     = 1.0f;
+    bool  loop       = false;
+
+    // 3D 音響（false なら距離減衰なしの 2D 再生）
+    bool    positional        = false;
+    Vector3 position          = Vector3::Zero;
+    float   referenceDistance = 3.0f;    // この距離まではほぼフル音量
+    float   maxDistance       = 50.0f;   // これ以上離れてもあまり変わらない
+    float   rolloff           = 1.0f;    // 減衰の強さ
+};
+
+//--------------------------------------
+// 設定（Renderer_Settings.json の "audio"）
+//--------------------------------------
+struct VoiceSettings
+{
+    int   maxSources       = 32;      // 確保する OpenAL ソース数（実際に鳴らせる数）
+    int   maxVoices        = 128;     // 追跡するボイス数（仮想ボイスを含む）
+    float audibleThreshold = 0.01f;   // これより小さく聞こえるものは仮想にする
+    int   categoryCaps[static_cast<int>(SoundCategory::Count)] = { 24, 8, 4, 4 };
+};
+
+//--------------------------------------
+// 統計（直前の Update 時点、デバッグ表示用）
+//--------------------------------------
+struct VoiceStats
+{
+    int numSources  = 0;   // 確保できた OpenAL ソース数
+    int numVoices   = 0;   // 追跡中のボイス数
+    int numReal     = 0;   // 音源を持って鳴っている数
+    int numVirtual  = 0;   // 聞こえない・枠が無いので経過だけ追っている数
+    int numStolen   = 0;   // 追い出したボイス数（累計）
+    int numRejected = 0;   // 優先度が足りず再生しなかった数（累計）
+    int realPerCategory[static_cast<int>(SoundCategory::Count)] = {};
+};
+
+//--------------------------------------
+// VoicePool
+//  - OpenAL ソースを起動時に決まった数だけ作り、効果音の再生で使い回す
+//    （再生ごとの alGenSources / alDeleteSources をなくす）
+//  - 再生中の音は「ボイス」として追跡し、毎フレーム
+//    優先度 → 聞こえる大きさ（音量 × 距離減衰）→ 新しさ の順に並べて、
+//    上位から分類ごとの上限・ソース数の範囲で音源を割り当てる
+//  - 音源をもらえなかったボイス、遠くて聞こえないボイスは仮想ボイスとして
+//    経過時間だけ進め、また上位に入ったらその位置から鳴らし直す
+//  - 追跡数も埋まっていたら、新しい音より下位のボイスを止めて入れ替える
+//    （下位が無ければ新しい音を鳴らさない）
+//--------------------------------------
+class VoicePool
+{
+public:
+    VoicePool();
+    ~VoicePool();
+
+    // OpenAL コンテキスト作成後に呼ぶ（作り直しも可）
+    //  - ハードウェアの上限で作れなかった分はあきらめる
+    void Initialize(const VoiceSettings& settings);
+    void Shutdown();
+
+    // 再生（鳴らせなかったら 0）
+    VoiceHandle Play(const VoiceParams& params);
+
+    void Stop(VoiceHandle handle);
+    void StopAll();
+
+    // 鳴っているか（仮想ボイスも含む）
+    bool IsPlaying(VoiceHandle handle) const;
+
+    // 再生中の変更
+    void SetPosition(VoiceHandle handle, const Vector3& position);
+    void SetVolume(VoiceHandle handle, float volume);
+
+    // 毎フレーム（SoundMixer::Update から）
+    //  - 終わったボイスを片付け、経過を進め、音源を割り当て直す
+    void Update(float deltaTime, const Vector3& listenerPos);
+
+    const VoiceSettings& GetSettings() const { return mSettings; }
+    const VoiceStats&    GetStats() const { return mStats; }
+
+    // 分類名（"effect" / "ambient" / "voice" / "ui"）
+    static const char* GetCategoryName(SoundCategory category);
+
+private:
+    struct Voice
+    {
+        VoiceParams params;
+        bool     inUse      = false;
+        uint16_t generation = 0;
+        int      source     = -1;      // mSources の添字（-1 は仮想）
+        float    time       = 0.0f;    // 再生位置（秒）
+        float    duration   = 0.0f;
+        float    audibility = 0.0f;    // 聞こえる大きさの見積もり
+        uint64_t order      = 0;       // 再生した順
+    };
+
+    Voice*       Find(VoiceHandle handle);
+    const Voice* Find(VoiceHandle handle) const;
+
+    // a が b より上位か
+    static bool Outranks(const Voice& a, const Voice& b);
+
+    // 聞こえる大きさ（AL_INVERSE_DISTANCE_CLAMPED と同じ式）
+    float ComputeAudibility(const VoiceParams& params) const;
+
+    // 上位から音源を割り当て直す
+    void Assign();
+
+    // 音源を渡して time の位置から鳴らす / 音源を返して仮想にする
+    void StartSource(Voice& voice);
+    void ReleaseSource(Voice& voice, bool keepTime);
+
+    void Free(Voice& voice);
+
+    VoiceSettings mSettings;
+    VoiceStats    mStats;
+
+    std::vector<ALuint> mSources;
+    std::vector<int>    mFreeSources;
+    std::vector<Voice>  mVoices;
+    std::vector<int>    mRanked;      // Assign の作業用
+    std::vector<uint8_t> mWantReal;   // Assign の作業用（音源を持たせるか、mVoices と同じ数）
+
+    Vector3  mListenerPos;
+    uint64_t mOrder;
+
+    // ハンドルの世代（プール全体で増やし続け、Initialize でも戻さない。
+    // 作り直す前のハンドルが新しいボイスに当たらないように）
+    uint16_t mNextGeneration;
+};
+
+} // namespace toy
@@ -55,6 +55,9 @@ public:
     class AssetManager*    GetAssetManager()    const { return mAssetManager.get(); }
     class SoundMixer*      GetSoundMixer()      const { return mSoundMixer.get(); }
     class TimeOfDaySystem* GetTimeOfDaySystem() const { return mTimeOfDaySys.get(); }
+    class JobSystem*       GetJobSystem()       const { return mJobSys.get(); }
+    class AnimationSystem* GetAnimationSystem() const { return mAnimationSys.get(); }
+    class ParticleSystem*  GetParticleSystem()  const { return mParticleSys.get(); }
     
 protected:
     //-----------------------------------------
@@ -113,6 +116,9 @@ private:
     std::unique_ptr<class AssetManager>    mAssetManager;
     std::unique_ptr<class SoundMixer>      mSoundMixer;
     std::unique_ptr<class TimeOfDaySystem> mTimeOfDaySys;
+    std::unique_ptr<class JobSystem>       mJobSys;
+    std::unique_ptr<class AnimationSystem> mAnimationSys;
+    std::unique_ptr<class ParticleSystem>  mParticleSys;
     
     //-----------------------------------------
     // Actor 管理
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace toy {
+
+//-------------------------------------------------------------
+// BillboardInstance
+// ・ビルボード 1 枚ぶんのインスタンスデータ
+//   （BillboardInstanced.vert の inInstance* と並びを合わせる）
+//-------------------------------------------------------------
+struct BillboardInstance
+{
+    float x, y, z;          // 中心（ワールド座標）
+    float life;             // 寿命の経過率（0〜1、シェーダでの演出用）
+    float r, g, b, a;       // 乗算色
+    float u0, v0, u1, v1;   // UV（左上→右下）
+    float width, height;    // ワールドでの大きさ
+};
+
+//-------------------------------------------------------------
+// BillboardBatch
+// ・Effect3D のパーティクル／ビルボードをインスタンス描画でまとめる
+// ・1 枚の四角形を、インスタンスバッファの位置・大きさ・色・UV で
+//   増やして描く（テクスチャ・ブレンド・描き方が同じものが続けば 1 回）
+// ・インスタンスバッファは SpriteBatch と同じくフレーム数ぶんの区画に
+//   分けたリングバッファ（GPU が読み終えた区画だけ同期なしで書く）
+// ・描き方
+//     Lit     : Phong.frag でライティング・影・フォグ（BillboardComponent）
+//     Upright : Y 軸だけ回してカメラへ向ける（立て看板・木など）
+//               false ならカメラに正対（パーティクル）
+//-------------------------------------------------------------
+class BillboardBatch
+{
+public:
+    BillboardBatch();
+    ~BillboardBatch();
+    
+    // GL コンテキスト作成後に呼ぶ
+    //  - unlitShader        : "Particle"（BillboardInstanced.vert + Particle.frag）
+    //  - litShader          : "BillboardLit"（BillboardInstanced.vert + Phong.frag）
+    //  - instancesPerFrame  : 1 フレームに入る枚数の初期値（足りなければ自動で拡張）
+    bool Initialize(std::shared_ptr<class Shader> unlitShader,
+                    std::shared_ptr<class Shader> litShader,
+                    std::shared_ptr<class LightingManager> lighting,
+                    size_t instancesPerFrame = 8192);
+    void Shutdown();
+    
+    //---------------------------------------------------------
+    // フレーム境界（Renderer::Draw から）
+    //---------------------------------------------------------
+    
+    // 次の区画へ進む（GPU がまだ使っていれば待つ）
+    //  - ライト空間行列が決まった後（シャドウパスの後）に呼ぶ
+    void BeginFrame(const Matrix4& view,
+                    const Matrix4& proj,
+                    const Matrix4& lightSpace,
+                    std::shared_ptr<class Texture> shadowMap);
+    
+    // 今の区画にフェンスを置く
+    void EndFrame();
+    
+    //---------------------------------------------------------
+    // ビルボード
+    //---------------------------------------------------------
+    
+    // 同じテクスチャ・描き方の count 枚を積む
+    //  - drawOrder が同じものは積んだ順に描く（半透明の重なりが変わらないよう
+    //    並べ替えず、続けて積まれた同じ組み合わせだけをまとめる）
+    void Add(class Texture* texture,
+             bool blendAdd,
+             bool lit,
+             bool upright,
+             int drawOrder,
+             const BillboardInstance* instances,
+             size_t count);
+    
+    // 積んだものを描く（描画順を跨ぐ別の描画の前に呼ぶ）
+    void Flush();
+    
+    // 今フレームの描画回数・枚数（デバッグ表示用）
+    size_t GetNumDrawCalls() const { return mNumDrawCalls; }
+    size_t GetNumInstances() const { return mNumInstances; }
+    
+private:
+    // 区画数（CPU が GPU より何フレーム先行できるか）
+    static constexpr int kNumSegments = 3;
+    
+    // インスタンス属性の先頭ロケーション
+    static constexpr GLuint kInstanceLocation = 3;
+    
+    // 容量を増やして作り直す（フレーム途中でも呼べる）
+    void Reallocate(size_t instancesPerFrame);
+    
+    // 描き方ごとのシェーダ設定
+    void SetupShader(class Shader& shader, bool lit);
+    
+    // Add 1 回ぶん（mInstances の [begin, begin + count)）
+    struct Run
+    {
+        class Texture* texture;
+        bool           blendAdd;
+        bool           lit;
+        bool           upright;
+        int            drawOrder;
+        size_t         begin;
+        size_t         count;
+    };
+    std::vector<Run>               mRuns;
+    std::vector<BillboardInstance> mInstances;
+    
+    std::shared_ptr<class Shader>          mUnlitShader;
+    std::shared_ptr<class Shader>          mLitShader;
+    std::shared_ptr<class LightingManager> mLighting;
+    std::shared_ptr<class Texture>         mShadowMap;
+    
+    Matrix4 mView;
+    Matrix4 mViewProj;
+    Matrix4 mLightSpace;
+    
+    GLuint mVertexArray;
+    GLuint mQuadBuffer;
+    GLuint mIndexBuffer;
+    GLuint mInstanceBuffer;
+    GLsync mFences[kNumSegments];
+    
+    size_t mSegmentInstances;  // 1 区画に入る枚数
+    int    mSegment;           // 今の区画
+    size_t mCursor;            // 区画内の書き込み位置（枚数）
+    
+    size_t mNumDrawCalls;
+    size_t mNumInstances;
+};
+
+} // namespace toy
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace toy {
+
+//-------------------------------------------------------------
+// MatrixPaletteBuffer
+// ・全スキンメッシュのボーン行列パレットを 1 本の UBO に詰めて送る
+// ・UBO はフレーム数ぶんの区画に分けたリングバッファで、
+//   GPU がまだ読んでいる区画にはフェンスで待ってから書く
+// ・1 キャラ 1 フレームにつき Upload() は 1 回だけ。シャドウパスと
+//   通常パスは同じ範囲を Bind() し直すだけで共有する
+// ・シェーダ側は
+//     layout(std140, row_major) uniform MatrixPalette { mat4 uMatrixPalette[96]; };
+//   を kBindingPoint に結びつけておく（Renderer::LoadShaders）
+//-------------------------------------------------------------
+class MatrixPaletteBuffer
+{
+public:
+    // UBO のバインディングポイント
+    static constexpr GLuint kBindingPoint = 0;
+    
+    // 1 パレットの行列数（シェーダの配列長と合わせる）
+    static constexpr size_t kMaxMatrices = 96;
+    
+    MatrixPaletteBuffer();
+    ~MatrixPaletteBuffer();
+    
+    // GL コンテキスト作成後に呼ぶ
+    //  - palettesPerFrame : 1 フレームに入るパレット数の初期値（足りなければ自動で拡張）
+    bool Initialize(size_t palettesPerFrame = 64);
+    void Shutdown();
+    
+    //---------------------------------------------------------
+    // フレーム境界（Renderer::Draw から）
+    //---------------------------------------------------------
+    
+    // 次の区画へ進む（GPU がまだ使っていれば待つ）
+    void BeginFrame();
+    
+    // 今の区画にフェンスを置く
+    void EndFrame();
+    
+    //---------------------------------------------------------
+    // パレット
+    //---------------------------------------------------------
+    
+    // 行列を書き込み、Bind() に渡すハンドルを返す
+    //  - count は kMaxMatrices で打ち切る
+    uint64_t Upload(const Matrix4* matrices, size_t count);
+    
+    // Upload() の結果が今フレームのものか
+    bool IsCurrent(uint64_t handle) const;
+    
+    // handle の範囲を kBindingPoint に結びつける
+    void Bind(uint64_t handle) const;
+    
+    // 今フレームに書き込んだパレット数（デバッグ表示用）
+    size_t GetNumUploads() const { return mNumUploads; }
+    
+private:
+    // 区画数（CPU が GPU より何フレーム先行できるか）
+    static constexpr int kNumSegments = 3;
+    
+    // 容量を増やして作り直す（フレーム途中でも呼べる）
+    void Reallocate(size_t palettesPerFrame);
+    
+    GLuint mBuffer;
+    GLsync mFences[kNumSegments];
+    
+    size_t mStride;          // 1 パレットぶん（アラインメント込み）
+    size_t mSegmentSize;     // 1 区画のバイト数
+    int    mSegment;         // 今の区画
+    size_t mCursor;          // 区画内の書き込み位置
+    size_t mNumUploads;
+    
+    // フレームごと・作り直しごとに進める（古いハンドルを無効にする）
+    uint32_t mStamp;
+};
+
+} // namespace toy
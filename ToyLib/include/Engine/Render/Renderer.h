@@ -2,6 +2,7 @@
 
 #include "Utils/MathUtil.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -106,6 +107,11 @@ public:
     void AddVisualComp(class VisualComponent* comp);
     void RemoveVisualComp(class VisualComponent* comp);
     
+    // 現在のフレーム番号（Draw() の最後で 1 進む）
+    //  - 描画されたコンポーネントにはこの番号が記録されるので、
+    //    次フレームの Update 中に「前フレームで見えていたか」が分かる
+    uint64_t GetFrameCount() const { return mFrameCount; }
+    
     
     //---------------------------------------------------------
     // デバッグ系
@@ -133,6 +139,15 @@ public:
     // 名前指定でシェーダ取得
     std::shared_ptr<class Shader> GetShader(const std::string& name) { return mShaders[name]; }
     
+    // スキニング行列パレットの共有 UBO
+    class MatrixPaletteBuffer* GetPaletteBuffer() const { return mPaletteBuffer.get(); }
+    
+    // UI / Background2D のスプライトをまとめて描くバッチ
+    class SpriteBatch* GetSpriteBatch() const { return mSpriteBatch.get(); }
+    
+    // Effect3D のパーティクル／ビルボードをまとめて描くバッチ
+    class BillboardBatch* GetBillboardBatch() const { return mBillboardBatch.get(); }
+    
     
     //---------------------------------------------------------
     // シャドウマップ／ライト空間
@@ -145,6 +160,21 @@ public:
     std::shared_ptr<class Texture> GetShadowMapTexture() const { return mShadowMapTexture; }
     
     
+    //---------------------------------------------------------
+    // LOD（メッシュ詳細度）
+    //---------------------------------------------------------
+    
+    // ワールド空間のスフィアが画面の高さに占める割合（0〜1程度）
+    float ComputeScreenSize(const Vector3& worldCenter, float worldRadius) const;
+    
+    bool  IsLodEnabled() const { return mIsLodEnabled; }
+    void  SetLodEnabled(bool b) { mIsLodEnabled = b; }
+    float GetLodHysteresis() const { return mLodHysteresis; }
+    
+    // LOD1〜3 へ切り替わる画面サイズ（x:LOD1, y:LOD2, z:LOD3）
+    const Vector3& GetLodScreenSizes() const { return mLodScreenSizes; }
+    
+    
     //---------------------------------------------------------
     // 共通ジオメトリ（スプライト / フルスクリーン）
     //---------------------------------------------------------
@@ -216,6 +246,16 @@ private:
     int   mShadowFBOHeight;
     
     
+    //---------------------------------------------------------
+    // LOD 設定
+    //---------------------------------------------------------
+    
+    bool    mIsLodEnabled;
+    float   mLodHysteresis;    // 切り替え境界の不感帯（比率）
+    float   mLodBias;          // 画面サイズに掛ける係数（小さいほど早く粗くなる）
+    Vector3 mLodScreenSizes;
+    
+    
     //---------------------------------------------------------
     // カメラ行列
     //---------------------------------------------------------
@@ -253,6 +293,15 @@ private:
     std::unordered_map<std::string, std::shared_ptr<class Shader>> mShaders;
     bool LoadShaders();
     
+    // ボーン行列パレット（フレームごとのリングバッファ UBO）
+    std::unique_ptr<class MatrixPaletteBuffer> mPaletteBuffer;
+    
+    // 2D スプライトの動的頂点バッファ（フレームごとのリングバッファ）
+    std::unique_ptr<class SpriteBatch> mSpriteBatch;
+    
+    // パーティクル／ビルボードのインスタンスバッファ（フレームごとのリングバッファ）
+    std::unique_ptr<class BillboardBatch> mBillboardBatch;
+    
     
     //---------------------------------------------------------
     // シャドウマッピング処理
@@ -286,6 +335,9 @@ private:
     // 1フレーム内で描画したオブジェクト数（Debug/Test用）
     unsigned int mCntDrawObject;
     
+    // Draw() を終えた回数（前フレームに描かれたかの判定に使う）
+    uint64_t mFrameCount;
+    
     
     //---------------------------------------------------------
     // DPI スケール
@@ -66,6 +66,10 @@ public:
     // int
     void SetIntUniform(const char* name, int value);
     
+    // uniform ブロックをバインディングポイントに結びつける（UBO 用）
+    //  - ブロックが無いシェーダでは何もしない
+    void SetUniformBlockBinding(const char* blockName, GLuint binding);
+    
     
 private:
     //---------------------------------------------------------
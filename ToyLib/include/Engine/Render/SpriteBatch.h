@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace toy {
+
+//-------------------------------------------------------------
+// SpriteBatch
+// ・UI / Background2D のスプライトを 1 本の動的頂点バッファへ集め、
+//   テクスチャとブレンドが同じものが続く並びを 1 回の描画にまとめる
+// ・頂点は CPU で画面座標まで変換済み（行列・シェーダの設定は Flush ごとに 1 回）
+// ・頂点バッファはフレーム数ぶんの区画に分けたリングバッファで、
+//   GPU がまだ読んでいる区画にはフェンスで待ってから書く
+//   （GL 4.1 には永続マップが無いので、区画を同期なしでマップする）
+// ・Renderer::DrawVisualLayer が、並んだスプライト系コンポーネントを
+//   VisualComponent::SubmitToBatch で積み、それ以外の描画の前に Flush する
+//-------------------------------------------------------------
+class SpriteBatch
+{
+public:
+    // 1 頂点（画面座標・UV・配列テクスチャの層・乗算色）
+    struct Vertex
+    {
+        float x, y;
+        float u, v;
+        float layer;
+        float r, g, b, a;
+    };
+    
+    SpriteBatch();
+    ~SpriteBatch();
+    
+    // GL コンテキスト作成後に呼ぶ
+    //  - shader            : "SpriteBatch" シェーダ
+    //  - spritesPerFrame   : 1 フレームに入るスプライト数の初期値（足りなければ自動で拡張）
+    bool Initialize(std::shared_ptr<class Shader> shader, size_t spritesPerFrame = 4096);
+    void Shutdown();
+    
+    //---------------------------------------------------------
+    // フレーム境界（Renderer::Draw から）
+    //---------------------------------------------------------
+    
+    // 次の区画へ進む（GPU がまだ使っていれば待つ）
+    void BeginFrame(const Matrix4& viewProj);
+    
+    // 今の区画にフェンスを置く
+    void EndFrame();
+    
+    //---------------------------------------------------------
+    // スプライト
+    //---------------------------------------------------------
+    
+    // 矩形を 1 枚積む（中心 center、大きさ size の画面座標、UV は左上→右下）
+    //  - drawOrder が同じものは積んだ順に描く（並べ替えはしない。重なりの前後が
+    //    変わらないように、続けて積まれた同じテクスチャ・ブレンドだけをまとめる）
+    //  - color / alpha はテクスチャ色に掛ける（文字色など）
+    //  - distanceField はテクスチャのアルファを距離場（0.5 が輪郭）として
+    //    縁を描く（SDF フォント）。色は color だけになる
+    void Add(class Texture* texture,
+             bool blendAdd,
+             int drawOrder,
+             const Vector2& center,
+             const Vector2& size,
+             float u0, float v0, float u1, float v1,
+             int layer = 0,
+             const Vector3& color = Vector3(1.0f, 1.0f, 1.0f),
+             float alpha = 1.0f,
+             bool distanceField = false);
+    
+    // 積んだものを描く（描画順を跨ぐ別の描画の前に呼ぶ）
+    void Flush();
+    
+    // 今フレームの描画回数・スプライト数（デバッグ表示用）
+    size_t GetNumDrawCalls() const { return mNumDrawCalls; }
+    size_t GetNumSprites()   const { return mNumSprites; }
+    
+private:
+    // 区画数（CPU が GPU より何フレーム先行できるか）
+    static constexpr int kNumSegments = 3;
+    
+    // 容量を増やして作り直す（フレーム途中でも呼べる）
+    void Reallocate(size_t spritesPerFrame);
+    
+    // 積んだ 1 枚
+    struct Sprite
+    {
+        class Texture* texture;
+        bool           blendAdd;
+        bool           distanceField;
+        int            drawOrder;
+        Vertex         verts[4];   // 左上・右上・右下・左下
+    };
+    std::vector<Sprite> mSprites;
+    
+    std::shared_ptr<class Shader> mShader;
+    Matrix4 mViewProj;
+    
+    GLuint mVertexArray;
+    GLuint mVertexBuffer;
+    GLuint mIndexBuffer;
+    GLsync mFences[kNumSegments];
+    
+    size_t mSegmentSprites;  // 1 区画に入るスプライト数
+    int    mSegment;         // 今の区画
+    size_t mCursor;          // 区画内の書き込み位置（スプライト数）
+    
+    size_t mNumDrawCalls;
+    size_t mNumSprites;
+};
+
+} // namespace toy
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//-------------------------------------------------------------
+// TextMesh
+// ・文字列を GlyphAtlas の矩形の並びにしたもの（1 文字 1 矩形）
+// ・Build はアトラスを引いて並べるだけで、テクスチャは作らない
+//   （新しい文字だけがアトラスへ追記される）
+// ・Submit で SpriteBatch に積むので、同じフォントの文字列は
+//   他の UI スプライトと一緒に 1 回の描画にまとまる
+// ・アトラスが拡張・詰め直しされると UV が古くなるので、
+//   IsStale を見て Build し直す
+//-------------------------------------------------------------
+class TextMesh
+{
+public:
+    // 1 文字の矩形（ピクセル、文字列の左上が原点で y は下向き）
+    struct Quad
+    {
+        float x0, y0, x1, y1;
+        float u0, v0, u1, v1;
+    };
+
+    TextMesh();
+
+    // 文字列（UTF-8、'\n' で改行）から矩形を並べる
+    void Build(class GlyphAtlas& atlas, const std::string& text);
+    void Clear();
+
+    // アトラスが作り直されて UV が古いか
+    bool IsStale(const class GlyphAtlas& atlas) const;
+
+    // SpriteBatch へ積む
+    //  - center は文字列全体の中心（画面座標、y は上向き）
+    //  - scale はピクセル → 画面座標の倍率
+    //  - distanceField は SDF フォントのアトラス（距離場シェーダで描く）
+    void Submit(class SpriteBatch& batch,
+                class Texture* texture,
+                int drawOrder,
+                const Vector2& center,
+                const Vector2& scale,
+                const Vector3& color,
+                float alpha = 1.0f,
+                bool distanceField = false) const;
+
+    // 文字列全体の大きさ（ピクセル）
+    float GetWidth()  const { return mWidth; }
+    float GetHeight() const { return mHeight; }
+
+    const std::vector<Quad>& GetQuads() const { return mQuads; }
+
+private:
+    // 1 回ぶんの並べ処理（途中でアトラスが変わったら false）
+    bool Layout(class GlyphAtlas& atlas, const std::string& text);
+
+    std::vector<Quad> mQuads;
+    float    mWidth;
+    float    mHeight;
+    uint32_t mAtlasVersion;
+};
+
+} // namespace toy
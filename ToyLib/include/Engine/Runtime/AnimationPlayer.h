@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Utils/MathUtil.h"
-#include <assimp/scene.h>
+#include "Asset/Animation/AnimationClip.h"
+#include "Asset/Animation/AnimationPose.h"
 #include <vector>
 #include <memory>
+#include <string>
 
 namespace toy {
 
@@ -16,20 +18,46 @@ namespace toy {
 //-------------------------------------------------------------
 struct BlendInfo
 {
-    const aiAnimation* fromAnim = nullptr; // ブレンド元アニメ
-    const aiAnimation* toAnim   = nullptr; // ブレンド先アニメ
-    float blendDuration = 0.3f;            // ブレンドに要する時間
-    float blendTime     = 0.0f;            // ブレンド経過時間
-    bool  isBlending    = false;           // ブレンド中かどうか
+    const struct AnimationClip* fromAnim = nullptr; // ブレンド元アニメ
+    const struct AnimationClip* toAnim   = nullptr; // ブレンド先アニメ
+    float blendDuration = 0.3f;                     // ブレンドに要する時間
+    float blendTime     = 0.0f;                     // ブレンド経過時間
+    bool  isBlending    = false;                    // ブレンド中かどうか
+};
+
+//-------------------------------------------------------------
+// BlendTreeEntry
+// ・ブレンドツリー（1 次元のブレンドスペース）の 1 要素
+// ・position にパラメータが一致したとき、そのクリップが 100%
+//   （例：速度 0 = Idle, 1.5 = Walk, 5.0 = Run）
+//-------------------------------------------------------------
+struct BlendTreeEntry
+{
+    int   animID   = 0;
+    float position = 0.0f;
+};
+
+//-------------------------------------------------------------
+// レイヤーの合成方法
+// ・Override : 下の結果をマスク範囲だけ置き換える（上半身だけ攻撃など）
+// ・Additive : クリップ先頭フレームからの差分を足す（呼吸・被弾のゆれなど）
+//-------------------------------------------------------------
+enum class AnimationLayerMode
+{
+    Override,
+    Additive
 };
 
 
 //-------------------------------------------------------------
 // AnimationPlayer
 // ・Mesh に紐づいたスケルトンアニメーションの再生制御クラス
-// ・Assimp の aiAnimation を使ってポーズ計算し、
+// ・Mesh の AnimationClip を使ってポーズ計算し、
 //   各ボーンの最終行列（mFinalMatrices）を生成する。
 // ・ループ再生／一回再生／アニメーションブレンドをサポート。
+// ・ブレンドはすべてローカル TRS で行い、階層計算は 1 回だけ
+//   （ベース：単一クリップ / クロスフェード / ブレンドツリー、
+//     その上にレイヤーを順に重ねる）
 //-------------------------------------------------------------
 class AnimationPlayer
 {
@@ -42,8 +70,26 @@ public:
     //---------------------------------------------------------
     
     // 時間を進めて現在のアニメーション（およびブレンド）を更新
+    //  - Advance() + EvaluatePose() を続けて呼ぶのと同じ
     void Update(float deltaTime);
     
+    // 再生状態（時間・ブレンド・一回再生の終了判定）だけを進め、
+    // このフレームでサンプリングするクリップと時刻を記録する
+    //  - 軽い処理なのでメインスレッドで呼ぶ
+    void Advance(float deltaTime);
+    
+    // Advance() で記録した時刻のポーズを計算して mFinalMatrices に書く
+    //  - 書き込むのはこのプレイヤーが持つバッファだけなので、
+    //    別のプレイヤーとは並列に呼んでよい（AnimationSystem から使用）
+    //  - 記録が無ければ（停止中・再生終了直後など）前回の行列を保持
+    void EvaluatePose();
+    
+    // Advance() 後、まだ EvaluatePose() していない記録があるか
+    bool HasPendingPose() const { return !mSamples.empty(); }
+    
+    // 末端から何段のノードをキー補間せずバインド姿勢にするか（遠景 LOD 用）
+    void SetSkipLeafLevels(int levels) { mSkipLeafLevels = levels; }
+    
     
     //---------------------------------------------------------
     // 再生制御
@@ -80,6 +126,40 @@ public:
     void PlayBlend(int fromAnimID, int toAnimID, float duration);
     
     
+    //---------------------------------------------------------
+    // ブレンドツリー（N 本のクリップを重み付きで合成）
+    //---------------------------------------------------------
+    
+    // entries を position 順に並べたブレンドスペースで再生
+    //  - 各クリップは正規化時間（0〜1）で同期して進む
+    void PlayBlendTree(const std::vector<BlendTreeEntry>& entries, float parameter);
+    
+    // パラメータから両隣の 2 本の重みを決める
+    void SetBlendParameter(float parameter);
+    
+    // 重みを直接指定（entries と同じ並び、合計は内部で正規化）
+    //  - 2 次元のブレンドなど、重みをゲーム側で計算する場合に使う
+    void SetBlendWeights(const std::vector<float>& weights);
+    
+    
+    //---------------------------------------------------------
+    // レイヤー（ベースの上に順に重ねる）
+    //---------------------------------------------------------
+    
+    // レイヤーを追加して番号を返す（失敗時 -1）
+    //   maskRoot : 空なら全身、ノード名を渡すとその子孫だけに効く
+    int  AddLayer(int animID,
+                  AnimationLayerMode mode,
+                  float weight = 1.0f,
+                  const std::string& maskRoot = "");
+    
+    // レイヤーの重み（0 で無効）
+    void SetLayerWeight(int layer, float weight);
+    
+    // 全レイヤーを外す（番号は振り直しになる）
+    void ClearLayers();
+    
+    
     //---------------------------------------------------------
     // 状態問い合わせ
     //---------------------------------------------------------
@@ -89,8 +169,8 @@ public:
     
     // 現在のアニメーションがループ再生か
     bool IsLooping() const { return mIsLooping; }
-    
-    
+
+
 private:
     //---------------------------------------------------------
     // 再生対象
@@ -113,16 +193,76 @@ private:
     // ブレンド情報（遷移中の補間状態など）
     BlendInfo mBlend;
     
+    // 遠景 LOD：末端から落とす段数
+    int mSkipLeafLevels;
+    
+    //---------------------------------------------------------
+    // ブレンドツリー
+    //---------------------------------------------------------
+    
+    std::vector<BlendTreeEntry> mTreeEntries;  // position 昇順
+    std::vector<float>          mTreeWeights;  // 正規化済み
+    float mTreePhase;                          // 正規化時間（0〜1）
+    bool  mIsTreeActive;
+    
+    //---------------------------------------------------------
+    // レイヤー
+    //---------------------------------------------------------
+    
+    struct AnimationLayer
+    {
+        const struct AnimationClip* clip = nullptr;
+        AnimationLayerMode mode   = AnimationLayerMode::Override;
+        float              weight = 1.0f;
+        float              time   = 0.0f;    // 秒
+        BoneMask           mask;
+        AnimationPose      reference;         // 加算の基準（クリップ先頭）
+        AnimationCursor    cursor;
+    };
+    std::vector<AnimationLayer> mLayers;
+    
+    //---------------------------------------------------------
+    // Advance() が決めた今フレームのサンプリング内容
+    //---------------------------------------------------------
+    
+    struct PoseSample
+    {
+        const struct AnimationClip* clip = nullptr;
+        float time   = 0.0f;   // Tick 単位（周期で wrap 済み）
+        float weight = 1.0f;
+        int   cursor = 0;      // ベース：mBaseCursors の番号
+        int   layer  = -1;     // -1 = ベース、0 以上 = mLayers の番号
+    };
+    std::vector<PoseSample> mSamples;
+    
+    // ベース側のキー探索位置（クロスフェードは [0]:元 [1]:先、ツリーは要素ごと）
+    std::vector<AnimationCursor> mBaseCursors;
+    
+    //---------------------------------------------------------
+    // ポーズ計算の作業領域（毎フレーム確保しないよう使い回す）
+    //---------------------------------------------------------
+    
+    AnimationPose        mPose;         // 合成先
+    AnimationPose        mScratchPose;  // 各クリップのサンプリング先
+    std::vector<Matrix4> mGlobalPose;
+    
     
     //---------------------------------------------------------
     // 内部ヘルパー
     //---------------------------------------------------------
     
-    // 2つの行列を線形補間（簡易ブレンド用）
-    Matrix4 LerpMatrix(const Matrix4& a, const Matrix4& b, float t);
+    // ベース（単一 / クロスフェード / ツリー）の時間を進めて記録
+    void AdvanceBase(float deltaTime);
+    
+    // レイヤーの時間を進めて記録
+    void AdvanceLayers(float deltaTime);
+    
+    // サンプルを記録（必要ならカーソルを確保）
+    void PushSample(const struct AnimationClip* clip, float time,
+                    float weight, int cursor, int layer);
     
-    // aiAnimation* から、対応する AnimationClip / 内部テーブルのインデックスを探す
-    int FindClipIndex(const aiAnimation* anim) const;
+    // AnimationClip* から、内部テーブルのインデックスを探す
+    int FindClipIndex(const struct AnimationClip* anim) const;
 };
 
 } // namespace toy
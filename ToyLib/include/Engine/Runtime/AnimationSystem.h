@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//-------------------------------------------------------------
+// アニメーション LOD の段階
+// ・Full    : 毎フレーム計算
+// ・Half    : 2 フレームに 1 回（間は前回の行列を使い回す）
+// ・Quarter : 4 フレームに 1 回 ＋ 末端ボーンを落とす
+// ・Culled  : 前フレームで描画されていない → 計算しない
+//   （再生時間はどの段階でも毎フレーム進む）
+//-------------------------------------------------------------
+enum class AnimationLod
+{
+    Full,
+    Half,
+    Quarter,
+    Culled
+};
+
+//-------------------------------------------------------------
+// アニメーション LOD の設定（Renderer_Settings.json の "animation_lod"）
+// ・画面サイズは MeshComponent::ComputeScreenSize() と同じ指標
+//-------------------------------------------------------------
+struct AnimationLodSettings
+{
+    bool  enabled          = true;
+    bool  cullOffscreen    = true;    // 前フレームで描かれていなければ止める
+    float halfRateSize     = 0.15f;   // これ未満で Half
+    float quarterRateSize  = 0.06f;   // これ未満で Quarter
+    int   skipLeafLevels   = 2;       // Quarter で末端から落とす段数
+};
+
+//-------------------------------------------------------------
+// 1 フレーム分の統計（デバッグ表示用）
+//-------------------------------------------------------------
+struct AnimationStats
+{
+    int   numCharacters = 0;  // 登録数
+    int   numEvaluated  = 0;  // このフレームでポーズを計算した数
+    int   numThrottled  = 0;  // Half / Quarter で今回は使い回した数
+    int   numCulled     = 0;  // 画面外で止めた数
+    int   numBones      = 0;  // 計算したボーン行列の総数
+    float evaluateMs    = 0.0f;  // ポーズ計算にかかった時間（ミリ秒、壁時計）
+};
+
+//-------------------------------------------------------------
+// AnimationSystem
+// ・SkeletalMeshComponent を集約し、毎フレームのポーズ計算を
+//   JobSystem のワーカーに振り分けてまとめて行う
+// ・各コンポーネントの Update() では再生状態を進めるだけにしておき、
+//   Actor 更新が終わったあとに Update() を 1 回呼ぶ
+// ・距離（画面サイズ）と前フレームの可視性で更新頻度を落とす
+//-------------------------------------------------------------
+class AnimationSystem
+{
+public:
+    AnimationSystem();
+    
+    //---------------------------------------------------------
+    // 登録（SkeletalMeshComponent のコンストラクタ／デストラクタから）
+    //---------------------------------------------------------
+    void AddSkeletalMesh(class SkeletalMeshComponent* comp);
+    void RemoveSkeletalMesh(class SkeletalMeshComponent* comp);
+    
+    //---------------------------------------------------------
+    // 登録済み全キャラのポーズを計算
+    //  - jobs が nullptr ならメインスレッドで順に計算
+    //---------------------------------------------------------
+    void Update(class JobSystem* jobs);
+    
+    //---------------------------------------------------------
+    // LOD 設定
+    //---------------------------------------------------------
+    
+    // JSON の "animation_lod" セクションを読む（無ければ既定値のまま）
+    bool LoadSettings(const std::string& filePath);
+    
+    const AnimationLodSettings& GetLodSettings() const { return mLodSettings; }
+    void SetLodSettings(const AnimationLodSettings& s) { mLodSettings = s; }
+    
+    //---------------------------------------------------------
+    // 統計（直前の Update 分）
+    //---------------------------------------------------------
+    const AnimationStats& GetStats() const { return mStats; }
+    
+private:
+    // 画面サイズと前フレームの可視性から LOD を決める
+    AnimationLod SelectLod(class SkeletalMeshComponent* comp) const;
+    
+    std::vector<class SkeletalMeshComponent*> mSkeletalMeshes;
+    
+    // 今フレームに計算する分（毎フレーム使い回す）
+    std::vector<class SkeletalMeshComponent*> mEvaluateList;
+    
+    AnimationLodSettings mLodSettings;
+    AnimationStats       mStats;
+    
+    // 間引きの位相に使うフレーム番号
+    uint64_t mFrame;
+};
+
+} // namespace toy
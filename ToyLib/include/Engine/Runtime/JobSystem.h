@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace toy {
+
+//-------------------------------------------------------------
+// JobSystem
+// ・起動時にワーカースレッドを立てておき、ParallelFor で
+//   インデックス範囲をチャンクに分けて並列に処理する
+// ・呼び出したスレッド自身も処理に参加し、全チャンク完了まで戻らない
+// ・ParallelFor はメインスレッドからのみ呼ぶ（入れ子呼び出し不可）
+//-------------------------------------------------------------
+class JobSystem
+{
+public:
+    // numWorkers = 0 のときは「論理コア数 - 1」（上限あり）
+    explicit JobSystem(unsigned int numWorkers = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    //---------------------------------------------------------
+    // [0, count) を grainSize 個ずつに分けて func(begin, end) を呼ぶ
+    //  - func は別スレッドから同時に呼ばれるので、
+    //    範囲ごとに独立したデータだけを書き換えること
+    //---------------------------------------------------------
+    void ParallelFor(size_t count,
+                     size_t grainSize,
+                     const std::function<void(size_t, size_t)>& func);
+
+    // 呼び出し側を含めた同時実行数
+    unsigned int GetNumThreads() const
+    {
+        return static_cast<unsigned int>(mWorkers.size()) + 1;
+    }
+
+private:
+    // ワーカーのメインループ
+    void WorkerLoop();
+
+    // チャンクを 1 つ取って処理（残りが無ければ false）
+    bool RunChunk(const std::function<void(size_t, size_t)>* func,
+                  size_t count,
+                  size_t grainSize);
+
+    std::vector<std::thread> mWorkers;
+
+    std::mutex              mMutex;
+    std::condition_variable mWakeCond;   // ジョブ投入 / 終了の通知
+    std::condition_variable mDoneCond;   // ワーカーが手を離した通知
+
+    // 現在のジョブ（mMutex で保護、mNext のみ atomic）
+    const std::function<void(size_t, size_t)>* mFunc;
+    size_t              mCount;
+    size_t              mGrainSize;
+    std::atomic<size_t> mNext;
+
+    uint64_t     mGeneration;  // ジョブを投入するたびに進める
+    unsigned int mBusy;        // ジョブを処理中のワーカー数
+    bool         mQuit;
+};
+
+} // namespace toy
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Utils/MathUtil.h"
+#include "Utils/Random.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace toy {
+
+//-------------------------------------------------------------
+// ParticlePool
+// ・エミッタ 1 つぶんの粒（SoA、[0, numAlive) が生きている粒）
+// ・ParticleSystem が所有し、ParticleComponent はポインタで持つ
+// ・挙動は effect（ParticleEffect）の定義に従う。定義が読み直されたら
+//   ParticleSystem が容量を合わせ直す
+//-------------------------------------------------------------
+struct ParticlePool
+{
+    // 粒の配列
+    std::vector<float> posX, posY, posZ;   // 位置（エミッタ基準、scale 倍前）
+    std::vector<float> velX, velY, velZ;   // 速度（毎秒）
+    std::vector<float> t;                  // 寿命の経過率（0〜1、1 を超えたら消える）
+    std::vector<float> invLife;            // 1 / 寿命（秒）
+    size_t numAlive = 0;
+    size_t capacity = 0;
+
+    // エフェクト定義（ParticleComponent が設定）
+    std::shared_ptr<const class ParticleEffect> effect;
+    uint32_t effectVersion = 0;             // 容量を合わせた定義の版
+    Vector3  spawnOffset   = Vector3::Zero; // 発生位置（エミッタ基準）
+
+    // 発生の状態
+    float    spawnAccum   = 0.0f;           // 端数の持ち越し
+    uint32_t burstPending = 0;              // 次の更新でまとめて出す数
+    Random   random;
+
+    // 描画・予算（ParticleComponent が設定）
+    class VisualComponent* owner = nullptr;
+    bool    active          = false;        // false なら更新しない（非表示など）
+    bool    sortBackToFront = false;        // 通常ブレンド → 奥から描く（定義から決まる）
+    int     priority        = 0;            // 予算超過時は小さいものから削る
+    Vector3 center          = Vector3::Zero;// 描画時のエミッタ中心（ワールド）
+    float   scale           = 1.0f;         // 粒の位置・大きさの倍率
+
+    // 描く順（sortBackToFront のとき、奥→手前の添字）
+    std::vector<uint32_t> drawOrder;
+    std::vector<float>    sortKeys;         // 並べ替え用の奥行き（使い回す）
+
+    void Resize(size_t n);
+
+    // index の粒を消す（末尾の粒を移して詰める）
+    void Kill(size_t index);
+
+    // effect の定義で 1 粒出す（満杯なら何もしない）
+    void Spawn();
+};
+
+//-------------------------------------------------------------
+// パーティクルの設定（Renderer_Settings.json の "particles"）
+//-------------------------------------------------------------
+struct ParticleSettings
+{
+    int  maxLiveParticles = 200000;   // 全エミッタ合計の上限
+    bool cullOffscreen    = true;     // 超過時、前フレームで描かれていないものから消す
+};
+
+//-------------------------------------------------------------
+// 1 フレーム分の統計（デバッグ表示用）
+//-------------------------------------------------------------
+struct ParticleStats
+{
+    int   numEmitters    = 0;   // 登録数
+    int   numSimulated   = 0;   // 更新したエミッタ数
+    int   numCulled      = 0;   // 予算超過で粒を消したエミッタ数
+    int   numThrottled   = 0;   // 予算超過で発生を止めたエミッタ数
+    int   numAlive       = 0;   // 生きている粒の総数
+    int   numSorted      = 0;   // 奥から並べ替えた粒の数
+    float simulateMs     = 0.0f;   // 更新にかかった時間（ミリ秒、壁時計）
+};
+
+//-------------------------------------------------------------
+// ParticleSystem
+// ・全エミッタの粒を集中して持ち、Actor 更新の後に 1 回まとめて進める
+// ・更新はエフェクト定義のモジュール列（重力・減衰）→ 積分の順に
+//   SIMD で掛け、大きなエミッタも分割して JobSystem のワーカーへ振り分け、
+//   寿命切れの詰め直し・発生・並べ替えはエミッタ単位で並列に行う
+// ・通常ブレンドのエミッタは、カメラから奥→手前の描く順を毎フレーム作る
+// ・全体の粒数が上限を超えたら、画面外で優先度の低いエミッタから
+//   粒を消し、それでも足りなければ優先度の低い順に発生を止める
+//-------------------------------------------------------------
+class ParticleSystem
+{
+public:
+    ParticleSystem();
+    ~ParticleSystem();
+
+    //---------------------------------------------------------
+    // プール（ParticleComponent のコンストラクタ／デストラクタから）
+    //---------------------------------------------------------
+    ParticlePool* CreatePool(class VisualComponent* owner);
+    void DestroyPool(ParticlePool* pool);
+
+    //---------------------------------------------------------
+    // 全エミッタを deltaTime 進める
+    //  - invView は並べ替えに使うカメラ（前フレームの値でよい）
+    //  - jobs が nullptr ならメインスレッドで順に処理
+    //---------------------------------------------------------
+    void Update(float deltaTime, class JobSystem* jobs, const Matrix4& invView);
+
+    //---------------------------------------------------------
+    // 設定
+    //---------------------------------------------------------
+
+    // JSON の "particles" セクションを読む（無ければ既定値のまま）
+    bool LoadSettings(const std::string& filePath);
+
+    const ParticleSettings& GetSettings() const { return mSettings; }
+    void SetSettings(const ParticleSettings& s) { mSettings = s; }
+
+    //---------------------------------------------------------
+    // 統計（直前の Update 分）
+    //---------------------------------------------------------
+    const ParticleStats& GetStats() const { return mStats; }
+
+private:
+    // 粒数の上限に合わせて、消す・発生を止めるエミッタを決める
+    void ApplyBudget();
+
+    // 寿命切れの詰め直し・発生・並べ替え（エミッタ 1 つぶん）
+    void FinishPool(size_t index);
+
+    // 積分の 1 単位（大きなエミッタは複数に分ける）
+    struct Chunk
+    {
+        ParticlePool* pool;
+        size_t        begin;
+        size_t        end;
+        size_t        firstDead;   // 寿命を超えた最初の粒（無ければ end）
+    };
+
+    // 今フレームのエミッタごとの作業
+    struct Work
+    {
+        ParticlePool* pool;
+        size_t        chunkBegin;  // mChunks の範囲
+        size_t        chunkEnd;
+        uint32_t      spawnCount;  // 今フレームに出す数（予算で決める）
+    };
+
+    std::vector<std::unique_ptr<ParticlePool>> mPools;
+    std::vector<Chunk> mChunks;
+    std::vector<Work>  mWork;
+
+    ParticleSettings mSettings;
+    ParticleStats    mStats;
+
+    float   mDeltaTime;
+    Vector3 mCameraPos;
+    Vector3 mCameraForward;
+};
+
+} // namespace toy
@@ -1,6 +1,9 @@
 // ParticleComponent.h
 #pragma once
 #include "Graphics/VisualComponent.h"
+#include "Engine/Render/BillboardBatch.h"
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace toy {
@@ -10,6 +13,10 @@ namespace toy {
 // - Sprite（テクスチャ）を複数生成してパーティクル風に描画する
 // - 加算／通常ブレンドの切り替え
 // - 雨・火花・煙などの簡易表現に利用
+// - 粒は ParticleSystem のプール（SoA）にあり、全エミッタまとめて
+//   並列に更新される（このコンポーネントは設定と描画だけ）
+// - 挙動は ParticleEffect（JSON の定義）に従う。CreateParticles の
+//   モード指定は、それに相当する組み込みの定義を作る
 //======================================================================
 class ParticleComponent : public VisualComponent
 {
@@ -24,18 +31,6 @@ public:
         P_SMOKE    // 煙系：上昇しながらフェード
     };
     
-    // -------------------------------------------
-    // 1パーティクルのデータ
-    // -------------------------------------------
-    struct Particle
-    {
-        Vector3 pos;      // 位置
-        Vector3 dir;      // 移動方向（正規化推奨）
-        float lifeTime;   // 残り寿命（秒）
-        float size;       // サイズ（スケール）
-        bool  isVisible;  // 描画するか
-    };
-    
     //==================================================================
     // コンストラクタ / デストラクタ
     //==================================================================
@@ -43,20 +38,30 @@ public:
     ~ParticleComponent();
     
     //==================================================================
-    // 更新処理（位置更新・寿命処理など）
+    // 更新処理（寿命処理・エミッタ位置の受け渡し）
     //==================================================================
     void Update(float deltaTime) override;
     
     //==================================================================
-    // 描画（VisualComponent → フルビルボード描画）
+    // 描画（BillboardBatch のインスタンス描画）
     //==================================================================
     void Draw() override;
+    bool SubmitBillboards(class BillboardBatch& batch) override;
     
     //==================================================================
     // テクスチャ設定（VisualComponent のオーバーライド）
     //==================================================================
     void SetTexture(std::shared_ptr<class Texture> tex) override;
     
+    //==================================================================
+    // エフェクト定義を使う（AssetManager::GetParticleEffect で取得）
+    // life : コンポーネント自体の生存時間（0で無限）
+    // - 定義がホットリロードされると次の更新から新しい定義で出し直す
+    // - 位置・大きさはワールド単位（Actor のスケールが掛かる）
+    //==================================================================
+    void SetEffect(std::shared_ptr<class ParticleEffect> effect, float life = 0.0f);
+    std::shared_ptr<class ParticleEffect> GetEffect() const { return mEffect; }
+    
     //==================================================================
     // パーティクル生成
     // pos        : 発生位置
@@ -76,30 +81,38 @@ public:
     );
     
     //==================================================================
-    // ブレンド設定
+    // ブレンド設定（CreateParticles の組み込み定義のみ）
     // true  → 加算合成（発光系）
     // false → 透過ブレンド（煙・水）
     //==================================================================
-    void SetAddBlend(bool b) { mIsBlendAdd = b; }
+    void SetAddBlend(bool b);
     
-    // パーティクル速度係数
-    void SetSpeed(float speed) { mPartSpeed = speed; }
+    // パーティクル速度係数（CreateParticles の組み込み定義のみ）
+    void SetSpeed(float speed);
+    
+    // 粒数の予算を超えたときの優先度（小さいものから削られる）
+    void SetPriority(int priority);
     
     // 描画順序
     int GetDrawOrder() const { return mDrawOrder; }
     
+    // 今生きている粒の数
+    size_t GetNumAlive() const;
+    
 private:
     //==================================================================
-    // 生成されたパーティクルの初期化（内部用）
+    // CreateParticles の設定から組み込みの定義を作り直す
     //==================================================================
-    void GenerateParts();
+    void BuildLegacyEffect();
     
     //==================================================================
     // メンバ変数
     //==================================================================
-    std::shared_ptr<class Texture> mTexture;   // パーティクル用テクスチャ
-    Vector3 mPosition;                         // 発生位置
-    std::vector<Particle> mParts;              // 生成済みパーティクル一覧
+    std::shared_ptr<class Texture> mTexture;   // パーティクル用テクスチャ（定義に無い場合）
+    std::shared_ptr<class ParticleEffect> mEffect; // エフェクト定義
+    bool mLegacyEffect;                        // mEffect が組み込みの定義か
+    struct ParticlePool* mPool;                // 粒（ParticleSystem が所有）
+    std::vector<BillboardInstance> mInstances; // バッチへ渡す作業用
     
     int mDrawOrder;                            // 描画順
     unsigned int mNumParts;                    // 初期生成数
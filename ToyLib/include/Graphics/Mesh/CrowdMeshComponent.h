@@ -0,0 +1,101 @@
+#pragma once
+#include "Graphics/Mesh/MeshComponent.h"
+#include "Utils/MathUtil.h"
+#include <vector>
+#include <memory>
+
+namespace toy {
+
+//------------------------------------------------------------
+// CrowdMeshComponent
+//  - 同じスキンメッシュを大量に並べる群衆用の描画コンポーネント
+//  - ボーン行列は BakedAnimation の焼き込みテクスチャから
+//    頂点シェーダが直接読むので、CPU 側の階層計算は一切しない
+//  - 全インスタンスをサブメッシュごとに 1 回の
+//    glDrawElementsInstanced で描く
+//  - インスタンスの位置はオーナー Actor のローカル空間
+//------------------------------------------------------------
+class CrowdMeshComponent : public MeshComponent
+{
+public:
+    CrowdMeshComponent(class Actor* a,
+                       int drawOrder = 100,
+                       VisualLayer layer = VisualLayer::Object3D);
+    ~CrowdMeshComponent();
+    
+    //--------------------------------------------------------
+    // 描画
+    //--------------------------------------------------------
+    void Draw() override;
+    void DrawShadow() override;
+    
+    //--------------------------------------------------------
+    // Update
+    //  - 再生時間を 1 本進めるだけ（インスタンス数に依存しない）
+    //--------------------------------------------------------
+    void Update(float deltaTime) override;
+    
+    //--------------------------------------------------------
+    // SetMesh
+    //  - 焼き込み済みアニメーションも一緒に渡す
+    //    （同じ Mesh の群衆どうしで共有してよい）
+    //  - クリップ番号は baked のものなので、インスタンス追加より先に呼ぶ
+    //--------------------------------------------------------
+    using MeshComponent::SetMesh;
+    void SetMesh(std::shared_ptr<class Mesh> mesh,
+                 std::shared_ptr<class BakedAnimation> baked);
+    
+    //--------------------------------------------------------
+    // インスタンス
+    //--------------------------------------------------------
+    
+    // 追加して番号を返す
+    //   clip      : BakedAnimation のクリップ番号
+    //   timeOffset: 再生開始位置（秒）。ずらすと足並みが揃わない
+    //   playRate  : 再生速度（1.0 が等倍）
+    int  AddInstance(const Matrix4& transform,
+                     int clip,
+                     float timeOffset = 0.0f,
+                     float playRate = 1.0f);
+    
+    void SetInstanceTransform(int index, const Matrix4& transform);
+    void SetInstanceClip(int index, int clip, float timeOffset = 0.0f, float playRate = 1.0f);
+    void ClearInstances();
+    
+    int GetNumInstances() const { return static_cast<int>(mInstances.size()); }
+    
+private:
+    //--------------------------------------------------------
+    // GPU に送るインスタンス 1 つ分（シェーダの location 5〜8）
+    //--------------------------------------------------------
+    struct InstanceData
+    {
+        float col0[4];   // ワールド行列の 0〜2 列目
+        float col1[4];
+        float col2[4];
+        float anim[4];   // 先頭行, フレーム数, フレーム/秒, 開始フレーム
+    };
+    
+    // 変更があった分をまとめて転送
+    void UploadInstances();
+    
+    // 現在の VAO にインスタンス属性を結びつける
+    void BindInstanceAttributes();
+    
+    // 焼き込みテクスチャと時間をシェーダへ
+    void ApplyCrowdUniforms(const std::shared_ptr<class Shader>& shader);
+    
+    void WriteAnim(InstanceData& inst, int clip, float timeOffset, float playRate) const;
+    
+    std::shared_ptr<class BakedAnimation> mBaked;
+    
+    std::vector<InstanceData> mInstances;
+    unsigned int mInstanceBuffer;
+    size_t       mBufferCapacity;   // 確保済みインスタンス数
+    bool         mIsDirty;
+    
+    // 群衆全体の再生時間（秒）
+    float mTime;
+};
+
+} // namespace toy
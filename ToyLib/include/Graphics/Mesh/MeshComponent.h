@@ -71,7 +71,29 @@ public:
     //--------------------------------------------------------
     virtual void SetAnimID(unsigned int animID, bool mode) {}
     
+    //--------------------------------------------------------
+    // LOD（0 が最精細）
+    //--------------------------------------------------------
+    int GetCurrentLod() const { return mCurrentLod; }
+    
+    // バウンディングスフィアの画面占有率（Renderer::ComputeScreenSize）
+    //  - メッシュ LOD とアニメーション LOD の両方で使う
+    float ComputeScreenSize() const;
+    
 protected:
+    //--------------------------------------------------------
+    // 画面サイズから LOD を決める（ヒステリシス付き）
+    //  - 通常描画 / 影描画の両方から呼ばれる
+    //--------------------------------------------------------
+    int SelectLod();
+    
+    //--------------------------------------------------------
+    // サブメッシュの頂点フォーマット（量子化の復元値）をシェーダへ
+    //--------------------------------------------------------
+    void ApplyVertexFormat(const std::shared_ptr<class Shader>& shader,
+                           const class VertexArray* va);
+    
+
     //--------------------------------------------------------
     // 保持している描画リソース
     //--------------------------------------------------------
@@ -92,6 +114,9 @@ protected:
     //--------------------------------------------------------
     bool  mIsToon;          // true なら toon + Outline
     float mContourFactor;   // 1.05f など。輪郭スケール係数
+
+    // 現在の LOD レベル
+    int mCurrentLod;
 };
 
 } // namespace toy
@@ -2,6 +2,7 @@
 #include "Engine/Runtime/AnimationPlayer.h"
 #include "Utils/MathUtil.h"
 #include "Graphics/Mesh/MeshComponent.h"
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -27,6 +28,7 @@ public:
     SkeletalMeshComponent(class Actor* a,
                           int drawOrder = 100,
                           VisualLayer layer = VisualLayer::Effect3D);
+    ~SkeletalMeshComponent();
     
     //--------------------------------------------------------
     // 描画
@@ -38,11 +40,19 @@ public:
     
     //--------------------------------------------------------
     // Update
-    //  - AnimationPlayer の再生時間を進めて
-    //    ボーン姿勢を更新
+    //  - AnimationPlayer の再生時間を進めるだけ
+    //  - ボーン姿勢の計算は AnimationSystem が全キャラ分を
+    //    まとめて並列に行う（EvaluatePose）
     //--------------------------------------------------------
     void Update(float deltaTime) override;
     
+    //--------------------------------------------------------
+    // EvaluatePose
+    //  - AnimationSystem のワーカースレッドから呼ばれる
+    //  - 自分の AnimationPlayer のバッファにだけ書き込む
+    //--------------------------------------------------------
+    void EvaluatePose();
+    
     //--------------------------------------------------------
     // SetAnimID
     //  - 再生するアニメーションの ID を指定
@@ -66,11 +76,17 @@ public:
     class AnimationPlayer* GetAnimPlayer() { return mAnimPlayer.get(); }
     
 private:
+    // ボーン行列パレットを共有 UBO に転送（フレーム初回のみ）して結びつける
+    void BindPalette();
+    
     // 現在のアニメーション再生時間（秒）
     float mAnimTime;
     
     // アニメーション再生制御クラス
     std::unique_ptr<class AnimationPlayer> mAnimPlayer;
+    
+    // 今フレームに転送したパレットの位置（MatrixPaletteBuffer::Upload の戻り値）
+    uint64_t mPaletteHandle;
 };
 
 } // namespace toy
@@ -5,6 +5,11 @@
 
 namespace toy {
 
+//----------------------------------------------------------------------
+// BillboardComponent
+//  - カメラの方へ Y 軸回転する板ポリ（BillboardBatch でライティングありで描く）
+//  - SetTextureRegion でアトラスの 1 枚を使える（配列テクスチャは不可）
+//----------------------------------------------------------------------
 class BillboardComponent : public VisualComponent
 {
 public:
@@ -12,6 +17,7 @@ public:
     ~BillboardComponent();
     
     void Draw() override;
+    bool SubmitBillboards(class BillboardBatch& batch) override;
     
 private:
     float mScale;
@@ -12,12 +12,24 @@ public:
     
     void Draw() override;
     
+    // UI / Background2D では Draw の代わりにこちらでまとめて描かれる
+    //  - Draw を独自に書き換える派生クラスは false を返すこと
+    bool SubmitToBatch(class SpriteBatch& batch) override;
+    
     void SetScale(float w, float h) { mScaleWidth = w; mScaleHeight = h; }
     void SetTexture(std::shared_ptr<class Texture> tex) override;
     
-private:
+protected:
+    // 論理解像度 → 物理解像度の倍率（アスペクト比維持）
+    float ComputeScreenScale() const;
+    
     float mScaleWidth;
     float mScaleHeight;
+    
+private:
+    // 物理解像度での中心とサイズ（論理解像度からの拡大込み）
+    void ComputeScreenRect(Vector2& center, Vector2& size) const;
+    
     int mTexWidth;
     float mTexHeight;
     int mScreenWidth;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Graphics/Sprite/SpriteComponent.h"
+#include "Engine/Render/TextMesh.h"
 #include "Utils/StringUtil.h"
 #include <string>
 #include <memory>
@@ -9,6 +10,9 @@
 namespace toy {
 
 // テキストを UI スプライトとして表示するコンポーネント
+//  - 文字はフォントの GlyphAtlas から 1 文字 1 矩形で SpriteBatch に積む
+//  - SetText / SetFont は矩形を並べ直すだけ、SetColor は頂点色だけで、
+//    文字列ごとのテクスチャは作らない（毎フレーム変わる数値表示向け）
 class TextSpriteComponent : public SpriteComponent
 {
 public:
@@ -31,21 +35,46 @@ public:
     void SetColor(const Vector3& color);
     
     // 使用するフォント（AssetManager から取得した shared_ptr をそのまま渡す）
+    //  - GetSdfFont のフォントなら SetFontSize でどの大きさにも描ける
     void SetFont(std::shared_ptr<TextFont> font);
     
-    // 今の設定を元にテクスチャだけ作り直したい場合に呼べる
+    // 表示サイズ（ポイント、0 ならフォントを読んだサイズ）
+    //  - SDF フォントは距離場で拡大・縮小し、DPI スケールもここで掛ける
+    //  - 通常のフォントも拡大・縮小はできるが、ぼける
+    //  - 変えても文字の並べ直しは起きない（アニメーション向け）
+    void SetFontSize(float pointSize) { mFontSize = pointSize; }
+    float GetFontSize() const { return mFontSize; }
+    
+    // 今の設定を元に文字の並びだけ作り直したい場合に呼べる
     void Refresh();
     
+    // SpriteBatch へ積む（UI / Background2D レイヤー）
+    bool SubmitToBatch(class SpriteBatch& batch) override;
+    
+    // 単体描画（3D レイヤーに置いた場合など）
+    void Draw() override;
+    
+    // 文字列全体の大きさ（ピクセル、SetFontSize 込み・SetScale 前）
+    Vector2 GetTextSize();
+    
     const std::string& GetText() const { return mText; }
     const Vector3& GetColor() const { return mColor; }
     std::shared_ptr<class TextFont> GetFont() const { return mFont; }
     
 private:
-    void UpdateTexture();
+    // 文字の並びを必要なら作り直す（描けなければ nullptr）
+    class GlyphAtlas* PrepareMesh();
+    
+    // アトラスのピクセル → 表示ピクセルの倍率（SetFontSize から）
+    float ComputeFontScale() const;
     
     std::string mText;
     Vector3 mColor;
     std::shared_ptr<class TextFont> mFont;   // 所有権は AssetManager と共有
+    float mFontSize;                         // 表示サイズ（0 はフォントのまま）
+    
+    TextMesh mMesh;                          // 文字の矩形の並び
+    bool     mMeshDirty;                     // 文字列・フォントが変わった
 };
 
 } // namespace toy
@@ -2,6 +2,7 @@
 
 #include "Engine/Core/Component.h"
 #include "Engine/Render/Renderer.h"
+#include "Asset/Material/TextureAtlas.h"
 
 namespace toy {
 
@@ -28,10 +29,31 @@ public:
     //  影が不要なコンポーネントはデフォルト実装（何もしない）を使う
     virtual void DrawShadow() {}
 
+    // 2D レイヤー（UI / Background2D）で SpriteBatch へ積む
+    //  積んだら true（Draw は呼ばれない）。既定は false で Draw を使う
+    virtual bool SubmitToBatch(class SpriteBatch& batch) { return false; }
+
+    // Effect3D レイヤーで BillboardBatch へ積む（インスタンス描画）
+    //  積んだら true（Draw は呼ばれない）。既定は false で Draw を使う
+    virtual bool SubmitBillboards(class BillboardBatch& batch) { return false; }
+
     // 使用テクスチャの設定／取得
-    virtual void SetTexture(std::shared_ptr<class Texture> tex) { mTexture = tex; }
+    //  - 設定するとテクスチャ全体を使う状態に戻る
+    virtual void SetTexture(std::shared_ptr<class Texture> tex) { mTexture = tex; mHasRegion = false; }
     std::shared_ptr<class Texture> GetTexture() const { return mTexture; }
     
+    // テクスチャの一部を使う（アトラスの 1 枚 / 配列テクスチャの 1 層）
+    //  - 同じアトラスを使うものはテクスチャを共有するので、まとめて描ける
+    //  - 描画サイズの基準も領域のピクセルサイズになる
+    void SetTextureRegion(std::shared_ptr<class Texture> tex, const TextureRegion& region)
+    {
+        SetTexture(tex);
+        mRegion    = region;
+        mHasRegion = true;
+    }
+    bool HasTextureRegion() const { return mHasRegion; }
+    const TextureRegion& GetTextureRegion() const { return mRegion; }
+    
     // 表示・非表示の切り替え
     void SetVisible(bool v) { mIsVisible = v; }
     bool IsVisible() const { return mIsVisible; }
@@ -55,6 +77,13 @@ public:
     // シャドウ描画を行うかどうか
     bool GetEnableShadow() const { return mEnableShadow; }
     void SetEnableShadow(const bool b) { mEnableShadow = b; }
+    
+    // 描画（本体 or 影）されたフレームを記録（Renderer から呼ぶ）
+    void MarkDrawn(uint64_t frame) { mLastDrawnFrame = frame; }
+    
+    // 直前のフレームで描画されたか（カリング結果の参照用）
+    //  - 生成直後はまだ描画されていないが、見えている扱いにする
+    bool WasDrawnLastFrame() const;
 
 protected:
     // メインテクスチャ
@@ -83,6 +112,22 @@ protected:
 
     // 描画に使う頂点配列（フルスクリーンクアッドなど）
     std::shared_ptr<class VertexArray> mVertexArray;
+
+    // 最後に描画されたフレーム番号
+    uint64_t mLastDrawnFrame;
+
+    // テクスチャの使用領域（mHasRegion が false なら全体）
+    TextureRegion mRegion;
+    bool          mHasRegion;
+
+    // テクスチャと使用領域をシェーダへ設定
+    //  - UV は uTexOffset / uTexScale（頂点シェーダで inTexCoord を写す）
+    //  - 配列テクスチャはユニット 1 の uTextureArray ＋ uLayer
+    //    （sampler2DArray を持つ Sprite シェーダのみ）
+    void BindTextureRegion(class Texture& texture);
+
+    // 描画後に全体・非配列へ戻す（同じシェーダを使う他の描画のため）
+    void UnbindTextureRegion();
 };
 
 } // namespace toy
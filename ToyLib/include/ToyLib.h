@@ -21,6 +21,9 @@
 #include "Engine/Runtime/InputSystem.h"
 #include "Engine/Runtime/AnimationPlayer.h"
 #include "Engine/Runtime/TimeOfDaySystem.h"
+#include "Engine/Runtime/JobSystem.h"
+#include "Engine/Runtime/AnimationSystem.h"
+#include "Engine/Runtime/ParticleSystem.h"
 #include "Engine/Runtime/SingleInstance.h"
 
 //======================================
@@ -28,6 +31,10 @@
 //======================================
 #include "Engine/Render/Renderer.h"
 #include "Engine/Render/Shader.h"
+#include "Engine/Render/MatrixPaletteBuffer.h"
+#include "Engine/Render/SpriteBatch.h"
+#include "Engine/Render/TextMesh.h"
+#include "Engine/Render/BillboardBatch.h"
 #include "Engine/Render/LightingManager.h"
 
 //======================================
@@ -36,26 +43,49 @@
 
 // Asset Manager
 #include "Asset/AssetManager.h"
+#include "Asset/AssetLoadQueue.h"
+
+// --- Asset Files ---
+#include "Asset/File/MappedFile.h"
+#include "Asset/File/Lz4.h"
+#include "Asset/File/AssetPack.h"
+#include "Asset/File/AssetFileSystem.h"
+#include "Asset/File/FileWatcher.h"
 
 // --- Animation Assets ---
 #include "Asset/Animation/AnimationClip.h"
+#include "Asset/Animation/Skeleton.h"
+#include "Asset/Animation/AnimationPose.h"
+#include "Asset/Animation/BakedAnimation.h"
+#include "Asset/Animation/AnimationCompression.h"
 
 // --- Audio Assets ---
 #include "Asset/Audio/Music.h"
 #include "Asset/Audio/SoundEffect.h"
 
+// --- Effect Assets ---
+#include "Asset/Effect/ParticleEffect.h"
+
 // --- Font Assets ---
 #include "Asset/Font/TextFont.h"
+#include "Asset/Font/GlyphAtlas.h"
 
 // --- Geometry Assets ---
 #include "Asset/Geometry/Bone.h"
 #include "Asset/Geometry/Mesh.h"
 #include "Asset/Geometry/VertexArray.h"
+#include "Asset/Geometry/VertexFormat.h"
 #include "Asset/Geometry/Polygon.h"
+#include "Asset/Geometry/MeshSimplifier.h"
+#include "Asset/Geometry/MeshOptimizer.h"
+#include "Asset/Geometry/MeshCache.h"
 
 // --- Material Assets ---
 #include "Asset/Material/Material.h"
 #include "Asset/Material/Texture.h"
+#include "Asset/Material/TextureCompression.h"
+#include "Asset/Material/TextureCache.h"
+#include "Asset/Material/TextureAtlas.h"
 
 //======================================
 // Camera
@@ -74,6 +104,7 @@
 // --- Mesh 系 ---
 #include "Graphics/Mesh/MeshComponent.h"
 #include "Graphics/Mesh/SkeletalMeshComponent.h"
+#include "Graphics/Mesh/CrowdMeshComponent.h"
 
 // --- Sprite / Billboard 系 ---
 #include "Graphics/Sprite/SpriteComponent.h"
@@ -118,6 +149,8 @@
 //======================================
 #include "Audio/SoundComponent.h"
 #include "Audio/SoundMixer.h"
+#include "Audio/VoicePool.h"
+#include "Audio/MusicStream.h"
 
 //======================================
 // Utils
@@ -125,5 +158,6 @@
 #include "Utils/MathUtil.h"
 #include "Utils/JsonHelper.h"
 #include "Utils/StringUtil.h"
+#include "Utils/Random.h"
 
 
@@ -56,6 +56,11 @@ namespace JsonHelper
     // 失敗時は false（ファイルオープン失敗 or パース例外など）。
     bool LoadFromFile(const std::string& path, nlohmann::json& out);
 
+    // メモリ上の JSON テキストをパースする（アセットパックから読んだものなど）
+    // name はエラー表示用。失敗時は false。
+    bool LoadFromMemory(const void* data, size_t size,
+                        const std::string& name, nlohmann::json& out);
+
     //--------------------------------------------------------------------------
     // オブジェクト型のサブ要素取得
     //--------------------------------------------------------------------------
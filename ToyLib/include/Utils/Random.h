@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+
+//==============================================================================
+// Random
+//------------------------------------------------------------------------------
+// ・軽量な擬似乱数（xoshiro128**、状態 16 バイト）
+// ・std::random_device / std::mt19937 より生成・1 回の呼び出しとも軽く、
+//   パーティクルの発生など大量に引く場所向け
+// ・暗号用途には使わないこと
+//==============================================================================
+class Random
+{
+public:
+    explicit Random(uint64_t seed = 0x9E3779B97F4A7C15ull)
+    {
+        Seed(seed);
+    }
+
+    // SplitMix64 で 64bit の種を状態へ広げる（全部 0 にはならない）
+    void Seed(uint64_t seed)
+    {
+        for (int i = 0; i < 4; i += 2)
+        {
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= (z >> 31);
+            mState[i]     = static_cast<uint32_t>(z);
+            mState[i + 1] = static_cast<uint32_t>(z >> 32);
+        }
+    }
+
+    // 32bit の一様乱数
+    uint32_t NextU32()
+    {
+        const uint32_t result = Rotl(mState[1] * 5, 7) * 9;
+        const uint32_t t = mState[1] << 9;
+
+        mState[2] ^= mState[0];
+        mState[3] ^= mState[1];
+        mState[1] ^= mState[2];
+        mState[0] ^= mState[3];
+        mState[2] ^= t;
+        mState[3] = Rotl(mState[3], 11);
+
+        return result;
+    }
+
+    // [0, 1) の float（上位 24bit を使う）
+    float NextFloat()
+    {
+        return static_cast<float>(NextU32() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // [lo, hi) の float
+    float Range(float lo, float hi)
+    {
+        return lo + (hi - lo) * NextFloat();
+    }
+
+    // [0, n) の整数（n > 0）
+    uint32_t Below(uint32_t n)
+    {
+        return static_cast<uint32_t>((static_cast<uint64_t>(NextU32()) * n) >> 32);
+    }
+
+    // 五分五分
+    bool NextBool()
+    {
+        return (NextU32() & 0x80000000u) != 0;
+    }
+
+private:
+    static uint32_t Rotl(uint32_t x, int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    uint32_t mState[4];
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <type_traits>
@@ -211,6 +212,45 @@ inline std::string PadRight(const std::string& s, size_t width, char fill = ' ')
     return s + std::string(width - s.size(), fill);
 }
 
+
+//==============================================================================
+// NextCodepoint（UTF-8 を 1 文字ずつ読む）
+//------------------------------------------------------------------------------
+// ・pos の位置から 1 文字デコードして返し、pos を次の文字へ進める
+// ・壊れたバイト列は U+FFFD にして 1 バイトだけ進める
+//==============================================================================
+
+inline uint32_t NextCodepoint(const std::string& s, size_t& pos)
+{
+    const unsigned char c = static_cast<unsigned char>(s[pos]);
+    size_t   len = 0;
+    uint32_t cp  = 0;
+
+    if      (c < 0x80)           { pos++; return c; }
+    else if ((c & 0xE0) == 0xC0) { len = 2; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { len = 3; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { len = 4; cp = c & 0x07; }
+    else                         { pos++; return 0xFFFD; }
+
+    if (pos + len > s.size())
+    {
+        pos++;
+        return 0xFFFD;
+    }
+    for (size_t i = 1; i < len; i++)
+    {
+        const unsigned char cc = static_cast<unsigned char>(s[pos + i]);
+        if ((cc & 0xC0) != 0x80)
+        {
+            pos++;
+            return 0xFFFD;
+        }
+        cp = (cp << 6) | (cc & 0x3F);
+    }
+    pos += len;
+    return cp;
+}
+
 } // namespace StringUtil
 
 
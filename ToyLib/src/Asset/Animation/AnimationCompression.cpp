@@ -0,0 +1,310 @@
+#include "Asset/Animation/AnimationCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace toy {
+namespace AnimationCompression {
+
+namespace {
+
+//==============================================================
+// 誤差の尺度
+//==============================================================
+float VectorError(const Vector3& a, const Vector3& b)
+{
+    return (a - b).Length();
+}
+
+// 2 つの回転の間の角度（ラジアン）
+float RotationError(const Quaternion& a, const Quaternion& b)
+{
+    float d = std::fabs(Quaternion::Dot(a, b));
+    return 2.0f * std::acos(std::min(d, 1.0f));
+}
+
+//==============================================================
+// キー削減
+//  - 残したキー start から end までを補間したとき、間のキーが
+//    すべて許容誤差に収まる限り end を先へ延ばす（貪欲法）
+//  - 全キーが先頭と同じとみなせるなら 1 キーにする
+//    （サンプラは 1 キーのトラックを定数として扱う）
+//==============================================================
+template <typename T, typename LerpFunc, typename ErrorFunc>
+void ReduceKeys(std::vector<float>& times,
+                std::vector<T>& values,
+                float tolerance,
+                LerpFunc lerp,
+                ErrorFunc error)
+{
+    const size_t n = times.size();
+    if (n <= 1 || values.size() != n)
+        return;
+
+    bool isConstant = true;
+    for (size_t k = 1; k < n && isConstant; k++)
+    {
+        isConstant = error(values[0], values[k]) <= tolerance;
+    }
+    if (isConstant)
+    {
+        times.resize(1);
+        values.resize(1);
+        return;
+    }
+
+    std::vector<size_t> kept;
+    kept.push_back(0);
+
+    size_t start = 0;
+    for (size_t end = start + 2; end < n; end++)
+    {
+        const float span = times[end] - times[start];
+        bool ok = span > 0.0f;
+        for (size_t k = start + 1; k < end && ok; k++)
+        {
+            float f = (times[k] - times[start]) / span;
+            ok = error(lerp(values[start], values[end], f), values[k]) <= tolerance;
+        }
+        if (!ok)
+        {
+            start = end - 1;
+            kept.push_back(start);
+        }
+    }
+    kept.push_back(n - 1);
+
+    for (size_t i = 0; i < kept.size(); i++)
+    {
+        times[i]  = times[kept[i]];
+        values[i] = values[kept[i]];
+    }
+    times.resize(kept.size());
+    values.resize(kept.size());
+}
+
+//==============================================================
+// 量子化
+//==============================================================
+uint16_t QuantizeUnit(float v, float lo, float extent, float steps)
+{
+    if (extent <= 0.0f)
+        return 0;
+    float t = std::clamp((v - lo) / extent, 0.0f, 1.0f);
+    return static_cast<uint16_t>(std::lround(t * steps));
+}
+
+void QuantizeVectors(const std::vector<Vector3>& values,
+                     std::vector<uint16_t>& packed,
+                     Vector3& outMin,
+                     Vector3& outExtent)
+{
+    Vector3 lo = values.empty() ? Vector3::Zero : values[0];
+    Vector3 hi = lo;
+    for (const auto& v : values)
+    {
+        lo.x = std::min(lo.x, v.x);  hi.x = std::max(hi.x, v.x);
+        lo.y = std::min(lo.y, v.y);  hi.y = std::max(hi.y, v.y);
+        lo.z = std::min(lo.z, v.z);  hi.z = std::max(hi.z, v.z);
+    }
+    outMin    = lo;
+    outExtent = hi - lo;
+
+    packed.resize(values.size() * 3);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        packed[i * 3 + 0] = QuantizeUnit(values[i].x, lo.x, outExtent.x, 65535.0f);
+        packed[i * 3 + 1] = QuantizeUnit(values[i].y, lo.y, outExtent.y, 65535.0f);
+        packed[i * 3 + 2] = QuantizeUnit(values[i].z, lo.z, outExtent.z, 65535.0f);
+    }
+}
+
+// smallest-three：絶対値が最大の成分を省き、残り 3 成分を 15 bit に
+void QuantizeRotations(const std::vector<Quaternion>& values,
+                       std::vector<uint16_t>& packed)
+{
+    constexpr float kRange = 0.70710678f;
+
+    packed.resize(values.size() * 3);
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        Quaternion q = Quaternion::Normalize(values[i]);
+        float c[4] = { q.x, q.y, q.z, q.w };
+
+        int largest = 0;
+        for (int k = 1; k < 4; k++)
+        {
+            if (std::fabs(c[k]) > std::fabs(c[largest]))
+                largest = k;
+        }
+
+        // q と -q は同じ回転なので、省く成分が正になる方にそろえる
+        float sign = (c[largest] < 0.0f) ? -1.0f : 1.0f;
+
+        uint16_t rest[3];
+        int n = 0;
+        for (int k = 0; k < 4; k++)
+        {
+            if (k == largest)
+                continue;
+            rest[n++] = QuantizeUnit(c[k] * sign, -kRange, 2.0f * kRange, 32767.0f);
+        }
+
+        packed[i * 3 + 0] = rest[0] | static_cast<uint16_t>((largest & 1) << 15);
+        packed[i * 3 + 1] = rest[1] | static_cast<uint16_t>(((largest >> 1) & 1) << 15);
+        packed[i * 3 + 2] = rest[2];
+    }
+}
+
+//==============================================================
+// 圧縮後トラックの評価（誤差計測用。サンプラと同じ補間）
+//==============================================================
+size_t FindSpan(const std::vector<float>& times, float t, float& factor)
+{
+    if (times.size() < 2)
+    {
+        factor = 0.0f;
+        return 0;
+    }
+    auto it = std::upper_bound(times.begin() + 1, times.end() - 1, t);
+    size_t i = static_cast<size_t>(it - times.begin()) - 1;
+    factor = std::clamp((t - times[i]) / (times[i + 1] - times[i]), 0.0f, 1.0f);
+    return i;
+}
+
+Vector3 SamplePackedVector(const std::vector<float>& times,
+                           const std::vector<uint16_t>& packed,
+                           const Vector3& min,
+                           const Vector3& extent,
+                           float t)
+{
+    float f;
+    size_t i = FindSpan(times, t, f);
+    Vector3 a = DecodeVector3(&packed[i * 3], min, extent);
+    if (times.size() < 2)
+        return a;
+    Vector3 b = DecodeVector3(&packed[(i + 1) * 3], min, extent);
+    return Vector3::Lerp(a, b, f);
+}
+
+Quaternion SamplePackedRotation(const std::vector<float>& times,
+                                const std::vector<uint16_t>& packed,
+                                float t)
+{
+    float f;
+    size_t i = FindSpan(times, t, f);
+    Quaternion a = DecodeQuaternion(&packed[i * 3]);
+    if (times.size() < 2)
+        return a;
+    Quaternion b = DecodeQuaternion(&packed[(i + 1) * 3]);
+    return Quaternion::Slerp(a, b, f);
+}
+
+} // namespace
+
+//==============================================================
+// メモリ量
+//==============================================================
+size_t ComputeMemory(const AnimationClip& clip)
+{
+    size_t bytes = 0;
+    for (const auto& ch : clip.mChannels)
+    {
+        bytes += (ch.mPositionTimes.size() + ch.mRotationTimes.size() + ch.mScalingTimes.size())
+                 * sizeof(float);
+        bytes += ch.mPositions.size() * sizeof(Vector3);
+        bytes += ch.mRotations.size() * sizeof(Quaternion);
+        bytes += ch.mScalings.size()  * sizeof(Vector3);
+        bytes += (ch.mPackedPositions.size() + ch.mPackedRotations.size() + ch.mPackedScalings.size())
+                 * sizeof(uint16_t);
+    }
+    return bytes;
+}
+
+//==============================================================
+// 圧縮
+//==============================================================
+AnimationCompressionStats Compress(AnimationClip& clip,
+                                   const AnimationCompressionSettings& settings)
+{
+    AnimationCompressionStats stats;
+    stats.rawBytes = ComputeMemory(clip);
+
+    auto lerpVec = [](const Vector3& a, const Vector3& b, float f) { return Vector3::Lerp(a, b, f); };
+    auto lerpRot = [](const Quaternion& a, const Quaternion& b, float f) { return Quaternion::Slerp(a, b, f); };
+
+    for (auto& ch : clip.mChannels)
+    {
+        const size_t rawKeys = ch.mPositionTimes.size() + ch.mRotationTimes.size() + ch.mScalingTimes.size();
+        stats.rawKeys += rawKeys;
+
+        if (ch.mIsCompressed)
+        {
+            stats.keptKeys += rawKeys;
+            continue;
+        }
+
+        // 誤差計測用に元のキーを残しておく
+        const std::vector<float>      posTimes = ch.mPositionTimes;
+        const std::vector<Vector3>    positions = ch.mPositions;
+        const std::vector<float>      rotTimes = ch.mRotationTimes;
+        const std::vector<Quaternion> rotations = ch.mRotations;
+        const std::vector<float>      sclTimes = ch.mScalingTimes;
+        const std::vector<Vector3>    scalings = ch.mScalings;
+
+        ReduceKeys(ch.mPositionTimes, ch.mPositions, settings.positionTolerance, lerpVec, VectorError);
+        ReduceKeys(ch.mRotationTimes, ch.mRotations, settings.rotationTolerance, lerpRot, RotationError);
+        ReduceKeys(ch.mScalingTimes,  ch.mScalings,  settings.scaleTolerance,    lerpVec, VectorError);
+
+        QuantizeVectors(ch.mPositions, ch.mPackedPositions, ch.mPositionMin, ch.mPositionExtent);
+        QuantizeRotations(ch.mRotations, ch.mPackedRotations);
+        QuantizeVectors(ch.mScalings, ch.mPackedScalings, ch.mScalingMin, ch.mScalingExtent);
+
+        // 値の float 配列は解放（時刻は FindKey が使うので残す）
+        std::vector<Vector3>().swap(ch.mPositions);
+        std::vector<Quaternion>().swap(ch.mRotations);
+        std::vector<Vector3>().swap(ch.mScalings);
+        ch.mPositionTimes.shrink_to_fit();
+        ch.mRotationTimes.shrink_to_fit();
+        ch.mScalingTimes.shrink_to_fit();
+        ch.mIsCompressed = true;
+
+        stats.keptKeys += ch.mPositionTimes.size() + ch.mRotationTimes.size() + ch.mScalingTimes.size();
+
+        // 元の全キー時刻で誤差を測る
+        if (!ch.mPackedPositions.empty())
+        {
+            for (size_t k = 0; k < posTimes.size(); k++)
+            {
+                Vector3 v = SamplePackedVector(ch.mPositionTimes, ch.mPackedPositions,
+                                               ch.mPositionMin, ch.mPositionExtent, posTimes[k]);
+                stats.maxPositionError = std::max(stats.maxPositionError, VectorError(v, positions[k]));
+            }
+        }
+        if (!ch.mPackedRotations.empty())
+        {
+            for (size_t k = 0; k < rotTimes.size(); k++)
+            {
+                Quaternion q = SamplePackedRotation(ch.mRotationTimes, ch.mPackedRotations, rotTimes[k]);
+                stats.maxRotationError = std::max(stats.maxRotationError,
+                                                  RotationError(q, Quaternion::Normalize(rotations[k])));
+            }
+        }
+        if (!ch.mPackedScalings.empty())
+        {
+            for (size_t k = 0; k < sclTimes.size(); k++)
+            {
+                Vector3 v = SamplePackedVector(ch.mScalingTimes, ch.mPackedScalings,
+                                               ch.mScalingMin, ch.mScalingExtent, sclTimes[k]);
+                stats.maxScaleError = std::max(stats.maxScaleError, VectorError(v, scalings[k]));
+            }
+        }
+    }
+
+    stats.compressedBytes = ComputeMemory(clip);
+    return stats;
+}
+
+} // namespace AnimationCompression
+} // namespace toy
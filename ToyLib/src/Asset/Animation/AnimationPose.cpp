@@ -0,0 +1,217 @@
+#include "Asset/Animation/AnimationPose.h"
+#include "Asset/Animation/Skeleton.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace toy {
+
+//==============================================================
+// R * T * S 行列の分解
+//  - 行ベクトル規約なので、上 3x3 は「R の各列に s_j を掛けたもの」、
+//    平行移動行は t * S になっている
+//==============================================================
+BoneTransform BoneTransform::FromMatrix(const Matrix4& m)
+{
+    BoneTransform out;
+
+    float scale[3];
+    for (int j = 0; j < 3; j++)
+    {
+        float s = std::sqrt(m.mat[0][j] * m.mat[0][j] +
+                            m.mat[1][j] * m.mat[1][j] +
+                            m.mat[2][j] * m.mat[2][j]);
+        scale[j] = (s > 1e-8f) ? s : 1.0f;
+    }
+    out.mScale = Vector3(scale[0], scale[1], scale[2]);
+
+    out.mTranslation = Vector3(m.mat[3][0] / scale[0],
+                               m.mat[3][1] / scale[1],
+                               m.mat[3][2] / scale[2]);
+
+    // 回転部分（CreateFromQuaternion の逆）
+    float r[3][3];
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            r[i][j] = m.mat[i][j] / scale[j];
+        }
+    }
+
+    Quaternion q;
+    float trace = r[0][0] + r[1][1] + r[2][2];
+    if (trace > 0.0f)
+    {
+        float s = 0.5f / std::sqrt(trace + 1.0f);
+        q.Set((r[1][2] - r[2][1]) * s,
+              (r[2][0] - r[0][2]) * s,
+              (r[0][1] - r[1][0]) * s,
+              0.25f / s);
+    }
+    else if (r[0][0] > r[1][1] && r[0][0] > r[2][2])
+    {
+        float s = 2.0f * std::sqrt(1.0f + r[0][0] - r[1][1] - r[2][2]);
+        q.Set(0.25f * s,
+              (r[1][0] + r[0][1]) / s,
+              (r[2][0] + r[0][2]) / s,
+              (r[1][2] - r[2][1]) / s);
+    }
+    else if (r[1][1] > r[2][2])
+    {
+        float s = 2.0f * std::sqrt(1.0f + r[1][1] - r[0][0] - r[2][2]);
+        q.Set((r[1][0] + r[0][1]) / s,
+              0.25f * s,
+              (r[2][1] + r[1][2]) / s,
+              (r[2][0] - r[0][2]) / s);
+    }
+    else
+    {
+        float s = 2.0f * std::sqrt(1.0f + r[2][2] - r[0][0] - r[1][1]);
+        q.Set((r[2][0] + r[0][2]) / s,
+              (r[2][1] + r[1][2]) / s,
+              0.25f * s,
+              (r[0][1] - r[1][0]) / s);
+    }
+    q.Normalize();
+    out.mRotation = q;
+
+    return out;
+}
+
+//==============================================================
+// 成分ごとの補間
+//==============================================================
+BoneTransform BoneTransform::Blend(const BoneTransform& a, const BoneTransform& b, float t)
+{
+    BoneTransform out;
+    out.mTranslation = Vector3::Lerp(a.mTranslation, b.mTranslation, t);
+    out.mRotation    = Quaternion::Slerp(a.mRotation, b.mRotation, t);
+    out.mScale       = Vector3::Lerp(a.mScale, b.mScale, t);
+    return out;
+}
+
+//==============================================================
+// サブツリーのマスク
+//  - ノードは行きがけ順なので、親が含まれていれば子も含める、
+//    を先頭から 1 回なめるだけで子孫全体が求まる
+//==============================================================
+BoneMask BoneMask::FromSubtree(const Skeleton& skeleton,
+                               const std::string& rootName,
+                               float weight)
+{
+    BoneMask mask;
+
+    const size_t numNodes = skeleton.GetNumNodes();
+    size_t root = numNodes;
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        if (skeleton.mNames[i] == rootName)
+        {
+            root = i;
+            break;
+        }
+    }
+    if (root == numNodes)
+    {
+        return mask;
+    }
+
+    mask.mWeights.assign(numNodes, 0.0f);
+    mask.mWeights[root] = weight;
+    for (size_t i = root + 1; i < numNodes; i++)
+    {
+        int parent = skeleton.mParents[i];
+        if (parent >= 0 && mask.mWeights[parent] > 0.0f)
+        {
+            mask.mWeights[i] = weight;
+        }
+    }
+    return mask;
+}
+
+namespace AnimationBlend {
+
+namespace {
+// 加算スケール：比 src / ref を weight で 1 から補間
+float ScaleDelta(float src, float ref, float weight)
+{
+    float ratio = (std::fabs(ref) > 1e-8f) ? src / ref : 1.0f;
+    return 1.0f + (ratio - 1.0f) * weight;
+}
+}
+
+//==============================================================
+// 上書きブレンド
+//==============================================================
+void Blend(AnimationPose& dst,
+           const AnimationPose& src,
+           float weight,
+           const BoneMask* mask)
+{
+    const size_t numNodes = std::min(dst.GetNumNodes(), src.GetNumNodes());
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        float w = mask ? weight * mask->GetWeight(i) : weight;
+        if (w <= 0.0f)
+        {
+            continue;
+        }
+
+        // 両方バインド姿勢のノードはそのまま（行列を分解した誤差を入れない）
+        if (!dst.mAnimated[i] && !src.mAnimated[i])
+        {
+            continue;
+        }
+
+        dst.mLocals[i]   = (w >= 1.0f) ? src.mLocals[i]
+                                       : BoneTransform::Blend(dst.mLocals[i], src.mLocals[i], w);
+        dst.mAnimated[i] = 1;
+    }
+}
+
+//==============================================================
+// 加算ブレンド
+//  - Quaternion::Concatenate(q, p) は「q のあとに p」なので
+//    差分 = Concatenate(src, reference⁻¹)、適用 = Concatenate(差分, dst)
+//==============================================================
+void Additive(AnimationPose& dst,
+              const AnimationPose& src,
+              const AnimationPose& reference,
+              float weight,
+              const BoneMask* mask)
+{
+    const size_t numNodes = std::min({ dst.GetNumNodes(),
+                                       src.GetNumNodes(),
+                                       reference.GetNumNodes() });
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        float w = mask ? weight * mask->GetWeight(i) : weight;
+        if (w <= 0.0f || !src.mAnimated[i])
+        {
+            continue;
+        }
+
+        const BoneTransform& s = src.mLocals[i];
+        const BoneTransform& r = reference.mLocals[i];
+        BoneTransform&       d = dst.mLocals[i];
+
+        d.mTranslation += (s.mTranslation - r.mTranslation) * w;
+
+        Quaternion inv = r.mRotation;
+        inv.Conjugate();
+        Quaternion delta = Quaternion::Concatenate(s.mRotation, inv);
+        delta = Quaternion::Slerp(Quaternion::Identity, delta, w);
+        d.mRotation = Quaternion::Concatenate(delta, d.mRotation);
+        d.mRotation.Normalize();
+
+        d.mScale.x *= ScaleDelta(s.mScale.x, r.mScale.x, w);
+        d.mScale.y *= ScaleDelta(s.mScale.y, r.mScale.y, w);
+        d.mScale.z *= ScaleDelta(s.mScale.z, r.mScale.z, w);
+
+        dst.mAnimated[i] = 1;
+    }
+}
+
+} // namespace AnimationBlend
+} // namespace toy
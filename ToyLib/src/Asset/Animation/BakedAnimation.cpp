@@ -0,0 +1,145 @@
+#include "Asset/Animation/BakedAnimation.h"
+#include "Asset/Geometry/Mesh.h"
+#include "Asset/Material/Texture.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+// 1 ボーンあたりのテクセル数（行列の 0〜2 列目）
+constexpr int kTexelsPerBone = 3;
+}
+
+BakedAnimation::BakedAnimation()
+: mTexture(nullptr)
+, mNumBones(0)
+, mSampleRate(0.0f)
+{
+}
+
+BakedAnimation::~BakedAnimation()
+{
+    Unload();
+}
+
+void BakedAnimation::Unload()
+{
+    if (mTexture)
+    {
+        mTexture->Unload();
+        mTexture = nullptr;
+    }
+    mClips.clear();
+    mNumBones = 0;
+}
+
+//==============================================================
+// 焼き込み
+//  - 各クリップを先頭から末尾まで等間隔にサンプリングする
+//    （間隔は 1/rate 以下に丸める）。末尾を必ず含めるので
+//    補間は端で折り返さない
+//==============================================================
+bool BakedAnimation::Bake(const Mesh& mesh, float sampleRate)
+{
+    Unload();
+
+    const auto& clips = mesh.GetAnimationClips();
+    if (clips.empty() || sampleRate <= 0.0f)
+    {
+        std::cerr << "[BakedAnimation] Mesh has no animation to bake" << std::endl;
+        return false;
+    }
+    mSampleRate = sampleRate;
+
+    // クリップごとの行数を決める
+    int numRows = 0;
+    mClips.reserve(clips.size());
+    for (const auto& clip : clips)
+    {
+        float tps      = (clip.mTicksPerSecond != 0.0f) ? clip.mTicksPerSecond : 1.0f;
+        float duration = clip.mDuration / tps;
+
+        BakedClip baked;
+        baked.mName      = clip.mName;
+        baked.mFirstRow  = numRows;
+        baked.mNumFrames = std::max(2, static_cast<int>(std::ceil(duration * sampleRate)) + 1);
+        baked.mDuration  = duration;
+        mClips.emplace_back(baked);
+
+        numRows += baked.mNumFrames;
+    }
+
+    // 1 フレーム目でボーン数を確定させる
+    std::vector<Matrix4> palette;
+    std::vector<Matrix4> globalPose;
+    mesh.ComputePoseAtTime(0.0f, clips[0], palette, globalPose);
+    mNumBones = static_cast<int>(palette.size());
+    if (mNumBones == 0)
+    {
+        std::cerr << "[BakedAnimation] Mesh has no bones" << std::endl;
+        mClips.clear();
+        return false;
+    }
+
+    const int width = mNumBones * kTexelsPerBone;
+    std::vector<float> texels(static_cast<size_t>(width) * numRows * 4);
+
+    AnimationCursor cursor;
+    for (size_t c = 0; c < clips.size(); c++)
+    {
+        const AnimationClip& clip  = clips[c];
+        const BakedClip&     baked = mClips[c];
+        float tps = (clip.mTicksPerSecond != 0.0f) ? clip.mTicksPerSecond : 1.0f;
+
+        for (int f = 0; f < baked.mNumFrames; f++)
+        {
+            float sec  = baked.mDuration * f / (baked.mNumFrames - 1);
+            float tick = std::min(sec * tps, clip.mDuration);
+            mesh.ComputePoseAtTime(tick, clip, palette, globalPose, &cursor);
+
+            float* row = &texels[static_cast<size_t>(baked.mFirstRow + f) * width * 4];
+            for (int b = 0; b < mNumBones; b++)
+            {
+                const Matrix4& m = palette[b];
+                for (int col = 0; col < kTexelsPerBone; col++)
+                {
+                    float* texel = row + (b * kTexelsPerBone + col) * 4;
+                    texel[0] = m.mat[0][col];
+                    texel[1] = m.mat[1][col];
+                    texel[2] = m.mat[2][col];
+                    texel[3] = m.mat[3][col];
+                }
+            }
+        }
+    }
+
+    mTexture = std::make_shared<Texture>();
+    if (!mTexture->CreateFloatData(texels.data(), width, numRows))
+    {
+        mTexture = nullptr;
+        mClips.clear();
+        return false;
+    }
+
+    std::cerr << "[BakedAnimation] Baked " << mClips.size() << " clips, "
+              << numRows << " frames, " << mNumBones << " bones ("
+              << (texels.size() * sizeof(float)) / 1024 << " KB)" << std::endl;
+    return true;
+}
+
+int BakedAnimation::FindClip(const std::string& name) const
+{
+    for (size_t i = 0; i < mClips.size(); i++)
+    {
+        if (mClips[i].mName == name)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+} // namespace toy
@@ -0,0 +1,199 @@
+#include "Asset/AssetLoadQueue.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace toy {
+
+//=============================================================
+// コンストラクタ／デストラクタ
+//=============================================================
+
+AssetLoadQueue::AssetLoadQueue(unsigned int numWorkers)
+: mNumDecoding(0)
+, mQuit(false)
+{
+    if (numWorkers == 0)
+    {
+        numWorkers = 2;
+    }
+
+    mWorkers.reserve(numWorkers);
+    for (unsigned int i = 0; i < numWorkers; i++)
+    {
+        mWorkers.emplace_back(&AssetLoadQueue::WorkerLoop, this);
+    }
+}
+
+AssetLoadQueue::~AssetLoadQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mQuit = true;
+        mQueued.clear();
+    }
+    mWakeCond.notify_all();
+
+    for (auto& t : mWorkers)
+    {
+        t.join();
+    }
+}
+
+//=============================================================
+// ジョブ投入
+//=============================================================
+void AssetLoadQueue::Submit(const std::shared_ptr<AssetLoadJob>& job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mQueued.push_back(job);
+    }
+    mWakeCond.notify_one();
+}
+
+//=============================================================
+// アップロード（時間予算つき）
+//=============================================================
+size_t AssetLoadQueue::ProcessUploads(float budgetMs)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+
+    size_t count = 0;
+    for (;;)
+    {
+        std::shared_ptr<AssetLoadJob> job;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mDecoded.empty())
+            {
+                break;
+            }
+            job = std::move(mDecoded.front());
+            mDecoded.pop_front();
+        }
+
+        Complete(*job);
+        count++;
+
+        std::chrono::duration<float, std::milli> elapsed = Clock::now() - start;
+        if (elapsed.count() >= budgetMs)
+        {
+            break;
+        }
+    }
+    return count;
+}
+
+//=============================================================
+// 1 件をこの場で完了
+//=============================================================
+void AssetLoadQueue::Finish(const std::shared_ptr<AssetLoadJob>& job)
+{
+    if (!job || job->state != AssetLoadState::Loading)
+        return;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    auto queued = std::find(mQueued.begin(), mQueued.end(), job);
+    if (queued != mQueued.end())
+    {
+        // ワーカーがまだ取っていないので自分でデコードする
+        mQueued.erase(queued);
+        lock.unlock();
+        job->decodeOk  = job->decode();
+        job->isDecoded = true;
+    }
+    else
+    {
+        mDecodedCond.wait(lock, [&] { return job->isDecoded; });
+        auto decoded = std::find(mDecoded.begin(), mDecoded.end(), job);
+        if (decoded != mDecoded.end())
+        {
+            mDecoded.erase(decoded);
+        }
+        lock.unlock();
+    }
+
+    Complete(*job);
+}
+
+//=============================================================
+// 全破棄
+//=============================================================
+void AssetLoadQueue::Clear()
+{
+    std::deque<std::shared_ptr<AssetLoadJob>> dropped;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        dropped.swap(mQueued);
+        mDecodedCond.wait(lock, [this] { return mNumDecoding == 0; });
+        for (auto& job : mDecoded)
+        {
+            dropped.push_back(std::move(job));
+        }
+        mDecoded.clear();
+    }
+
+    for (auto& job : dropped)
+    {
+        job->state = AssetLoadState::Failed;
+        job->decode = nullptr;
+        job->upload = nullptr;
+    }
+}
+
+size_t AssetLoadQueue::GetNumPending() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mQueued.size() + mNumDecoding + mDecoded.size();
+}
+
+//=============================================================
+// 完了処理
+//=============================================================
+void AssetLoadQueue::Complete(AssetLoadJob& job)
+{
+    bool ok = job.upload ? job.upload(job.decodeOk) : job.decodeOk;
+    job.state = ok ? AssetLoadState::Ready : AssetLoadState::Failed;
+
+    // 読み込み途中のオブジェクトを抱えたクロージャを手放す
+    job.decode = nullptr;
+    job.upload = nullptr;
+}
+
+//=============================================================
+// ワーカースレッド
+//=============================================================
+void AssetLoadQueue::WorkerLoop()
+{
+    for (;;)
+    {
+        std::shared_ptr<AssetLoadJob> job;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWakeCond.wait(lock, [this] { return mQuit || !mQueued.empty(); });
+            if (mQuit)
+            {
+                return;
+            }
+            job = std::move(mQueued.front());
+            mQueued.pop_front();
+            mNumDecoding++;
+        }
+
+        bool ok = job->decode ? job->decode() : false;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            job->decodeOk  = ok;
+            job->isDecoded = true;
+            mDecoded.push_back(std::move(job));
+            mNumDecoding--;
+        }
+        mDecodedCond.notify_all();
+    }
+}
+
+} // namespace toy
@@ -1,9 +1,15 @@
 #include "Asset/AssetManager.h"
 #include "Asset/Material/Texture.h"
+#include "Asset/Material/TextureAtlas.h"
 #include "Asset/Geometry/Mesh.h"
+#include "Asset/Animation/BakedAnimation.h"
 #include "Asset/Audio/SoundEffect.h"
 #include "Asset/Audio/Music.h"
 #include "Asset/Font/TextFont.h"
+#include "Asset/Effect/ParticleEffect.h"
+#include "Utils/JsonHelper.h"
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 
 namespace toy {
@@ -11,17 +17,41 @@ namespace toy {
 AssetManager::AssetManager()
     : mAssetsPath("ToyGame/Assets") // デフォルトのアセット基準パス
     , mWindowDisplayScale(1.0f)
+    , mSdfReferenceSize(48)
+    , mUploadBudgetMs(2.0f)
+    , mHotReload(false)
 {
+    mFileSystem.SetRoot(mAssetsPath);
+}
+
+AssetManager::~AssetManager()
+{
+    // ワーカーを先に止める（デコード中のジョブは this を使う）
+    mLoadQueue.reset();
 }
 
 void AssetManager::UnloadData()
 {
+    // 読み込み中のものは捨てる
+    if (mLoadQueue)
+    {
+        mLoadQueue->Clear();
+    }
+    mPendingTextures.clear();
+    mPendingMeshes.clear();
+
     // すべてのアセットを破棄（シーン切り替えなど）
     mTextures.clear();
+    mTextureAtlases.clear();
     mMeshes.clear();
+    mBakedAnimations.clear();
     mSoundEffects.clear();
     mMusics.clear();
     mTextFonts.clear();
+    mParticleEffects.clear();
+
+    // 監視も破棄（コールバックは上のキャッシュを指している）
+    mFileWatcher.Clear();
 }
 
 //======================================================================
@@ -34,6 +64,14 @@ std::shared_ptr<Texture> AssetManager::GetTexture(const std::string& fileName)
     auto iter = mTextures.find(fileName);
     if (iter != mTextures.end())
     {
+        // 非同期読み込み中ならここで完了させる（失敗時は登録も消える）
+        auto pending = mPendingTextures.find(fileName);
+        if (pending != mPendingTextures.end())
+        {
+            auto job = pending->second;
+            mLoadQueue->Finish(job);
+            return (job->state == AssetLoadState::Ready) ? iter->second : nullptr;
+        }
         return iter->second;      // 既存テクスチャを返す
     }
 
@@ -47,6 +85,61 @@ std::shared_ptr<Texture> AssetManager::GetTexture(const std::string& fileName)
     return nullptr;               // ロード失敗
 }
 
+//======================================================================
+// テクスチャアトラス取得
+//  - 1 枚でも読めなければ作らない
+//======================================================================
+std::shared_ptr<TextureAtlas> AssetManager::GetTextureAtlas(
+    const std::string& atlasName,
+    const std::vector<std::string>& fileNames,
+    int maxPageSize)
+{
+    auto iter = mTextureAtlases.find(atlasName);
+    if (iter != mTextureAtlases.end())
+    {
+        return iter->second;
+    }
+
+    auto atlas = std::make_shared<TextureAtlas>();
+    for (const auto& fileName : fileNames)
+    {
+        if (!atlas->AddFile(fileName, this))
+        {
+            return nullptr;
+        }
+    }
+    if (!atlas->Build(maxPageSize, 2, this))
+    {
+        return nullptr;
+    }
+
+    mTextureAtlases[atlasName] = atlas;
+    return atlas;
+}
+
+//======================================================================
+// 配列テクスチャ取得（テクスチャと同じキャッシュに arrayName で登録）
+//======================================================================
+std::shared_ptr<Texture> AssetManager::GetTextureArray(
+    const std::string& arrayName,
+    const std::vector<std::string>& fileNames)
+{
+    auto iter = mTextures.find(arrayName);
+    if (iter != mTextures.end())
+    {
+        return iter->second;
+    }
+
+    auto tex = std::make_shared<Texture>();
+    if (tex->LoadArray(fileNames, this))
+    {
+        mTextures[arrayName] = tex;
+        return tex;
+    }
+
+    return nullptr;
+}
+
 //======================================================================
 // 埋め込みテクスチャ（FBX/GLTFの aiTexture 用）
 //======================================================================
@@ -80,6 +173,13 @@ std::shared_ptr<Mesh> AssetManager::GetMesh(const std::string& fileName,
     auto iter = mMeshes.find(fileName);
     if (iter != mMeshes.end())
     {
+        auto pending = mPendingMeshes.find(fileName);
+        if (pending != mPendingMeshes.end())
+        {
+            auto job = pending->second;
+            mLoadQueue->Finish(job);
+            return (job->state == AssetLoadState::Ready) ? iter->second : nullptr;
+        }
         return iter->second;
     }
 
@@ -93,6 +193,251 @@ std::shared_ptr<Mesh> AssetManager::GetMesh(const std::string& fileName,
     return nullptr;
 }
 
+//======================================================================
+// 非同期テクスチャ読み込み
+//  - 返す Texture は登録済みで、届くまではプレースホルダを結ぶ
+//  - 失敗したら登録を消す（持っている側は白いまま）
+//======================================================================
+AssetHandle<Texture> AssetManager::LoadTextureAsync(const std::string& fileName)
+{
+    auto iter = mTextures.find(fileName);
+    if (iter != mTextures.end())
+    {
+        auto pending = mPendingTextures.find(fileName);
+        return AssetHandle<Texture>(iter->second,
+                                    pending != mPendingTextures.end() ? pending->second : nullptr);
+    }
+
+    if (!mLoadQueue)
+    {
+        mLoadQueue = std::make_unique<AssetLoadQueue>();
+    }
+
+    auto tex = std::make_shared<Texture>();
+    auto job = std::make_shared<AssetLoadJob>();
+
+    job->decode = [this, tex, fileName]()
+    {
+        return tex->Decode(fileName, this);
+    };
+    job->upload = [this, tex, fileName](bool decoded)
+    {
+        mPendingTextures.erase(fileName);
+        if (decoded && tex->Upload())
+        {
+            return true;
+        }
+        auto it = mTextures.find(fileName);
+        if (it != mTextures.end() && it->second == tex)
+        {
+            mTextures.erase(it);
+        }
+        return false;
+    };
+
+    mTextures[fileName]        = tex;
+    mPendingTextures[fileName] = job;
+    mLoadQueue->Submit(job);
+
+    return AssetHandle<Texture>(tex, job);
+}
+
+//======================================================================
+// 非同期メッシュ読み込み
+//  - ワーカーは別の Mesh に組み立て、転送後に返した Mesh へ中身を移す
+//    （読み込み中に返した Mesh を触られても競合しない）
+//  - マテリアルのテクスチャも非同期で頼む
+//======================================================================
+AssetHandle<Mesh> AssetManager::LoadMeshAsync(const std::string& fileName,
+                                              bool isRightHanded)
+{
+    auto iter = mMeshes.find(fileName);
+    if (iter != mMeshes.end())
+    {
+        auto pending = mPendingMeshes.find(fileName);
+        return AssetHandle<Mesh>(iter->second,
+                                 pending != mPendingMeshes.end() ? pending->second : nullptr);
+    }
+
+    if (!mLoadQueue)
+    {
+        mLoadQueue = std::make_unique<AssetLoadQueue>();
+    }
+
+    auto mesh    = std::make_shared<Mesh>();
+    auto staging = std::make_shared<Mesh>();
+    auto job     = std::make_shared<AssetLoadJob>();
+
+    job->decode = [this, staging, fileName, isRightHanded]()
+    {
+        return staging->Decode(fileName, this, isRightHanded);
+    };
+    job->upload = [this, mesh, staging, fileName](bool decoded)
+    {
+        mPendingMeshes.erase(fileName);
+        if (decoded)
+        {
+            staging->Upload(this, true);
+            *mesh = std::move(*staging);
+            return true;
+        }
+        auto it = mMeshes.find(fileName);
+        if (it != mMeshes.end() && it->second == mesh)
+        {
+            mMeshes.erase(it);
+        }
+        return false;
+    };
+
+    mMeshes[fileName]        = mesh;
+    mPendingMeshes[fileName] = job;
+    mLoadQueue->Submit(job);
+
+    return AssetHandle<Mesh>(mesh, job);
+}
+
+//======================================================================
+// 非同期読み込みの転送（毎フレーム）
+//======================================================================
+void AssetManager::ProcessAsyncLoads()
+{
+    if (mLoadQueue)
+    {
+        mLoadQueue->ProcessUploads(mUploadBudgetMs);
+    }
+}
+
+size_t AssetManager::GetNumPendingLoads() const
+{
+    return mLoadQueue ? mLoadQueue->GetNumPending() : 0;
+}
+
+//======================================================================
+// LoadSettings
+//   - Renderer_Settings.json の "texture" / "hot_reload" セクション
+//
+//   "texture": {
+//       "mipmaps": true,
+//       "anisotropy": 8.0,
+//       "compression": "auto",    // "none" / "auto"（BC1・BC3）/ "bc7"
+//       "cache": true
+//   },
+//   "hot_reload": {
+//       "enabled": true,
+//       "interval": 0.5           // 更新時刻を調べる間隔（秒）
+//   },
+//   "font": {
+//       "sdf_reference_size": 48  // 距離場フォントを描くサイズ（ピクセル）
+//   }
+//
+//   - 読めなかった項目は既定値のまま。どちらの場合も最後に
+//     GPU の対応（圧縮形式・最大サイズ）に合わせて落とす
+//======================================================================
+bool AssetManager::LoadSettings(const std::string& filePath)
+{
+    const bool loaded = ReadSettings(filePath);
+    Texture::ApplyDeviceLimits(mTextureSettings);
+    return loaded;
+}
+
+bool AssetManager::ReadSettings(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open settings file: "
+                  << filePath.c_str() << std::endl;
+        return false;
+    }
+
+    nlohmann::json data;
+    try
+    {
+        file >> data;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "JSON parse error: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (data.contains("texture"))
+    {
+        const auto& tex = data["texture"];
+        JsonHelper::GetBool (tex, "mipmaps",    mTextureSettings.mipmaps);
+        JsonHelper::GetFloat(tex, "anisotropy", mTextureSettings.anisotropy);
+        JsonHelper::GetBool (tex, "cache",      mTextureSettings.cache);
+
+        std::string compression;
+        if (JsonHelper::GetString(tex, "compression", compression))
+        {
+            if (compression == "auto")
+            {
+                mTextureSettings.compression = TextureCompressionMode::Auto;
+            }
+            else if (compression == "bc7")
+            {
+                mTextureSettings.compression = TextureCompressionMode::BC7;
+            }
+            else
+            {
+                mTextureSettings.compression = TextureCompressionMode::None;
+            }
+        }
+    }
+
+    if (data.contains("hot_reload"))
+    {
+        const auto& hot = data["hot_reload"];
+        JsonHelper::GetBool(hot, "enabled", mHotReload);
+
+        float interval = mFileWatcher.GetInterval();
+        if (JsonHelper::GetFloat(hot, "interval", interval))
+        {
+            mFileWatcher.SetInterval(std::max(interval, 0.0f));
+        }
+    }
+
+    if (data.contains("font"))
+    {
+        int size = mSdfReferenceSize;
+        if (JsonHelper::GetInt(data["font"], "sdf_reference_size", size))
+        {
+            mSdfReferenceSize = std::max(size, 8);
+        }
+    }
+    return true;
+}
+
+//======================================================================
+// 焼き込みアニメーション取得
+//  - 元のメッシュもキャッシュ経由で取得する
+//======================================================================
+std::shared_ptr<BakedAnimation> AssetManager::GetBakedAnimation(const std::string& fileName,
+                                                                float sampleRate)
+{
+    auto iter = mBakedAnimations.find(fileName);
+    if (iter != mBakedAnimations.end())
+    {
+        return iter->second;
+    }
+
+    auto mesh = GetMesh(fileName);
+    if (!mesh)
+    {
+        return nullptr;
+    }
+
+    auto baked = std::make_shared<BakedAnimation>();
+    if (baked->Bake(*mesh, sampleRate))
+    {
+        mBakedAnimations[fileName] = baked;
+        return baked;
+    }
+
+    return nullptr;
+}
+
 //======================================================================
 // 効果音（SoundEffect）取得
 //======================================================================
@@ -153,23 +498,116 @@ std::shared_ptr<TextFont> AssetManager::GetFont(const std::string& fileName,
         return iter->second;
     }
 
-    // 新規ロード（font->Load はフルパスを想定）
+    // DPI スケールを反映してロード
+    auto font = LoadFont(fileName, static_cast<int>(pointSize * mWindowDisplayScale));
+    if (!font)
+    {
+        return nullptr;
+    }
+
+    // 登録して返す
+    mTextFonts.emplace(key, font);
+    return font;
+}
+
+//======================================================================
+// 距離場フォント取得
+//  - DPI スケールは掛けない（表示時に拡大する）
+//======================================================================
+std::shared_ptr<TextFont> AssetManager::GetSdfFont(const std::string& fileName)
+{
+    const std::string key = fileName + "#sdf";
+
+    auto iter = mTextFonts.find(key);
+    if (iter != mTextFonts.end())
+    {
+        return iter->second;
+    }
+
+    auto font = LoadFont(fileName, mSdfReferenceSize);
+    if (!font)
+    {
+        return nullptr;
+    }
+
+    // 使えなければ通常のフォントのまま（拡大するとぼけるが表示はできる）
+    if (!font->SetSdf(true))
+    {
+        std::cerr << "[AssetManager] SDF is not available, using bitmap glyphs: "
+                  << fileName << std::endl;
+    }
+
+    mTextFonts.emplace(key, font);
+    return font;
+}
+
+//======================================================================
+// フォントを開く
+//  - font->Load はフルパスを想定。パック内ならメモリから開く
+//======================================================================
+std::shared_ptr<TextFont> AssetManager::LoadFont(const std::string& fileName, int pixelSize)
+{
     auto font = std::make_shared<TextFont>();
 
     const std::string fullPath = mAssetsPath + fileName;
 
-    // DPI スケールを反映してロード
-    if (!font->Load(fullPath, pointSize * mWindowDisplayScale))
+    bool loaded = false;
+    if (mFileSystem.IsPacked(fileName))
+    {
+        AssetData data;
+        loaded = mFileSystem.Read(fileName, data) &&
+                 font->Load(std::move(data), fullPath, pixelSize);
+    }
+    else
+    {
+        loaded = font->Load(fullPath, pixelSize);
+    }
+    if (!loaded)
     {
         std::cerr << "[AssetManager] Failed to load font: "
-                  << fullPath << " (size: " << pointSize << ")"
+                  << fullPath << " (size: " << pixelSize << ")"
                   << std::endl;
         return nullptr;
     }
-
-    // 登録して返す
-    mTextFonts.emplace(key, font);
     return font;
 }
 
+//======================================================================
+// パーティクルエフェクト定義取得
+//  - 読み直しは同じオブジェクトに対して行うので、使っている
+//    ParticleComponent はそのまま新しい定義に切り替わる
+//  - 読み直しに失敗したら（保存途中など）前の定義のまま次の確認で再試行
+//======================================================================
+std::shared_ptr<ParticleEffect> AssetManager::GetParticleEffect(const std::string& fileName)
+{
+    auto iter = mParticleEffects.find(fileName);
+    if (iter != mParticleEffects.end())
+    {
+        return iter->second;
+    }
+
+    auto effect = std::make_shared<ParticleEffect>();
+    if (!effect->Load(fileName, this))
+    {
+        std::cerr << "[AssetManager] Failed to load particle effect: "
+                  << fileName << std::endl;
+        return nullptr;
+    }
+    mParticleEffects.emplace(fileName, effect);
+
+    if (mHotReload && !mFileSystem.IsPacked(fileName))
+    {
+        // キャッシュが持っている間だけ監視する（UnloadData で両方消える）
+        ParticleEffect* target = effect.get();
+        mFileWatcher.Watch(mFileSystem.GetFullPath(fileName),
+                           [this, target, fileName]() { return target->Load(fileName, this); });
+    }
+    return effect;
+}
+
+void AssetManager::PollFileChanges()
+{
+    mFileWatcher.Poll();
+}
+
 } // namespace toy
@@ -1,6 +1,9 @@
 #include "Asset/Audio/Music.h"
 #include "Asset/AssetManager.h"
 
+#include <cstdio>
+#include <cstring>
+
 namespace toy {
 
 int Music::sRefCount = 0;
@@ -54,7 +57,16 @@ void Music::ShutdownLib()
 bool Music::Load(const std::string& fileName, AssetManager* manager)
 {
     // アセットパスの解決
-    mFilePath = manager->GetAssetsPath() + fileName;
+    const AssetFileSystem& fs = manager->GetFileSystem();
+    mFilePath = fs.GetFullPath(fileName);
+
+    // パック内ならメモリ上のデータを読ませる
+    const bool packed = fs.IsPacked(fileName);
+    if (packed && !fs.Read(fileName, mSource))
+    {
+        return false;
+    }
+    mReadPos = 0;
 
     // mpg123 ライブラリ初期化
     InitLib();
@@ -68,8 +80,13 @@ bool Music::Load(const std::string& fileName, AssetManager* manager)
     }
 
     // ファイルを開く
-    if (mpg123_open(mHandle, mFilePath.c_str()) != MPG123_OK)
+    const bool opened = packed
+        ? (mpg123_replace_reader_handle(mHandle, ReadCallback, SeekCallback, nullptr) == MPG123_OK &&
+           mpg123_open_handle(mHandle, this) == MPG123_OK)
+        : (mpg123_open(mHandle, mFilePath.c_str()) == MPG123_OK);
+    if (!opened)
     {
+        mSource.Reset();
         mpg123_delete(mHandle);
         mHandle = nullptr;
         ShutdownLib();
@@ -86,6 +103,37 @@ bool Music::Load(const std::string& fileName, AssetManager* manager)
     return true;
 }
 
+//----------------------------------------------------
+// パック内データ用の読み込み／シーク（mpg123 から呼ばれる）
+//----------------------------------------------------
+mpg123_ssize_t Music::ReadCallback(void* handle, void* buffer, size_t size)
+{
+    Music* music = static_cast<Music*>(handle);
+    const size_t remain = music->mSource.GetSize() - music->mReadPos;
+    const size_t n = (size < remain) ? size : remain;
+
+    std::memcpy(buffer, music->mSource.GetData() + music->mReadPos, n);
+    music->mReadPos += n;
+    return static_cast<mpg123_ssize_t>(n);
+}
+
+off_t Music::SeekCallback(void* handle, off_t offset, int whence)
+{
+    Music* music = static_cast<Music*>(handle);
+    const off_t size = static_cast<off_t>(music->mSource.GetSize());
+
+    off_t pos = offset;
+    if (whence == SEEK_CUR) pos += static_cast<off_t>(music->mReadPos);
+    if (whence == SEEK_END) pos += size;
+    if (pos < 0 || pos > size)
+    {
+        return -1;
+    }
+
+    music->mReadPos = static_cast<size_t>(pos);
+    return pos;
+}
+
 //----------------------------------------------------
 // 再生位置のリセット
 //----------------------------------------------------
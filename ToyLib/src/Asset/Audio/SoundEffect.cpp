@@ -1,7 +1,6 @@
 #include "Asset/Audio/SoundEffect.h"
 #include "Asset/AssetManager.h"
 
-#include <cstdio>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
@@ -24,15 +23,25 @@ SoundEffect::~SoundEffect()
 
 bool SoundEffect::Load(const std::string& fileName, AssetManager* manager)
 {
-    const std::string fullPath = manager->GetAssetsPath() + fileName;
+    const AssetFileSystem& fs = manager->GetFileSystem();
+    const std::string fullPath = fs.GetFullPath(fileName);
     mFilePath = fullPath;
 
-    std::vector<char> data;
+    // ファイル全体を 1 回で取得（パック内ならコピーなし）
+    AssetData file;
+    if (!fs.Read(fileName, file))
+    {
+        std::cerr << "[SoundEffect] Failed to open: " << fullPath.c_str() << std::endl;
+        return false;
+    }
+
+    const char* data  = nullptr;
+    size_t      size  = 0;
     ALenum  format = 0;
     ALsizei freq   = 0;
 
     // 16bit PCM の WAV を読み込む（モノラル／ステレオのみ対応）
-    if (!LoadWav16(fullPath, data, format, freq))
+    if (!LoadWav16(file.GetData(), file.GetSize(), data, size, format, freq))
     {
         std::cerr << "[SoundEffect] Failed to load wav: " << fullPath.c_str() << std::endl;
         return false;
@@ -48,12 +57,12 @@ bool SoundEffect::Load(const std::string& fileName, AssetManager* manager)
         return false;
     }
 
-    // PCM データを OpenAL バッファに転送
+    // PCM データを OpenAL バッファに転送（OpenAL 側でコピーされる）
     alBufferData(
         mBuffer,
         format,
-        data.data(),
-        static_cast<ALsizei>(data.size()),
+        data,
+        static_cast<ALsizei>(size),
         freq
     );
 
@@ -67,6 +76,12 @@ bool SoundEffect::Load(const std::string& fileName, AssetManager* manager)
         return false;
     }
 
+    // 16bit なので 1 サンプル = チャンネル数 × 2 バイト
+    const size_t channels = (format == AL_FORMAT_STEREO16) ? 2 : 1;
+    mDuration = (freq > 0)
+        ? static_cast<float>(size / (channels * 2)) / static_cast<float>(freq)
+        : 0.0f;
+
     return true;
 }
 
@@ -86,31 +101,25 @@ struct ChunkHeader
     uint32_t size;       // チャンクのデータサイズ
 };
 
-bool SoundEffect::LoadWav16(const std::string& fullPath,
-                            std::vector<char>& outData,
+bool SoundEffect::LoadWav16(const uint8_t* file,
+                            size_t fileSize,
+                            const char*& outData,
+                            size_t& outSize,
                             ALenum& outFormat,
                             ALsizei& outFreq)
 {
-    FILE* fp = std::fopen(fullPath.c_str(), "rb");
-    if (!fp)
-    {
-        std::cerr << "[SoundEffect] fopen failed: " << fullPath.c_str() << std::endl;
-        return false;
-    }
-
     // RIFF/WAVE ヘッダ読み込み
     RiffHeader riff{};
-    if (std::fread(&riff, sizeof(RiffHeader), 1, fp) != 1)
+    if (fileSize < sizeof(RiffHeader))
     {
-        std::fclose(fp);
         return false;
     }
+    std::memcpy(&riff, file, sizeof(RiffHeader));
 
     if (std::strncmp(riff.id, "RIFF", 4) != 0 ||
         std::strncmp(riff.wave, "WAVE", 4) != 0)
     {
-        std::cerr << "[SoundEffect] Not a RIFF/WAVE file: " << fullPath.c_str() << std::endl;
-        std::fclose(fp);
+        std::cerr << "[SoundEffect] Not a RIFF/WAVE file: " << mFilePath.c_str() << std::endl;
         return false;
     }
 
@@ -122,15 +131,18 @@ bool SoundEffect::LoadWav16(const std::string& fullPath,
     uint32_t sampleRate    = 0;
     uint16_t bitsPerSample = 0;
 
-    std::vector<char> dataChunk;
-
     // fmt チャンク／data チャンクを順に走査
-    while (!foundData)
+    size_t pos = sizeof(RiffHeader);
+    while (!foundData && fileSize - pos >= sizeof(ChunkHeader))
     {
         ChunkHeader ch{};
-        if (std::fread(&ch, sizeof(ChunkHeader), 1, fp) != 1)
+        std::memcpy(&ch, file + pos, sizeof(ChunkHeader));
+        pos += sizeof(ChunkHeader);
+
+        if (ch.size > fileSize - pos)
         {
-            break; // EOF またはエラー
+            std::cerr << "[SoundEffect] Truncated chunk: " << mFilePath.c_str() << std::endl;
+            return false;
         }
 
         if (std::strncmp(ch.id, "fmt ", 4) == 0)
@@ -149,18 +161,7 @@ bool SoundEffect::LoadWav16(const std::string& fullPath,
             const size_t toRead = (ch.size < sizeof(FmtChunkBase))
                 ? ch.size
                 : sizeof(FmtChunkBase);
-
-            if (std::fread(&fmt, toRead, 1, fp) != 1)
-            {
-                std::fclose(fp);
-                return false;
-            }
-
-            // 余りがあればスキップ
-            if (ch.size > toRead)
-            {
-                std::fseek(fp, ch.size - toRead, SEEK_CUR);
-            }
+            std::memcpy(&fmt, file + pos, toRead);
 
             audioFormat   = fmt.audioFormat;
             numChannels   = fmt.numChannels;
@@ -171,40 +172,28 @@ bool SoundEffect::LoadWav16(const std::string& fullPath,
         }
         else if (std::strncmp(ch.id, "data", 4) == 0)
         {
-            // --- data チャンク（サンプル本体） ---
+            // --- data チャンク（サンプル本体、コピーせず位置だけ覚える） ---
             if (!foundFmt)
             {
                 std::cerr << "[SoundEffect] data chunk before fmt chunk: "
-                          << fullPath.c_str() << std::endl;
-                std::fclose(fp);
+                          << mFilePath.c_str() << std::endl;
                 return false;
             }
 
-            dataChunk.resize(ch.size);
-            if (ch.size > 0)
-            {
-                if (std::fread(dataChunk.data(), ch.size, 1, fp) != 1)
-                {
-                    std::fclose(fp);
-                    return false;
-                }
-            }
-
+            outData = reinterpret_cast<const char*>(file + pos);
+            outSize = ch.size;
             foundData = true;
         }
-        else
-        {
-            // それ以外のチャンクはまとめてスキップ
-            std::fseek(fp, ch.size, SEEK_CUR);
-        }
-    }
 
-    std::fclose(fp);
+        // チャンクは 2 byte 境界に詰められる
+        pos += ch.size + (ch.size & 1);
+        if (pos > fileSize) pos = fileSize;
+    }
 
     if (!foundFmt || !foundData)
     {
         std::cerr << "[SoundEffect] Missing fmt or data chunk: "
-                  << fullPath.c_str() << std::endl;
+                  << mFilePath.c_str() << std::endl;
         return false;
     }
 
@@ -212,7 +201,7 @@ bool SoundEffect::LoadWav16(const std::string& fullPath,
     if (audioFormat != 1)
     {
         std::cerr << "[SoundEffect] Non-PCM format not supported: "
-                  << fullPath.c_str() << std::endl;
+                  << mFilePath.c_str() << std::endl;
         return false;
     }
 
@@ -220,7 +209,7 @@ bool SoundEffect::LoadWav16(const std::string& fullPath,
     if (bitsPerSample != 8 && bitsPerSample != 16)
     {
         std::cerr << "[SoundEffect] Only 8/16bit supported: "
-                  << fullPath.c_str() << " (" << bitsPerSample << " bits)" << std::endl;
+                  << mFilePath.c_str() << " (" << bitsPerSample << " bits)" << std::endl;
         return false;
     }
 
@@ -228,12 +217,11 @@ bool SoundEffect::LoadWav16(const std::string& fullPath,
     if (numChannels < 1 || numChannels > 2)
     {
         std::cerr << "[SoundEffect] Only mono/stereo supported: "
-                  << fullPath.c_str() << " (ch=" << numChannels << ")" << std::endl;
+                  << mFilePath.c_str() << " (ch=" << numChannels << ")" << std::endl;
         return false;
     }
 
     outFreq = static_cast<ALsizei>(sampleRate);
-    outData = std::move(dataChunk);
 
     // OpenAL のフォーマットに変換
     if (numChannels == 1 && bitsPerSample == 8)   outFormat = AL_FORMAT_MONO8;
@@ -0,0 +1,279 @@
+#include "Asset/Effect/ParticleEffect.h"
+#include "Asset/AssetManager.h"
+#include "Asset/Material/Texture.h"
+#include "Utils/JsonHelper.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+
+//==============================================================
+// 数値 1 つ、または [min, max]
+//  - それ以外（文字列・要素数違いなど）は読まずに既定値のまま
+//    （編集途中のファイルをリロードしても落ちないように）
+//==============================================================
+bool GetRange(const nlohmann::json& obj, const char* key, float& outMin, float& outMax)
+{
+    float value = 0.0f;
+    if (JsonHelper::GetFloat(obj, key, value))
+    {
+        outMin = value;
+        outMax = value;
+        return true;
+    }
+
+    if (!obj.contains(key))
+        return false;
+
+    const auto& range = obj[key];
+    if (!range.is_array() || range.size() != 2 ||
+        !range[0].is_number() || !range[1].is_number())
+    {
+        std::cerr << "[ParticleEffect] \"" << key
+                  << "\" must be a number or [min, max]" << std::endl;
+        return false;
+    }
+
+    outMin = range[0].get<float>();
+    outMax = range[1].get<float>();
+    return true;
+}
+
+//==============================================================
+// [[t, v...], ...] のキー列（要素数が足りないキーは飛ばす）
+//==============================================================
+bool GetKeys(const nlohmann::json& obj, const char* key, size_t numValues,
+             std::vector<std::vector<float>>& out)
+{
+    if (!obj.contains(key) || !obj[key].is_array())
+        return false;
+
+    out.clear();
+    for (const auto& k : obj[key])
+    {
+        if (!k.is_array() || k.size() < numValues + 1)
+            continue;
+
+        std::vector<float> values;
+        for (size_t i = 0; i < numValues + 1; i++)
+        {
+            values.push_back(k[i].is_number() ? k[i].get<float>() : 0.0f);
+        }
+        out.push_back(std::move(values));
+    }
+    return !out.empty();
+}
+
+//==============================================================
+// JSON → 定義（無い項目は既定値のまま）
+//==============================================================
+void ParseDesc(const nlohmann::json& data, ParticleEffectDesc& desc)
+{
+    JsonHelper::GetString(data, "texture", desc.texture);
+
+    std::string blend;
+    if (JsonHelper::GetString(data, "blend", blend))
+    {
+        desc.blendAdd = (blend != "alpha");
+    }
+
+    int maxParticles = static_cast<int>(desc.maxParticles);
+    if (JsonHelper::GetInt(data, "max_particles", maxParticles))
+    {
+        desc.maxParticles = static_cast<uint32_t>(std::max(0, maxParticles));
+    }
+    int burst = static_cast<int>(desc.burst);
+    if (JsonHelper::GetInt(data, "burst", burst))
+    {
+        desc.burst = static_cast<uint32_t>(std::max(0, burst));
+    }
+    JsonHelper::GetFloat(data, "spawn_rate",   desc.spawnRate);
+    JsonHelper::GetFloat(data, "spawn_radius", desc.spawnRadius);
+    GetRange(data, "lifetime", desc.lifeMin, desc.lifeMax);
+
+    nlohmann::json velocity;
+    if (JsonHelper::GetObject(data, "velocity", velocity))
+    {
+        JsonHelper::GetVector3(velocity, "direction",  desc.direction);
+        JsonHelper::GetFloat  (velocity, "cone_angle", desc.coneAngle);
+        GetRange              (velocity, "speed",      desc.speedMin, desc.speedMax);
+        JsonHelper::GetVector3(velocity, "random",     desc.velocityRandom);
+    }
+
+    JsonHelper::GetVector3(data, "gravity", desc.gravity);
+    JsonHelper::GetFloat  (data, "drag",    desc.drag);
+
+    std::vector<std::vector<float>> keys;
+    if (GetKeys(data, "size_over_life", 1, keys))
+    {
+        desc.sizeOverLife.clear();
+        for (const auto& k : keys)
+        {
+            desc.sizeOverLife.push_back({ k[0], k[1] });
+        }
+    }
+    if (GetKeys(data, "color_over_life", 4, keys))
+    {
+        desc.colorOverLife.clear();
+        for (const auto& k : keys)
+        {
+            desc.colorOverLife.push_back({ k[0], k[1], k[2], k[3], k[4] });
+        }
+    }
+}
+
+//==============================================================
+// キー列を t で線形補間（範囲外は端の値）
+//==============================================================
+template <typename Key, typename Getter>
+float EvaluateKeys(const std::vector<Key>& keys, float t, Getter get)
+{
+    if (keys.empty())
+        return 0.0f;
+    if (t <= keys.front().t)
+        return get(keys.front());
+    if (t >= keys.back().t)
+        return get(keys.back());
+
+    for (size_t i = 1; i < keys.size(); i++)
+    {
+        if (t <= keys[i].t)
+        {
+            const float span = keys[i].t - keys[i - 1].t;
+            const float f = (span > 0.0f) ? (t - keys[i - 1].t) / span : 1.0f;
+            return Math::Lerp(get(keys[i - 1]), get(keys[i]), f);
+        }
+    }
+    return get(keys.back());
+}
+
+} // namespace
+
+ParticleEffect::ParticleEffect()
+: mVersion(0)
+{
+    Compile(mDesc);
+}
+
+ParticleEffect::~ParticleEffect()
+{
+}
+
+//==============================================================
+// ファイルから読む
+//  - パックにあればパックから（その場合は書き換わらないのでリロードも無い）
+//==============================================================
+bool ParticleEffect::Load(const std::string& fileName, AssetManager* assetManager)
+{
+    AssetData data;
+    if (!assetManager->GetFileSystem().Read(fileName, data))
+    {
+        std::cerr << "[ParticleEffect] Failed to read: " << fileName << std::endl;
+        return false;
+    }
+
+    nlohmann::json json;
+    if (!JsonHelper::LoadFromMemory(data.GetData(), data.GetSize(), fileName, json))
+    {
+        return false;
+    }
+
+    // 型違いの値などで例外が出たら、前の定義のまま（リロードは次の保存で再試行）
+    ParticleEffectDesc desc;
+    try
+    {
+        ParseDesc(json, desc);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "[ParticleEffect] Invalid definition: " << fileName
+                  << " (" << e.what() << ")" << std::endl;
+        return false;
+    }
+
+    mTexture = desc.texture.empty() ? nullptr : assetManager->GetTexture(desc.texture);
+    mFileName = fileName;
+    Compile(desc);
+    return true;
+}
+
+//==============================================================
+// コンパイル
+//  - 更新用：重力と減衰をモジュール列へ（無いものは積まない）
+//  - 描画用：大きさ・色のキーを kCurveSamples 分の表へ
+//==============================================================
+void ParticleEffect::Compile(const ParticleEffectDesc& desc)
+{
+    mDesc = desc;
+
+    // 値の整理
+    mDesc.lifeMin = std::max(mDesc.lifeMin, 0.001f);
+    mDesc.lifeMax = std::max(mDesc.lifeMax, mDesc.lifeMin);
+    mDesc.speedMax = std::max(mDesc.speedMax, mDesc.speedMin);
+    mDesc.spawnRate = std::max(mDesc.spawnRate, 0.0f);
+    mDesc.coneAngle = Math::Clamp(mDesc.coneAngle, 0.0f, 180.0f);
+    if (mDesc.direction.LengthSq() > 0.0f)
+    {
+        mDesc.direction.Normalize();
+    }
+    else
+    {
+        mDesc.direction = Vector3::UnitY;
+    }
+    std::stable_sort(mDesc.sizeOverLife.begin(), mDesc.sizeOverLife.end(),
+                     [](const auto& a, const auto& b) { return a.t < b.t; });
+    std::stable_sort(mDesc.colorOverLife.begin(), mDesc.colorOverLife.end(),
+                     [](const auto& a, const auto& b) { return a.t < b.t; });
+
+    // 更新モジュール
+    mModules.clear();
+    if (mDesc.gravity.LengthSq() > 0.0f)
+    {
+        mModules.push_back({ ParticleModuleType::Acceleration,
+                             mDesc.gravity.x, mDesc.gravity.y, mDesc.gravity.z });
+    }
+    if (mDesc.drag > 0.0f)
+    {
+        mModules.push_back({ ParticleModuleType::Drag, mDesc.drag, 0.0f, 0.0f });
+    }
+
+    // カーブ表
+    for (int i = 0; i < kCurveSamples; i++)
+    {
+        const float t = static_cast<float>(i) / (kCurveSamples - 1);
+        mSizeCurve[i] = EvaluateKeys(mDesc.sizeOverLife, t,
+                                     [](const auto& k) { return k.size; });
+        mColorCurve[i][0] = EvaluateKeys(mDesc.colorOverLife, t, [](const auto& k) { return k.r; });
+        mColorCurve[i][1] = EvaluateKeys(mDesc.colorOverLife, t, [](const auto& k) { return k.g; });
+        mColorCurve[i][2] = EvaluateKeys(mDesc.colorOverLife, t, [](const auto& k) { return k.b; });
+        mColorCurve[i][3] = EvaluateKeys(mDesc.colorOverLife, t, [](const auto& k) { return k.a; });
+    }
+
+    mVersion++;
+}
+
+//==============================================================
+// カーブ表の参照（隣り合う 2 点を線形補間）
+//==============================================================
+float ParticleEffect::SampleSize(float t) const
+{
+    const float x = Math::Clamp(t, 0.0f, 1.0f) * (kCurveSamples - 1);
+    const int   i = std::min(static_cast<int>(x), kCurveSamples - 2);
+    return Math::Lerp(mSizeCurve[i], mSizeCurve[i + 1], x - i);
+}
+
+void ParticleEffect::SampleColor(float t, float& r, float& g, float& b, float& a) const
+{
+    const float x = Math::Clamp(t, 0.0f, 1.0f) * (kCurveSamples - 1);
+    const int   i = std::min(static_cast<int>(x), kCurveSamples - 2);
+    const float f = x - i;
+    r = Math::Lerp(mColorCurve[i][0], mColorCurve[i + 1][0], f);
+    g = Math::Lerp(mColorCurve[i][1], mColorCurve[i + 1][1], f);
+    b = Math::Lerp(mColorCurve[i][2], mColorCurve[i + 1][2], f);
+    a = Math::Lerp(mColorCurve[i][3], mColorCurve[i + 1][3], f);
+}
+
+} // namespace toy
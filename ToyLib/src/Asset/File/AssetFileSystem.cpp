@@ -0,0 +1,116 @@
+#include "Asset/File/AssetFileSystem.h"
+#include "Asset/File/AssetPack.h"
+
+#include <cstdio>
+#include <iostream>
+
+namespace toy {
+
+AssetFileSystem::AssetFileSystem()
+{
+}
+
+AssetFileSystem::~AssetFileSystem()
+{
+}
+
+//==============================================================
+// マウント
+//==============================================================
+bool AssetFileSystem::Mount(const std::string& packPath)
+{
+    auto pack = std::make_shared<AssetPack>();
+    if (!pack->Open(packPath))
+    {
+        return false;
+    }
+    mPacks.push_back(std::move(pack));
+    return true;
+}
+
+void AssetFileSystem::UnmountAll()
+{
+    // 読み込み中の AssetData が持っている分はそちらが離すまで残る
+    mPacks.clear();
+}
+
+bool AssetFileSystem::IsPacked(const std::string& path) const
+{
+    for (auto it = mPacks.rbegin(); it != mPacks.rend(); ++it)
+    {
+        if ((*it)->Find(path)) return true;
+    }
+    return false;
+}
+
+bool AssetFileSystem::Exists(const std::string& path) const
+{
+    if (IsPacked(path)) return true;
+
+    FILE* fp = std::fopen(GetFullPath(path).c_str(), "rb");
+    if (!fp) return false;
+    std::fclose(fp);
+    return true;
+}
+
+//==============================================================
+// 読み込み
+//  - パック内の無圧縮エントリはマップ領域を指すだけ
+//  - 通常ファイルはサイズを調べて 1 回で読む
+//==============================================================
+bool AssetFileSystem::Read(const std::string& path, AssetData& out) const
+{
+    out.Reset();
+
+    for (auto it = mPacks.rbegin(); it != mPacks.rend(); ++it)
+    {
+        const PackEntry* entry = (*it)->Find(path);
+        if (!entry) continue;
+
+        out.mPack = *it;
+        if (const uint8_t* stored = (*it)->GetStoredData(*entry))
+        {
+            (*it)->Prefetch(*entry);
+            out.mData = stored;
+            out.mSize = static_cast<size_t>(entry->storedSize);
+            return true;
+        }
+        if (!(*it)->Extract(*entry, out.mOwned))
+        {
+            out.Reset();
+            return false;
+        }
+        out.mData = out.mOwned.data();
+        out.mSize = out.mOwned.size();
+        return true;
+    }
+
+    const std::string fullPath = GetFullPath(path);
+    FILE* fp = std::fopen(fullPath.c_str(), "rb");
+    if (!fp)
+    {
+        return false;
+    }
+
+    bool ok = std::fseek(fp, 0, SEEK_END) == 0;
+    long size = ok ? std::ftell(fp) : -1;
+    ok = ok && size >= 0 && std::fseek(fp, 0, SEEK_SET) == 0;
+    if (ok)
+    {
+        out.mOwned.resize(static_cast<size_t>(size));
+        ok = size == 0 || std::fread(out.mOwned.data(), 1, out.mOwned.size(), fp) == out.mOwned.size();
+    }
+    std::fclose(fp);
+
+    if (!ok)
+    {
+        std::cerr << "[AssetFileSystem] Read failed: " << fullPath << std::endl;
+        out.Reset();
+        return false;
+    }
+    out.mData = out.mOwned.data();
+    out.mSize = out.mOwned.size();
+    return true;
+}
+
+} // namespace toy
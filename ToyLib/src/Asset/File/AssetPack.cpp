@@ -0,0 +1,421 @@
+#include "Asset/File/AssetPack.h"
+#include "Asset/File/Lz4.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace toy {
+
+namespace {
+
+//==============================================================
+// ファイルヘッダ（先頭 64 byte）
+//==============================================================
+struct PackHeader
+{
+    char     magic[4];        // "TPAK"
+    uint32_t version;
+    uint64_t numEntries;
+    uint64_t tocOffset;       // PackEntry[numEntries]（ハッシュ昇順）
+    uint64_t namesOffset;     // '\0' 区切りのパス
+    uint64_t namesSize;
+    uint8_t  reserved[24];
+};
+static_assert(sizeof(PackHeader) == 64, "PackHeader must be 64 bytes");
+
+const char kMagic[4] = { 'T', 'P', 'A', 'K' };
+
+// 圧縮しても縮まない（既に圧縮済み）形式と、mmap のまま使いたい形式
+bool ShouldStore(const std::string& path)
+{
+    static const char* const kStoredExtensions[] =
+    {
+        ".png", ".jpg", ".jpeg", ".mp3", ".ogg", ".tmesh", ".ttex", ".tpak",
+    };
+
+    std::string ext = std::filesystem::path(path).extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    for (const char* e : kStoredExtensions)
+    {
+        if (ext == e) return true;
+    }
+    return false;
+}
+
+size_t AlignUp(size_t v, size_t alignment)
+{
+    return (v + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+AssetPack::AssetPack()
+: mEntries(nullptr)
+, mNumEntries(0)
+, mNames(nullptr)
+, mNamesSize(0)
+{
+}
+
+AssetPack::~AssetPack()
+{
+    Close();
+}
+
+//==============================================================
+// パスの正規化
+//==============================================================
+std::string AssetPack::NormalizePath(const std::string& path)
+{
+    std::vector<std::string> parts;
+    std::string part;
+
+    auto flush = [&]()
+    {
+        if (part == "..")
+        {
+            if (!parts.empty()) parts.pop_back();
+        }
+        else if (!part.empty() && part != ".")
+        {
+            parts.push_back(part);
+        }
+        part.clear();
+    };
+
+    for (char c : path)
+    {
+        if (c == '/' || c == '\\')
+        {
+            flush();
+        }
+        else
+        {
+            part.push_back(c);
+        }
+    }
+    flush();
+
+    std::string out;
+    for (size_t i = 0; i < parts.size(); i++)
+    {
+        if (i > 0) out.push_back('/');
+        out += parts[i];
+    }
+    return out;
+}
+
+//==============================================================
+// パスのハッシュ（FNV-1a 64bit）
+//==============================================================
+uint64_t AssetPack::HashPath(const std::string& normalized)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : normalized)
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+//==============================================================
+// 開く
+//  - 目次と名前表の範囲はここで全部確かめておき、
+//    Find / Extract では範囲チェックをしない
+//==============================================================
+bool AssetPack::Open(const std::string& packPath)
+{
+    Close();
+
+    if (!mFile.Open(packPath))
+    {
+        std::cerr << "[AssetPack] Cannot open: " << packPath << std::endl;
+        return false;
+    }
+
+    const uint8_t* base = mFile.GetData();
+    const size_t   size = mFile.GetSize();
+
+    PackHeader header{};
+    if (size < sizeof(PackHeader))
+    {
+        std::cerr << "[AssetPack] Too small: " << packPath << std::endl;
+        Close();
+        return false;
+    }
+    std::memcpy(&header, base, sizeof(header));
+
+    const bool validHeader =
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+        header.version == kVersion &&
+        header.tocOffset % alignof(PackEntry) == 0 &&
+        header.tocOffset <= size &&
+        header.numEntries <= (size - header.tocOffset) / sizeof(PackEntry) &&
+        header.namesOffset <= size &&
+        header.namesSize <= size - header.namesOffset &&
+        (header.namesSize == 0 || base[header.namesOffset + header.namesSize - 1] == '\0');
+    if (!validHeader)
+    {
+        std::cerr << "[AssetPack] Invalid header: " << packPath << std::endl;
+        Close();
+        return false;
+    }
+
+    mEntries    = reinterpret_cast<const PackEntry*>(base + header.tocOffset);
+    mNumEntries = static_cast<size_t>(header.numEntries);
+    mNames      = reinterpret_cast<const char*>(base + header.namesOffset);
+    mNamesSize  = static_cast<size_t>(header.namesSize);
+
+    for (size_t i = 0; i < mNumEntries; i++)
+    {
+        const PackEntry& e = mEntries[i];
+        const bool valid =
+            e.nameOffset < mNamesSize &&
+            e.offset <= size &&
+            e.storedSize <= size - e.offset &&
+            (e.compression == PackEntry::Stored ? e.storedSize == e.rawSize
+                                                : e.compression == PackEntry::LZ4) &&
+            (i == 0 || mEntries[i - 1].hash <= e.hash);
+        if (!valid)
+        {
+            std::cerr << "[AssetPack] Corrupted entry " << i << ": " << packPath << std::endl;
+            Close();
+            return false;
+        }
+    }
+
+    // 目次はすぐ引くので先読みしておく
+    mFile.Prefetch(static_cast<size_t>(header.tocOffset), mNumEntries * sizeof(PackEntry));
+
+    mPath = packPath;
+    std::cerr << "[AssetPack] Mounted " << packPath
+              << " (" << mNumEntries << " files)" << std::endl;
+    return true;
+}
+
+void AssetPack::Close()
+{
+    mFile.Close();
+    mEntries    = nullptr;
+    mNumEntries = 0;
+    mNames      = nullptr;
+    mNamesSize  = 0;
+    mPath.clear();
+}
+
+//==============================================================
+// 検索（ハッシュで二分探索 → 名前で確認）
+//==============================================================
+const PackEntry* AssetPack::Find(const std::string& path) const
+{
+    if (mNumEntries == 0) return nullptr;
+
+    const std::string normalized = NormalizePath(path);
+    const uint64_t    hash       = HashPath(normalized);
+
+    const PackEntry* end = mEntries + mNumEntries;
+    const PackEntry* it  = std::lower_bound(mEntries, end, hash,
+        [](const PackEntry& e, uint64_t h) { return e.hash < h; });
+
+    for (; it != end && it->hash == hash; ++it)
+    {
+        if (normalized == (mNames + it->nameOffset))
+        {
+            return it;
+        }
+    }
+    return nullptr;
+}
+
+const uint8_t* AssetPack::GetStoredData(const PackEntry& entry) const
+{
+    if (entry.compression != PackEntry::Stored) return nullptr;
+    return mFile.GetData() + entry.offset;
+}
+
+void AssetPack::Prefetch(const PackEntry& entry) const
+{
+    mFile.Prefetch(static_cast<size_t>(entry.offset), static_cast<size_t>(entry.storedSize));
+}
+
+//==============================================================
+// 展開
+//==============================================================
+bool AssetPack::Extract(const PackEntry& entry, std::vector<uint8_t>& out) const
+{
+    const uint8_t* src = mFile.GetData() + entry.offset;
+    const size_t   storedSize = static_cast<size_t>(entry.storedSize);
+    const size_t   rawSize    = static_cast<size_t>(entry.rawSize);
+
+    if (entry.compression == PackEntry::Stored)
+    {
+        out.assign(src, src + storedSize);
+        return true;
+    }
+
+    out.resize(rawSize);
+    if (!Lz4::Decompress(src, storedSize, out.data(), rawSize))
+    {
+        std::cerr << "[AssetPack] Decompression failed: "
+                  << (mNames + entry.nameOffset) << std::endl;
+        out.clear();
+        return false;
+    }
+    return true;
+}
+
+//==============================================================
+// 作成
+//==============================================================
+bool AssetPack::Build(const std::string& rootDir,
+                      const std::string& packPath,
+                      bool compress)
+{
+    namespace fs = std::filesystem;
+
+    struct Source
+    {
+        std::string          name;
+        uint64_t             hash = 0;
+        std::vector<uint8_t> data;
+        uint64_t             rawSize = 0;
+        uint32_t             compression = PackEntry::Stored;
+    };
+    std::vector<Source> sources;
+
+    //----------------------------------------------------------
+    // 集める（パック自身と書きかけの一時ファイルは除く）
+    //----------------------------------------------------------
+    std::error_code ec;
+    const fs::path root(rootDir);
+    const fs::path self = fs::absolute(packPath, ec);
+    for (fs::recursive_directory_iterator it(root, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if (!it->is_regular_file()) continue;
+
+        const fs::path& p = it->path();
+        if (p.extension() == kExtension || p.extension() == ".tmp") continue;
+        if (fs::absolute(p, ec) == self) continue;
+
+        std::ifstream file(p, std::ios::binary);
+        if (!file)
+        {
+            std::cerr << "[AssetPack] Cannot read: " << p.string() << std::endl;
+            return false;
+        }
+
+        Source src;
+        src.name = NormalizePath(fs::relative(p, root, ec).generic_string());
+        src.hash = HashPath(src.name);
+        src.data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        src.rawSize = src.data.size();
+
+        if (compress && !ShouldStore(src.name) && !src.data.empty())
+        {
+            std::vector<uint8_t> packed;
+            Lz4::Compress(src.data.data(), src.data.size(), packed);
+
+            // 1 割以上縮まないなら無圧縮のまま（展開の手間に見合わない）
+            if (packed.size() * 10 < src.data.size() * 9)
+            {
+                src.data.swap(packed);
+                src.compression = PackEntry::LZ4;
+            }
+        }
+        sources.push_back(std::move(src));
+    }
+    if (ec)
+    {
+        std::cerr << "[AssetPack] Cannot scan: " << rootDir << " : " << ec.message() << std::endl;
+        return false;
+    }
+
+    std::sort(sources.begin(), sources.end(),
+              [](const Source& a, const Source& b) { return a.hash < b.hash; });
+
+    //----------------------------------------------------------
+    // 配置を決める
+    //----------------------------------------------------------
+    PackHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version    = kVersion;
+    header.numEntries = sources.size();
+    header.tocOffset  = sizeof(PackHeader);
+
+    std::vector<PackEntry> entries(sources.size());
+    std::vector<char>      names;
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        entries[i].hash        = sources[i].hash;
+        entries[i].nameOffset  = static_cast<uint32_t>(names.size());
+        entries[i].storedSize  = sources[i].data.size();
+        entries[i].rawSize     = sources[i].rawSize;
+        entries[i].compression = sources[i].compression;
+        names.insert(names.end(), sources[i].name.begin(), sources[i].name.end());
+        names.push_back('\0');
+    }
+    header.namesOffset = header.tocOffset + entries.size() * sizeof(PackEntry);
+    header.namesSize   = names.size();
+
+    size_t cursor = AlignUp(static_cast<size_t>(header.namesOffset + header.namesSize), kDataAlign);
+    for (auto& e : entries)
+    {
+        e.offset = cursor;
+        cursor   = AlignUp(cursor + static_cast<size_t>(e.storedSize), kDataAlign);
+    }
+
+    //----------------------------------------------------------
+    // 書き出し（MeshCache と同じく一時ファイル経由）
+    //----------------------------------------------------------
+    std::string tmpPath = packPath + ".tmp";
+    FILE* fp = std::fopen(tmpPath.c_str(), "wb");
+    if (!fp)
+    {
+        std::cerr << "[AssetPack] Cannot write: " << tmpPath << std::endl;
+        return false;
+    }
+
+    size_t pos = 0;
+    bool written = true;
+    auto put = [&](const void* data, size_t size)
+    {
+        written = written && std::fwrite(data, 1, size, fp) == size;
+        pos += size;
+    };
+    auto pad = [&](size_t to)
+    {
+        static const uint8_t zeros[kDataAlign] = {};
+        while (pos < to) put(zeros, std::min(to - pos, kDataAlign));
+    };
+
+    put(&header, sizeof(header));
+    put(entries.data(), entries.size() * sizeof(PackEntry));
+    put(names.data(), names.size());
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        pad(static_cast<size_t>(entries[i].offset));
+        put(sources[i].data.data(), sources[i].data.size());
+    }
+    written = (std::fclose(fp) == 0) && written;
+
+    std::remove(packPath.c_str());
+    if (!written || std::rename(tmpPath.c_str(), packPath.c_str()) != 0)
+    {
+        std::remove(tmpPath.c_str());
+        std::cerr << "[AssetPack] Write failed: " << packPath << std::endl;
+        return false;
+    }
+
+    std::cerr << "[AssetPack] Built " << packPath << " (" << sources.size()
+              << " files, " << pos / 1024 << " KB)" << std::endl;
+    return true;
+}
+
+} // namespace toy
@@ -0,0 +1,73 @@
+#include "Asset/File/FileWatcher.h"
+
+#include <algorithm>
+#include <iostream>
+#include <system_error>
+
+namespace toy {
+
+FileWatcher::FileWatcher()
+: mInterval(0.5f)
+, mLastPoll(std::chrono::steady_clock::now())
+{
+}
+
+void FileWatcher::Watch(const std::string& fullPath, Callback callback)
+{
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(fullPath, ec);
+    if (ec)
+    {
+        std::cerr << "[FileWatcher] Cannot watch: " << fullPath << std::endl;
+        return;
+    }
+
+    auto iter = std::find_if(mEntries.begin(), mEntries.end(),
+                             [&fullPath](const Entry& e) { return e.path == fullPath; });
+    if (iter != mEntries.end())
+    {
+        iter->time     = time;
+        iter->callback = std::move(callback);
+        return;
+    }
+    mEntries.push_back({ fullPath, time, std::move(callback) });
+}
+
+void FileWatcher::Clear()
+{
+    mEntries.clear();
+}
+
+//==============================================================
+// 変更の確認
+//  - 保存途中で消えている（置き換え保存など）ものは次回に回す
+//==============================================================
+void FileWatcher::Poll()
+{
+    if (mEntries.empty())
+        return;
+
+    auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<float>(now - mLastPoll).count() < mInterval)
+        return;
+    mLastPoll = now;
+
+    for (size_t i = 0; i < mEntries.size(); i++)
+    {
+        std::error_code ec;
+        auto time = std::filesystem::last_write_time(mEntries[i].path, ec);
+        if (ec || time == mEntries[i].time)
+            continue;
+
+        std::cerr << "[FileWatcher] Reloading " << mEntries[i].path << std::endl;
+
+        // コールバック内で Watch されても壊れないよう添字で触る
+        Callback callback = mEntries[i].callback;
+        if (callback())
+        {
+            mEntries[i].time = time;
+        }
+    }
+}
+
+} // namespace toy
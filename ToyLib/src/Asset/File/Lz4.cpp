@@ -0,0 +1,190 @@
+#include "Asset/File/Lz4.h"
+
+#include <cstring>
+
+namespace toy {
+namespace Lz4 {
+
+namespace {
+
+constexpr size_t   kMinMatch     = 4;
+constexpr size_t   kLastLiterals = 5;       // 末尾 5 byte は必ずリテラル
+constexpr size_t   kMatchLimit   = 12;      // 末尾 12 byte 以内からは一致を始めない
+constexpr size_t   kMaxOffset    = 65535;
+constexpr int      kHashLog      = 16;
+
+uint32_t Read32(const uint8_t* p)
+{
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint32_t Hash(uint32_t seq)
+{
+    return (seq * 2654435761u) >> (32 - kHashLog);
+}
+
+// 15 以上の長さは 255 の並び＋残りで表す
+void PutLength(std::vector<uint8_t>& out, size_t len)
+{
+    while (len >= 255)
+    {
+        out.push_back(255);
+        len -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(len));
+}
+
+void PutSequence(std::vector<uint8_t>& out,
+                 const uint8_t* literals,
+                 size_t numLiterals,
+                 size_t offset,
+                 size_t matchLength)
+{
+    const size_t ml = matchLength - kMinMatch;
+    uint8_t token = static_cast<uint8_t>(((numLiterals < 15 ? numLiterals : 15) << 4) |
+                                         (ml < 15 ? ml : 15));
+    out.push_back(token);
+    if (numLiterals >= 15) PutLength(out, numLiterals - 15);
+    out.insert(out.end(), literals, literals + numLiterals);
+
+    out.push_back(static_cast<uint8_t>(offset & 0xff));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (ml >= 15) PutLength(out, ml - 15);
+}
+
+void PutLastLiterals(std::vector<uint8_t>& out, const uint8_t* literals, size_t numLiterals)
+{
+    out.push_back(static_cast<uint8_t>((numLiterals < 15 ? numLiterals : 15) << 4));
+    if (numLiterals >= 15) PutLength(out, numLiterals - 15);
+    out.insert(out.end(), literals, literals + numLiterals);
+}
+
+// 長さの続きを読む（範囲外なら false）
+bool GetLength(const uint8_t* src, size_t srcSize, size_t& ip, size_t& len)
+{
+    uint8_t b;
+    do
+    {
+        if (ip >= srcSize) return false;
+        b = src[ip++];
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+} // namespace
+
+//==============================================================
+// 圧縮
+//  - 4 byte のハッシュ表で直近の同じ並びを 1 つだけ覚えておき、
+//    見つかれば前後に一致を伸ばしてシーケンスにする
+//==============================================================
+void Compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out)
+{
+    out.clear();
+    out.reserve(srcSize + srcSize / 255 + 16);
+
+    size_t anchor = 0;
+    if (srcSize > kMatchLimit)
+    {
+        // 位置 + 1 を入れる（0 は空き）
+        std::vector<uint32_t> table(size_t(1) << kHashLog, 0);
+
+        const size_t limit = srcSize - kMatchLimit;
+        size_t i = 0;
+        while (i < limit)
+        {
+            const uint32_t seq = Read32(src + i);
+            const uint32_t h   = Hash(seq);
+            const size_t   cand = table[h];
+            table[h] = static_cast<uint32_t>(i + 1);
+
+            if (cand == 0 || i - (cand - 1) > kMaxOffset || Read32(src + cand - 1) != seq)
+            {
+                i++;
+                continue;
+            }
+
+            size_t match = cand - 1;
+
+            // 後ろ向きに伸ばす（リテラルを減らす）
+            while (i > anchor && match > 0 && src[i - 1] == src[match - 1])
+            {
+                i--;
+                match--;
+            }
+
+            // 前向きに伸ばす（末尾のリテラル分は残す）
+            const size_t maxLength = srcSize - kLastLiterals - i;
+            size_t length = kMinMatch;
+            while (length < maxLength && src[i + length] == src[match + length])
+            {
+                length++;
+            }
+
+            PutSequence(out, src + anchor, i - anchor, i - match, length);
+            i += length;
+            anchor = i;
+        }
+    }
+
+    PutLastLiterals(out, src + anchor, srcSize - anchor);
+}
+
+//==============================================================
+// 展開
+//==============================================================
+bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+{
+    size_t ip = 0;
+    size_t op = 0;
+
+    while (ip < srcSize)
+    {
+        const uint8_t token = src[ip++];
+
+        // リテラル
+        size_t numLiterals = token >> 4;
+        if (numLiterals == 15 && !GetLength(src, srcSize, ip, numLiterals)) return false;
+        if (numLiterals > srcSize - ip || numLiterals > dstSize - op) return false;
+        std::memcpy(dst + op, src + ip, numLiterals);
+        ip += numLiterals;
+        op += numLiterals;
+
+        // 最後のシーケンスはリテラルだけ
+        if (ip == srcSize) break;
+
+        // 一致
+        if (srcSize - ip < 2) return false;
+        const size_t offset = src[ip] | (static_cast<size_t>(src[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) return false;
+
+        size_t length = token & 15;
+        if (length == 15 && !GetLength(src, srcSize, ip, length)) return false;
+        length += kMinMatch;
+        if (length > dstSize - op) return false;
+
+        // 重なりがあり得るので 1 byte ずつ（offset >= length なら一括）
+        const uint8_t* from = dst + op - offset;
+        if (offset >= length)
+        {
+            std::memcpy(dst + op, from, length);
+        }
+        else
+        {
+            for (size_t k = 0; k < length; k++)
+            {
+                dst[op + k] = from[k];
+            }
+        }
+        op += length;
+    }
+
+    return op == dstSize;
+}
+
+} // namespace Lz4
+} // namespace toy
@@ -0,0 +1,129 @@
+#include "Asset/File/MappedFile.h"
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace toy {
+
+MappedFile::MappedFile()
+: mData(nullptr)
+, mSize(0)
+#ifdef _WIN32
+, mFile(nullptr)
+, mMapping(nullptr)
+#else
+, mFd(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+//==============================================================
+// 開いてマップ
+//==============================================================
+bool MappedFile::Open(const std::string& path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    mFile = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        Close();
+        return false;
+    }
+    mSize = static_cast<size_t>(size.QuadPart);
+
+    mMapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mMapping)
+    {
+        Close();
+        return false;
+    }
+    mData = static_cast<const uint8_t*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    if (!mData)
+    {
+        Close();
+        return false;
+    }
+#else
+    mFd = open(path.c_str(), O_RDONLY);
+    if (mFd == -1) return false;
+
+    struct stat st;
+    if (fstat(mFd, &st) != 0 || st.st_size == 0)
+    {
+        Close();
+        return false;
+    }
+    mSize = static_cast<size_t>(st.st_size);
+
+    void* p = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFd, 0);
+    if (p == MAP_FAILED)
+    {
+        Close();
+        return false;
+    }
+    mData = static_cast<const uint8_t*>(p);
+#endif
+    return true;
+}
+
+//==============================================================
+// マップ解除
+//==============================================================
+void MappedFile::Close()
+{
+#ifdef _WIN32
+    if (mData)    UnmapViewOfFile(mData);
+    if (mMapping) CloseHandle(static_cast<HANDLE>(mMapping));
+    if (mFile)    CloseHandle(static_cast<HANDLE>(mFile));
+    mMapping = nullptr;
+    mFile    = nullptr;
+#else
+    if (mData) munmap(const_cast<uint8_t*>(mData), mSize);
+    if (mFd != -1) close(mFd);
+    mFd = -1;
+#endif
+    mData = nullptr;
+    mSize = 0;
+}
+
+//==============================================================
+// 先読み
+//  - madvise はページ境界から始める必要がある
+//==============================================================
+void MappedFile::Prefetch(size_t offset, size_t size) const
+{
+#ifndef _WIN32
+    if (!mData || offset >= mSize) return;
+    if (size > mSize - offset) size = mSize - offset;
+
+    const size_t page  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t begin = offset - offset % page;
+    madvise(const_cast<uint8_t*>(mData) + begin, size + (offset - begin), MADV_WILLNEED);
+#else
+    (void)offset;
+    (void)size;
+#endif
+}
+
+} // namespace toy
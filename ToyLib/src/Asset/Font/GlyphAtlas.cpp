@@ -0,0 +1,286 @@
+#include "Asset/Font/GlyphAtlas.h"
+#include "Asset/Font/TextFont.h"
+#include "Asset/Material/Texture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+
+// グリフの間に空ける画素数（バイリニアで隣がにじまないように）
+constexpr int kPadding = 1;
+
+// アトラスの最大辺
+constexpr int kMaxSize = 2048;
+
+int NextPowerOfTwo(int v)
+{
+    int p = 1;
+    while (p < v)
+    {
+        p <<= 1;
+    }
+    return p;
+}
+
+// 透明の画素（色は白にしておき、縁を補間しても黒ずまないように）
+void FillClear(uint8_t* dst, size_t numPixels)
+{
+    for (size_t i = 0; i < numPixels; i++)
+    {
+        dst[i * 4 + 0] = 255;
+        dst[i * 4 + 1] = 255;
+        dst[i * 4 + 2] = 255;
+        dst[i * 4 + 3] = 0;
+    }
+}
+
+} // namespace
+
+//==============================================================
+// コンストラクタ
+//  - 幅は 1 行に 16 文字ほど入る大きさ、高さは 2 行から始めて倍にしていく
+//==============================================================
+GlyphAtlas::GlyphAtlas(TextFont* font)
+: mFont(font)
+, mWidth(0)
+, mHeight(0)
+, mMaxHeight(kMaxSize)
+, mShelfX(0)
+, mShelfY(0)
+, mShelfHeight(0)
+, mDirtyBegin(0)
+, mDirtyEnd(0)
+, mRecreate(true)
+, mLineHeight(0)
+, mVersion(0)
+, mGeneration(0)
+{
+    if (mFont && mFont->IsValid())
+    {
+        mLineHeight = TTF_GetFontHeight(mFont->GetNativeFont());
+    }
+
+    const int cell = std::max(mLineHeight, 1) + kPadding;
+    mWidth  = std::clamp(NextPowerOfTwo(cell * 16), 256, kMaxSize);
+    mHeight = std::clamp(NextPowerOfTwo(cell * 2), 64, kMaxSize);
+
+    mPixels.resize(static_cast<size_t>(mWidth) * mHeight * 4);
+    FillClear(mPixels.data(), static_cast<size_t>(mWidth) * mHeight);
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+}
+
+//==============================================================
+// 文字を引く
+//==============================================================
+const Glyph& GlyphAtlas::GetGlyph(uint32_t codepoint)
+{
+    auto iter = mGlyphs.find(codepoint);
+    if (iter != mGlyphs.end())
+    {
+        return iter->second;
+    }
+
+    Glyph glyph;
+    Rasterize(codepoint, glyph);
+
+    // Rasterize 中に詰め直し（Reset）があっても、この文字は新しい表に入る
+    return mGlyphs.emplace(codepoint, glyph).first->second;
+}
+
+int GlyphAtlas::GetKerning(uint32_t prev, uint32_t codepoint) const
+{
+    if (!mFont || !mFont->IsValid())
+        return 0;
+
+    int kerning = 0;
+    if (!TTF_GetGlyphKerning(mFont->GetNativeFont(), prev, codepoint, &kerning))
+        return 0;
+    return kerning;
+}
+
+//==============================================================
+// 文字を描いてアトラスへ書く
+//  - SDL_ttf は 1 文字でも行の高さの画像を返すので、
+//    不透明な範囲だけを切り出して置く
+//  - 画像の左端はペン位置 + min(minx, 0)（左へはみ出す文字のぶん）
+//==============================================================
+void GlyphAtlas::Rasterize(uint32_t codepoint, Glyph& glyph)
+{
+    if (!mFont || !mFont->IsValid())
+        return;
+
+    TTF_Font* font = mFont->GetNativeFont();
+
+    int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+    if (TTF_GetGlyphMetrics(font, codepoint, &minX, &maxX, &minY, &maxY, &advance))
+    {
+        glyph.advance = advance;
+    }
+
+    // 空白など、描くものが無い文字は進み幅だけ
+    SDL_Color white = { 255, 255, 255, 255 };
+    SDL_Surface* surface = TTF_RenderGlyph_Blended(font, codepoint, white);
+    if (!surface)
+        return;
+
+    SDL_Surface* conv = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(surface);
+    if (!conv)
+        return;
+
+    // 不透明な範囲
+    const uint8_t* src = static_cast<const uint8_t*>(conv->pixels);
+    int left = conv->w, right = -1, top = conv->h, bottom = -1;
+    for (int y = 0; y < conv->h; y++)
+    {
+        const uint8_t* row = src + static_cast<size_t>(y) * conv->pitch;
+        for (int x = 0; x < conv->w; x++)
+        {
+            if (row[x * 4 + 3] != 0)
+            {
+                left   = std::min(left, x);
+                right  = std::max(right, x);
+                top    = std::min(top, y);
+                bottom = std::max(bottom, y);
+            }
+        }
+    }
+
+    if (right >= left && bottom >= top)
+    {
+        const int w = right - left + 1;
+        const int h = bottom - top + 1;
+
+        int ax = 0, ay = 0;
+        if (Allocate(w, h, ax, ay))
+        {
+            for (int y = 0; y < h; y++)
+            {
+                const uint8_t* srcRow = src + static_cast<size_t>(top + y) * conv->pitch + left * 4;
+                uint8_t* dstRow = mPixels.data() + (static_cast<size_t>(ay + y) * mWidth + ax) * 4;
+                std::memcpy(dstRow, srcRow, static_cast<size_t>(w) * 4);
+            }
+
+            glyph.x       = ax;
+            glyph.y       = ay;
+            glyph.width   = w;
+            glyph.height  = h;
+            glyph.offsetX = std::min(minX, 0) + left;
+            glyph.offsetY = top;
+
+            mDirtyBegin = (mDirtyBegin < mDirtyEnd) ? std::min(mDirtyBegin, ay) : ay;
+            mDirtyEnd   = std::max(mDirtyEnd, ay + h);
+        }
+        else
+        {
+            std::cerr << "[GlyphAtlas] Glyph too large: U+"
+                      << std::hex << codepoint << std::dec << std::endl;
+        }
+    }
+
+    SDL_DestroySurface(conv);
+}
+
+//==============================================================
+// 棚詰め
+//  - 今の棚の右に置き、入らなければ次の棚へ
+//  - 下が足りなければ高さを倍に（既存の画素はそのまま、UV は変わる）
+//  - 上限でも足りなければ空にして詰め直す
+//==============================================================
+bool GlyphAtlas::Allocate(int width, int height, int& outX, int& outY)
+{
+    const int w = width + kPadding;
+    const int h = height + kPadding;
+    if (w > mWidth || h > mMaxHeight)
+        return false;
+
+    if (mShelfX + w > mWidth)
+    {
+        mShelfY += mShelfHeight;
+        mShelfX = 0;
+        mShelfHeight = 0;
+    }
+
+    if (mShelfY + h > mHeight)
+    {
+        int newHeight = mHeight;
+        while (newHeight < mShelfY + h && newHeight < mMaxHeight)
+        {
+            newHeight *= 2;
+        }
+        newHeight = std::min(newHeight, mMaxHeight);
+
+        if (mShelfY + h > newHeight)
+        {
+            // 上限まで埋まった：今使っている文字だけがまた描かれる
+            Reset();
+        }
+        else
+        {
+            mPixels.resize(static_cast<size_t>(mWidth) * newHeight * 4);
+            FillClear(mPixels.data() + static_cast<size_t>(mWidth) * mHeight * 4,
+                      static_cast<size_t>(mWidth) * (newHeight - mHeight));
+            mHeight   = newHeight;
+            mRecreate = true;
+            mVersion++;
+        }
+    }
+
+    outX = mShelfX;
+    outY = mShelfY;
+    mShelfX += w;
+    mShelfHeight = std::max(mShelfHeight, h);
+    return true;
+}
+
+void GlyphAtlas::Reset()
+{
+    std::cerr << "[GlyphAtlas] Atlas full, repacking ("
+              << mGlyphs.size() << " glyphs)" << std::endl;
+
+    mGlyphs.clear();
+    FillClear(mPixels.data(), static_cast<size_t>(mWidth) * mHeight);
+    mShelfX      = 0;
+    mShelfY      = 0;
+    mShelfHeight = 0;
+    mRecreate    = true;
+    mVersion++;
+    mGeneration++;
+}
+
+//==============================================================
+// GPU へ送る
+//  - サイズが変わったときだけ作り直し、それ以外は追記した行だけ送る
+//==============================================================
+std::shared_ptr<Texture> GlyphAtlas::GetTexture()
+{
+    if (!mTexture)
+    {
+        mTexture = std::make_shared<Texture>();
+        mRecreate = true;
+    }
+
+    if (mRecreate)
+    {
+        mTexture->CreateFromPixels(mPixels.data(), mWidth, mHeight, /*hasAlpha=*/true);
+        mRecreate = false;
+    }
+    else if (mDirtyBegin < mDirtyEnd)
+    {
+        mTexture->UpdatePixels(0, mDirtyBegin, mWidth, mDirtyEnd - mDirtyBegin,
+                               mPixels.data() + static_cast<size_t>(mDirtyBegin) * mWidth * 4);
+    }
+    mDirtyBegin = 0;
+    mDirtyEnd   = 0;
+
+    return mTexture;
+}
+
+} // namespace toy
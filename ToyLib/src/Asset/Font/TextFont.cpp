@@ -1,4 +1,5 @@
 #include "Asset/Font/TextFont.h"
+#include "Asset/Font/GlyphAtlas.h"
 #include <iostream>
 
 namespace toy {
@@ -7,6 +8,7 @@ TextFont::TextFont()
     : mFont(nullptr)
     , mFilePath("")
     , mPointSize(0)
+    , mIsSdf(false)
 {
 }
 
@@ -36,13 +38,79 @@ bool TextFont::Load(const std::string& filePath, int pointSize)
     return true;
 }
 
+bool TextFont::Load(AssetData data, const std::string& filePath, int pointSize)
+{
+    Unload();
+
+    mSource = std::move(data);
+    SDL_IOStream* io = SDL_IOFromConstMem(mSource.GetData(), mSource.GetSize());
+    if (!io)
+    {
+        std::cerr << "SDL_IOFromConstMem failed: " << SDL_GetError() << std::endl;
+        mSource.Reset();
+        return false;
+    }
+
+    // closeio = true：フォントを閉じるときに io も閉じる
+    mFont = TTF_OpenFontIO(io, true, static_cast<float>(pointSize));
+    if (!mFont)
+    {
+        std::cerr << "TTF_OpenFontIO failed: " << SDL_GetError()
+                  << " (file: " << filePath
+                  << ", size: " << pointSize << ")"
+                  << std::endl;
+        mSource.Reset();
+        return false;
+    }
+
+    mFilePath  = filePath;
+    mPointSize = pointSize;
+    return true;
+}
+
+//------------------------------------------------------------------
+// 距離場モードの切り替え
+//------------------------------------------------------------------
+bool TextFont::SetSdf(bool enable)
+{
+    if (!mFont)
+        return false;
+    if (mIsSdf == enable)
+        return true;
+
+    if (!TTF_SetFontSDF(mFont, enable))
+    {
+        std::cerr << "TTF_SetFontSDF failed: " << SDL_GetError()
+                  << " (file: " << mFilePath << ")" << std::endl;
+        return false;
+    }
+
+    // 描き方が変わるので、今までのグリフは使えない
+    mIsSdf = enable;
+    mGlyphAtlas.reset();
+    return true;
+}
+
+GlyphAtlas* TextFont::GetGlyphAtlas()
+{
+    if (!mGlyphAtlas && mFont)
+    {
+        mGlyphAtlas = std::make_unique<GlyphAtlas>(this);
+    }
+    return mGlyphAtlas.get();
+}
+
 void TextFont::Unload()
 {
+    mGlyphAtlas.reset();
+    mIsSdf = false;
+
     if (mFont)
     {
         TTF_CloseFont(mFont);
         mFont = nullptr;
     }
+    mSource.Reset();
 }
 
 } // namespace toy
@@ -1,20 +1,31 @@
 #include "Asset/Geometry/Mesh.h"
+#include "Asset/Animation/AnimationCompression.h"
 #include "Asset/Material/Texture.h"
 #include "Asset/AssetManager.h"
 #include "Asset/Geometry/VertexArray.h"
+#include "Asset/Geometry/VertexFormat.h"
 #include "Asset/Geometry/Bone.h"
 #include "Asset/Geometry/Polygon.h"
 #include "Asset/Material/Material.h"
+#include "Asset/Geometry/MeshSimplifier.h"
+#include "Asset/Geometry/MeshOptimizer.h"
+#include "Asset/Geometry/MeshCache.h"
 
 #include <assimp/scene.h>
 #include <assimp/Importer.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/IOStream.hpp>
 #include <assimp/postprocess.h>
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <iostream>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <string>
+#include <unordered_map>
 
 //==============================================================
 // aiMatrix4x4 → ToyLib::Matrix4 変換
@@ -51,146 +62,190 @@ static void MatrixAi2Gl(Matrix4& mat, const aiMatrix4x4 aim)
 //==============================================================
 namespace toy {
 
-Mesh::Mesh()
-: mScene(nullptr)
-, mNumBones(0)
-, mSpecPower(1.0f)
+//==============================================================
+// インポート後の頂点/インデックス最適化
+//  1) Tipsify で頂点キャッシュ順に三角形を並べ替え
+//  2) キャッシュ境界ごとのクラスタを外向き順に並べてオーバードロー削減
+//  3) 初出順に頂点を振り直してフェッチを連続化（全ストリーム同時）
+//  ACMR（三角形あたりのキャッシュミス数）の前後をログに出す
+//==============================================================
+static void OptimizeMeshBuffers(const std::string& name,
+                                std::vector<float>& verts,
+                                std::vector<float>& norms,
+                                std::vector<float>& uvs,
+                                std::vector<unsigned int>* boneIDs,
+                                std::vector<float>* boneWeights,
+                                std::vector<unsigned int>& indices)
 {
-}
+    unsigned int numVerts = static_cast<unsigned int>(verts.size() / 3);
+    if (numVerts == 0 || indices.size() < 3) return;
 
-Mesh::~Mesh()
-{
-    // shared_ptr がクリアされれば VAO は自動解放
-    mVertexArray.clear();
+    float before = MeshOptimizer::ComputeACMR(indices, numVerts);
+
+    std::vector<unsigned int> clusters;
+    MeshOptimizer::OptimizeVertexCache(indices, numVerts, &clusters);
+    MeshOptimizer::OptimizeOverdraw(indices, verts.data(), numVerts, clusters);
+
+    std::vector<unsigned int> remap = MeshOptimizer::OptimizeVertexFetch(indices, numVerts);
+    MeshOptimizer::RemapVertexStream(verts, 3, remap);
+    MeshOptimizer::RemapVertexStream(norms, 3, remap);
+    MeshOptimizer::RemapVertexStream(uvs,   2, remap);
+    if (boneIDs)     MeshOptimizer::RemapVertexStream(*boneIDs,     4, remap);
+    if (boneWeights) MeshOptimizer::RemapVertexStream(*boneWeights, 4, remap);
+
+    float after = MeshOptimizer::ComputeACMR(indices, numVerts);
+
+    std::cerr << "[Mesh] ACMR " << name << ": "
+              << before << " -> " << after
+              << " (" << indices.size() / 3 << " tris)" << std::endl;
 }
 
 //==============================================================
-// ボーン階層を辿って FinalTransformation を計算
-//
-// 左手座標系（OpenGL）で、行列乗算順は ToyLib の Matrix4 に合わせる。
-// ToyLib は「M * V」で適用されるため local * parent。
+// Assimp 用のファイル入出力（アセットパック内のモデル）
+//  - .obj の .mtl のように、モデルから参照される別ファイルも
+//    同じ AssetFileSystem から探す
 //==============================================================
-void Mesh::ComputeBoneHierarchy(
-    float animationTime,
-    const aiNode* pNode,
-    const Matrix4& parentTransform,
-    const aiAnimation* pAnimation)
+namespace {
+
+class PackIOStream : public Assimp::IOStream
 {
-    std::string nodeName(pNode->mName.data);
+public:
+    explicit PackIOStream(AssetData data)
+        : mData(std::move(data))
+        , mPos(0)
+    {
+    }
+
+    size_t Read(void* buffer, size_t size, size_t count) override
+    {
+        if (size == 0) return 0;
+        const size_t n = std::min(count, (mData.GetSize() - mPos) / size);
+        std::memcpy(buffer, mData.GetData() + mPos, n * size);
+        mPos += n * size;
+        return n;
+    }
 
-    // ノードのデフォルト変換
-    Matrix4 nodeTransformation;
-    MatrixAi2Gl(nodeTransformation, pNode->mTransformation);
+    size_t Write(const void*, size_t, size_t) override { return 0; }
 
-    // 対応するアニメーションチャネル（位置/回転/スケール）
-    const aiNodeAnim* pNodeAnim = FindNodeAnim(pAnimation, nodeName);
-    if (pNodeAnim)
+    aiReturn Seek(size_t offset, aiOrigin origin) override
     {
-        // --- スケール ---
-        Vector3 scaling;
-        CalcInterpolatedScaling(scaling, animationTime, pNodeAnim);
-        Matrix4 scalingM = Matrix4::CreateScale(scaling);
+        size_t pos = offset;
+        if (origin == aiOrigin_CUR) pos += mPos;
+        if (origin == aiOrigin_END) pos += mData.GetSize();
+        if (pos > mData.GetSize()) return aiReturn_FAILURE;
+        mPos = pos;
+        return aiReturn_SUCCESS;
+    }
 
-        // --- 回転（クォータニオン補間） ---
-        Quaternion rotationQ;
-        CalcInterpolatedRotation(rotationQ, animationTime, pNodeAnim);
-        Matrix4 rotationM = Matrix4::CreateFromQuaternion(rotationQ);
+    size_t Tell() const override     { return mPos; }
+    size_t FileSize() const override { return mData.GetSize(); }
+    void   Flush() override {}
 
-        // --- 平行移動 ---
-        Vector3 translation;
-        CalcInterpolatedPosition(translation, animationTime, pNodeAnim);
-        Matrix4 translationM = Matrix4::CreateTranslation(translation);
+private:
+    AssetData mData;
+    size_t    mPos;
+};
 
-        // ※ 左手・右手の最終的な系は事前処理フラグで調整済み。
-        nodeTransformation = rotationM * translationM * scalingM;
+class PackIOSystem : public Assimp::IOSystem
+{
+public:
+    explicit PackIOSystem(const AssetFileSystem& fs)
+        : mFileSystem(fs)
+    {
     }
 
-    // 親のグローバル変換と合成
-    Matrix4 globalTransformation = nodeTransformation * parentTransform;
+    bool Exists(const char* file) const override { return mFileSystem.Exists(file); }
+    char getOsSeparator() const override { return '/'; }
 
-    // ボーンとして登録されているノードなら FinalTransformation を計算
-    if (mBoneMapping.find(nodeName) != mBoneMapping.end())
+    Assimp::IOStream* Open(const char* file, const char* mode) override
     {
-        unsigned int boneIndex = mBoneMapping[nodeName];
+        // パックは読み取り専用
+        if (std::strchr(mode, 'w') || std::strchr(mode, 'a')) return nullptr;
 
-        // Final = BoneOffset * Global * InvRoot
-        //
-        // BoneOffset : メッシュローカル座標 → ボーンローカル座標の変換
-        // Global     : ボーンの世界行列
-        // InvRoot    : ルートノードの逆変換
-        //
-        mBoneInfo[boneIndex].FinalTransformation =
-            mBoneInfo[boneIndex].BoneOffset *
-            globalTransformation *
-            mGlobalInverseTransform;
-    }
-
-    // 子ノードを再帰処理
-    for (unsigned int i = 0; i < pNode->mNumChildren; i++)
-    {
-        ComputeBoneHierarchy(
-            animationTime,
-            pNode->mChildren[i],
-            globalTransformation,
-            pAnimation);
+        AssetData data;
+        if (!mFileSystem.Read(file, data)) return nullptr;
+        return new PackIOStream(std::move(data));
     }
-}
+
+    void Close(Assimp::IOStream* stream) override { delete stream; }
+
+private:
+    const AssetFileSystem& mFileSystem;
+};
+
+} // namespace
 
 //==============================================================
-// ノード名に一致するアニメーションチャネルを検索
+// Decode() から Upload() まで持ち越すデータ
+//  - キャッシュから読んだときは mmap 領域を指したまま GL へ転送する
+//  - cacheFile はパック内の .tmesh（cache より後に解放されるよう先に置く）
 //==============================================================
-const aiNodeAnim* Mesh::FindNodeAnim(
-    const aiAnimation* pAnimation,
-    const std::string& nodeName)
+struct MeshLoadData
+{
+    AssetData            cacheFile;
+    MeshCache            cache;
+    MeshCacheData        built;
+    const MeshCacheData* data = nullptr;
+};
+
+// Mesh.h では MeshLoadData が不完全型なので、ここで定義する
+Mesh& Mesh::operator=(Mesh&&) = default;
+
+Mesh::Mesh()
+: mNumBones(0)
+, mSpecPower(1.0f)
+, mBoundingMin(Vector3(Math::Infinity, Math::Infinity, Math::Infinity))
+, mBoundingMax(Vector3(Math::NegInfinity, Math::NegInfinity, Math::NegInfinity))
+, mBoundingCenter(Vector3::Zero)
+, mBoundingRadius(0.0f)
+, mNumLods(1)
 {
-    for (unsigned int i = 0; i < pAnimation->mNumChannels; i++)
-    {
-        const aiNodeAnim* pNodeAnim = pAnimation->mChannels[i];
-        if (std::string(pNodeAnim->mNodeName.data) == nodeName)
-        {
-            return pNodeAnim;
-        }
-    }
-    return nullptr;
+}
+
+Mesh::~Mesh()
+{
+    // shared_ptr がクリアされれば VAO は自動解放
+    mVertexArray.clear();
 }
 
 //==============================================================
 // 位置キー補間
+//  - 圧縮済みトラックは補間に使う 2 キーだけを展開する
 //==============================================================
 void Mesh::CalcInterpolatedPosition(
     Vector3& outVec,
     float animationTime,
-    const aiNodeAnim* pNodeAnim)
+    const NodeAnimation& nodeAnim,
+    unsigned int* cursor)
 {
-    if (pNodeAnim->mNumPositionKeys == 1)
+    using namespace AnimationCompression;
+
+    const auto& times = nodeAnim.mPositionTimes;
+    const uint16_t* packed = nodeAnim.mPackedPositions.data();
+    if (times.size() == 1)
     {
-        outVec.Set(
-            pNodeAnim->mPositionKeys[0].mValue.x,
-            pNodeAnim->mPositionKeys[0].mValue.y,
-            pNodeAnim->mPositionKeys[0].mValue.z);
+        outVec = nodeAnim.mIsCompressed
+            ? DecodeVector3(packed, nodeAnim.mPositionMin, nodeAnim.mPositionExtent)
+            : nodeAnim.mPositions[0];
         return;
     }
 
-    unsigned int index = FindPosition(animationTime, pNodeAnim);
+    unsigned int index = FindKey(animationTime, times, cursor);
     unsigned int nextIndex = index + 1;
-    assert(nextIndex < pNodeAnim->mNumPositionKeys);
-
-    float deltaTime = (float)(
-        pNodeAnim->mPositionKeys[nextIndex].mTime -
-        pNodeAnim->mPositionKeys[index].mTime);
-
-    float factor = (animationTime -
-        (float)pNodeAnim->mPositionKeys[index].mTime) / deltaTime;
 
+    float deltaTime = times[nextIndex] - times[index];
+    float factor = (animationTime - times[index]) / deltaTime;
     factor = std::clamp(factor, 0.0f, 1.0f);
 
-    const aiVector3D& start = pNodeAnim->mPositionKeys[index].mValue;
-    const aiVector3D& end   = pNodeAnim->mPositionKeys[nextIndex].mValue;
-
-    aiVector3D delta = end - start;
-    aiVector3D result = start + factor * delta;
-
-    outVec.Set(result.x, result.y, result.z);
+    if (nodeAnim.mIsCompressed)
+    {
+        outVec = Vector3::Lerp(
+            DecodeVector3(packed + index * 3,     nodeAnim.mPositionMin, nodeAnim.mPositionExtent),
+            DecodeVector3(packed + nextIndex * 3, nodeAnim.mPositionMin, nodeAnim.mPositionExtent),
+            factor);
+        return;
+    }
+    outVec = Vector3::Lerp(nodeAnim.mPositions[index], nodeAnim.mPositions[nextIndex], factor);
 }
 
 //==============================================================
@@ -199,40 +254,35 @@ void Mesh::CalcInterpolatedPosition(
 void Mesh::CalcInterpolatedRotation(
     Quaternion& outVec,
     float animationTime,
-    const aiNodeAnim* pNodeAnim)
+    const NodeAnimation& nodeAnim,
+    unsigned int* cursor)
 {
-    if (pNodeAnim->mNumRotationKeys == 1)
+    using namespace AnimationCompression;
+
+    const auto& times = nodeAnim.mRotationTimes;
+    const uint16_t* packed = nodeAnim.mPackedRotations.data();
+    if (times.size() == 1)
     {
-        outVec.Set(
-            pNodeAnim->mRotationKeys[0].mValue.x,
-            pNodeAnim->mRotationKeys[0].mValue.y,
-            pNodeAnim->mRotationKeys[0].mValue.z,
-            pNodeAnim->mRotationKeys[0].mValue.w);
+        outVec = nodeAnim.mIsCompressed ? DecodeQuaternion(packed) : nodeAnim.mRotations[0];
         return;
     }
 
-    unsigned int index = FindRotation(animationTime, pNodeAnim);
+    unsigned int index = FindKey(animationTime, times, cursor);
     unsigned int nextIndex = index + 1;
-    assert(nextIndex < pNodeAnim->mNumRotationKeys);
-
-    float deltaTime =
-        (float)(pNodeAnim->mRotationKeys[nextIndex].mTime -
-                pNodeAnim->mRotationKeys[index].mTime);
-
-    float factor = (animationTime -
-        (float)pNodeAnim->mRotationKeys[index].mTime) / deltaTime;
 
+    float deltaTime = times[nextIndex] - times[index];
+    float factor = (animationTime - times[index]) / deltaTime;
     factor = std::clamp(factor, 0.0f, 1.0f);
 
-    const aiQuaternion& start = pNodeAnim->mRotationKeys[index].mValue;
-    const aiQuaternion& end   = pNodeAnim->mRotationKeys[nextIndex].mValue;
-
-    aiQuaternion q;
-    aiQuaternion::Interpolate(q, start, end, factor);
-    q.Normalize();
-
-    outVec.Set(q.x, q.y, q.z, q.w);
-    outVec.Normalize();
+    // Slerp は最短経路＋正規化済み
+    if (nodeAnim.mIsCompressed)
+    {
+        outVec = Quaternion::Slerp(DecodeQuaternion(packed + index * 3),
+                                   DecodeQuaternion(packed + nextIndex * 3),
+                                   factor);
+        return;
+    }
+    outVec = Quaternion::Slerp(nodeAnim.mRotations[index], nodeAnim.mRotations[nextIndex], factor);
 }
 
 //==============================================================
@@ -241,86 +291,79 @@ void Mesh::CalcInterpolatedRotation(
 void Mesh::CalcInterpolatedScaling(
     Vector3& outVec,
     float animationTime,
-    const aiNodeAnim* pNodeAnim)
+    const NodeAnimation& nodeAnim,
+    unsigned int* cursor)
 {
-    if (pNodeAnim->mNumScalingKeys == 1)
+    using namespace AnimationCompression;
+
+    const auto& times = nodeAnim.mScalingTimes;
+    const uint16_t* packed = nodeAnim.mPackedScalings.data();
+    if (times.size() == 1)
     {
-        outVec.Set(
-            pNodeAnim->mScalingKeys[0].mValue.x,
-            pNodeAnim->mScalingKeys[0].mValue.y,
-            pNodeAnim->mScalingKeys[0].mValue.z);
+        outVec = nodeAnim.mIsCompressed
+            ? DecodeVector3(packed, nodeAnim.mScalingMin, nodeAnim.mScalingExtent)
+            : nodeAnim.mScalings[0];
         return;
     }
 
-    unsigned int index = FindScaling(animationTime, pNodeAnim);
+    unsigned int index = FindKey(animationTime, times, cursor);
     unsigned int nextIndex = index + 1;
-    assert(nextIndex < pNodeAnim->mNumScalingKeys);
-
-    float deltaTime =
-        (float)(pNodeAnim->mScalingKeys[nextIndex].mTime -
-                pNodeAnim->mScalingKeys[index].mTime);
-
-    float factor = (animationTime -
-        (float)pNodeAnim->mScalingKeys[index].mTime) / deltaTime;
 
+    float deltaTime = times[nextIndex] - times[index];
+    float factor = (animationTime - times[index]) / deltaTime;
     factor = std::clamp(factor, 0.0f, 1.0f);
 
-    const aiVector3D& start = pNodeAnim->mScalingKeys[index].mValue;
-    const aiVector3D& end   = pNodeAnim->mScalingKeys[nextIndex].mValue;
-
-    aiVector3D delta = end - start;
-    aiVector3D sc = start + factor * delta;
-
-    outVec.Set(sc.x, sc.y, sc.z);
-}
-
-//==============================================================
-// キーインデックス検索（位置）
-//==============================================================
-unsigned int Mesh::FindPosition(float animationTime, const aiNodeAnim* pNodeAnim)
-{
-    for (unsigned int i = 0; i < pNodeAnim->mNumPositionKeys - 1; i++)
+    if (nodeAnim.mIsCompressed)
     {
-        if (animationTime < (float)pNodeAnim->mPositionKeys[i + 1].mTime)
-        {
-            return i;
-        }
+        outVec = Vector3::Lerp(
+            DecodeVector3(packed + index * 3,     nodeAnim.mScalingMin, nodeAnim.mScalingExtent),
+            DecodeVector3(packed + nextIndex * 3, nodeAnim.mScalingMin, nodeAnim.mScalingExtent),
+            factor);
+        return;
     }
-    return pNodeAnim->mNumPositionKeys - 2;
+    outVec = Vector3::Lerp(nodeAnim.mScalings[index], nodeAnim.mScalings[nextIndex], factor);
 }
 
 //==============================================================
-// キーインデックス検索（回転）
+// キーインデックス検索
+//  - times[i] <= t < times[i + 1] となる i（範囲外は両端に丸める）
+//  - cursor があれば前回位置から前方へ数キーだけ歩く
+//    （通常再生は 1 フレームで 0〜1 キーしか進まない）
+//  - 巻き戻り（ループ / シーク）や大きな飛びは二分探索
 //==============================================================
-unsigned int Mesh::FindRotation(float animationTime, const aiNodeAnim* pNodeAnim)
+unsigned int Mesh::FindKey(float animationTime,
+                           const std::vector<float>& times,
+                           unsigned int* cursor)
 {
-    assert(pNodeAnim->mNumRotationKeys > 0);
+    assert(times.size() >= 2);
+    const unsigned int last = static_cast<unsigned int>(times.size()) - 2;
 
-    for (unsigned int i = 0; i < pNodeAnim->mNumRotationKeys - 1; i++)
+    if (cursor)
     {
-        if (animationTime < (float)pNodeAnim->mRotationKeys[i + 1].mTime)
+        unsigned int i = *cursor;
+        if (i <= last && (i == 0 || times[i] <= animationTime))
         {
-            return i;
+            constexpr int kMaxForwardSteps = 4;
+            for (int step = 0; step < kMaxForwardSteps; step++)
+            {
+                if (i == last || animationTime < times[i + 1])
+                {
+                    *cursor = i;
+                    return i;
+                }
+                i++;
+            }
         }
     }
-    return pNodeAnim->mNumRotationKeys - 2;
-}
-
-//==============================================================
-// キーインデックス検索（スケール）
-//==============================================================
-unsigned int Mesh::FindScaling(float animationTime, const aiNodeAnim* pNodeAnim)
-{
-    assert(pNodeAnim->mNumScalingKeys > 0);
 
-    for (unsigned int i = 0; i < pNodeAnim->mNumScalingKeys - 1; i++)
+    // 先頭・末尾を除いた範囲で「t より大きい最初の時刻」を探す
+    auto it = std::upper_bound(times.begin() + 1, times.end() - 1, animationTime);
+    unsigned int index = static_cast<unsigned int>(it - times.begin()) - 1;
+    if (cursor)
     {
-        if (animationTime < (float)pNodeAnim->mScalingKeys[i + 1].mTime)
-        {
-            return i;
-        }
+        *cursor = index;
     }
-    return pNodeAnim->mNumScalingKeys - 2;
+    return index;
 }
 
 //==============================================================
@@ -369,7 +412,7 @@ void Mesh::LoadBones(const aiMesh* m, std::vector<VertexBoneData>& bones)
 //==============================================================
 // スキンメッシュ（ボーン付き）頂点バッファ生成
 //==============================================================
-void Mesh::CreateMeshBone(const aiMesh* m)
+void Mesh::CreateMeshBone(const aiMesh* m, MeshCacheData& cacheData)
 {
     std::vector<float>         vertexBuffer;   // XYZ
     std::vector<float>         normalBuffer;   // XYZ
@@ -432,26 +475,51 @@ void Mesh::CreateMeshBone(const aiMesh* m)
         indexBuffer.push_back(face.mIndices[2]);
     }
 
-    // VAO を生成
-    mVertexArray.push_back(
-        std::make_shared<VertexArray>(
-            static_cast<unsigned int>(vertexBuffer.size()) / 3,
-            vertexBuffer.data(),
-            normalBuffer.data(),
-            uvBuffer.data(),
-            boneIDs.data(),
-            boneWeights.data(),
-            static_cast<unsigned int>(indexBuffer.size()),
-            indexBuffer.data()));
+    // 頂点キャッシュ / オーバードロー / フェッチ順の最適化
+    OptimizeMeshBuffers(m->mName.C_Str(), vertexBuffer, normalBuffer, uvBuffer,
+                        &boneIDs, &boneWeights, indexBuffer);
+
+    // 量子化インターリーブ形式にパック（24 byte / 頂点）
+    unsigned int numVerts = static_cast<unsigned int>(vertexBuffer.size()) / 3;
+    VertexQuantization quant = VertexFormat::ComputeQuantization(vertexBuffer.data(), numVerts);
+    std::vector<PackedSkinnedVertex> packed;
+    VertexFormat::PackSkinnedVertices(numVerts,
+                                      vertexBuffer.data(),
+                                      normalBuffer.data(),
+                                      uvBuffer.data(),
+                                      boneIDs.data(),
+                                      boneWeights.data(),
+                                      quant,
+                                      packed);
+
+    // 遠距離用の簡略化 LOD（全レベルを連結してキャッシュと共通の形にする）
+    auto lods = BuildLods(vertexBuffer, indexBuffer);
+
+    CachedSubMesh sub;
+    sub.skinned       = true;
+    sub.materialIndex = m->mMaterialIndex;
+    sub.numVerts      = numVerts;
+    sub.quant         = quant;
+    sub.vertices      = cacheData.Retain(packed.data(), packed.size() * sizeof(packed[0]));
+
+    std::vector<unsigned int> allIndices;
+    for (const auto& l : lods)
+    {
+        sub.lodCounts.push_back(static_cast<unsigned int>(l.size()));
+        allIndices.insert(allIndices.end(), l.begin(), l.end());
+    }
+    sub.indices = static_cast<const unsigned int*>(
+        cacheData.Retain(allIndices.data(), allIndices.size() * sizeof(unsigned int)));
 
-    // このメッシュで使うマテリアル番号を覚えておく
-    mVertexArray.back()->SetTextureID(m->mMaterialIndex);
+    // VAO は Upload() で作る（ここはワーカースレッドからも呼ばれる）
+    mNumLods = std::max(mNumLods, static_cast<int>(sub.lodCounts.size()));
+    cacheData.subMeshes.push_back(std::move(sub));
 }
 
 //==============================================================
 // 通常メッシュ（ボーンなし）頂点バッファ生成
 //==============================================================
-void Mesh::CreateMesh(const aiMesh* m)
+void Mesh::CreateMesh(const aiMesh* m, MeshCacheData& cacheData)
 {
     std::vector<float>         vertexBuffer;   // XYZ
     std::vector<float>         normalBuffer;   // XYZ
@@ -493,18 +561,116 @@ void Mesh::CreateMesh(const aiMesh* m)
         indexBuffer.push_back(face.mIndices[2]);
     }
 
-    // VAO を生成
-    mVertexArray.push_back(
-        std::make_shared<VertexArray>(
-            static_cast<unsigned int>(vertexBuffer.size()) / 3,
-            vertexBuffer.data(),
-            normalBuffer.data(),
-            uvBuffer.data(),
-            static_cast<unsigned int>(indexBuffer.size()),
-            indexBuffer.data()));
+    // 頂点キャッシュ / オーバードロー / フェッチ順の最適化
+    OptimizeMeshBuffers(m->mName.C_Str(), vertexBuffer, normalBuffer, uvBuffer,
+                        nullptr, nullptr, indexBuffer);
+
+    // 量子化インターリーブ形式にパック（16 byte / 頂点）
+    unsigned int numVerts = static_cast<unsigned int>(vertexBuffer.size()) / 3;
+    VertexQuantization quant = VertexFormat::ComputeQuantization(vertexBuffer.data(), numVerts);
+    std::vector<PackedVertex> packed;
+    VertexFormat::PackVertices(numVerts,
+                               vertexBuffer.data(),
+                               normalBuffer.data(),
+                               uvBuffer.data(),
+                               quant,
+                               packed);
+
+    // 遠距離用の簡略化 LOD（全レベルを連結してキャッシュと共通の形にする）
+    auto lods = BuildLods(vertexBuffer, indexBuffer);
+
+    CachedSubMesh sub;
+    sub.skinned       = false;
+    sub.materialIndex = m->mMaterialIndex;
+    sub.numVerts      = numVerts;
+    sub.quant         = quant;
+    sub.vertices      = cacheData.Retain(packed.data(), packed.size() * sizeof(packed[0]));
+
+    std::vector<unsigned int> allIndices;
+    for (const auto& l : lods)
+    {
+        sub.lodCounts.push_back(static_cast<unsigned int>(l.size()));
+        allIndices.insert(allIndices.end(), l.begin(), l.end());
+    }
+    sub.indices = static_cast<const unsigned int*>(
+        cacheData.Retain(allIndices.data(), allIndices.size() * sizeof(unsigned int)));
+
+    // VAO は Upload() で作る（ここはワーカースレッドからも呼ばれる）
+    mNumLods = std::max(mNumLods, static_cast<int>(sub.lodCounts.size()));
+    cacheData.subMeshes.push_back(std::move(sub));
+}
+
+//==============================================================
+// LOD 生成
+//  - 二次誤差の辺縮約で LOD1..3 を作る（同じ頂点を共有するので
+//    スキンメッシュでもボーン情報はそのまま使える）
+//  - ついでに LOD 選択用のバウンディングスフィアを更新
+//==============================================================
+std::vector<std::vector<unsigned int>> Mesh::BuildLods(const std::vector<float>& verts,
+                                                       const std::vector<unsigned int>& indices)
+{
+    for (size_t i = 0; i + 2 < verts.size(); i += 3)
+    {
+        mBoundingMin.x = Math::Min(mBoundingMin.x, verts[i]);
+        mBoundingMin.y = Math::Min(mBoundingMin.y, verts[i + 1]);
+        mBoundingMin.z = Math::Min(mBoundingMin.z, verts[i + 2]);
+        mBoundingMax.x = Math::Max(mBoundingMax.x, verts[i]);
+        mBoundingMax.y = Math::Max(mBoundingMax.y, verts[i + 1]);
+        mBoundingMax.z = Math::Max(mBoundingMax.z, verts[i + 2]);
+    }
+    mBoundingCenter = (mBoundingMin + mBoundingMax) * 0.5f;
+    mBoundingRadius = (mBoundingMax - mBoundingCenter).Length();
+
+    auto lods = MeshSimplifier::GenerateLodChain(verts.data(),
+                                                 static_cast<unsigned int>(verts.size() / 3),
+                                                 indices);
+
+    // 簡略化で崩れたキャッシュ順を LOD ごとに並べ直す
+    for (size_t i = 1; i < lods.size(); i++)
+    {
+        MeshOptimizer::OptimizeVertexCache(lods[i], static_cast<unsigned int>(verts.size() / 3));
+    }
+    return lods;
+}
+
+//==============================================================
+// パック済みサブメッシュから VAO を作成
+//  - 頂点 / インデックスは sub が指す領域から直接 GL へ転送する
+//==============================================================
+void Mesh::CreateVertexArray(const CachedSubMesh& sub, const float* verts)
+{
+    std::shared_ptr<VertexArray> va;
+    if (sub.skinned)
+    {
+        va = std::make_shared<VertexArray>(
+            static_cast<const PackedSkinnedVertex*>(sub.vertices),
+            sub.numVerts,
+            sub.quant,
+            verts,
+            sub.indices,
+            sub.lodCounts[0]);
+    }
+    else
+    {
+        va = std::make_shared<VertexArray>(
+            static_cast<const PackedVertex*>(sub.vertices),
+            sub.numVerts,
+            sub.quant,
+            verts,
+            sub.indices,
+            sub.lodCounts[0]);
+    }
 
     // このメッシュで使うマテリアル番号を覚えておく
-    mVertexArray.back()->SetTextureID(m->mMaterialIndex);
+    va->SetTextureID(sub.materialIndex);
+
+    if (sub.lodCounts.size() > 1)
+    {
+        va->SetLodIndices(sub.indices, sub.lodCounts);
+    }
+    mNumLods = std::max(mNumLods, static_cast<int>(sub.lodCounts.size()));
+
+    mVertexArray.push_back(va);
 }
 
 //==============================================================
@@ -518,6 +684,159 @@ void Mesh::CreateMesh(const aiMesh* m)
 bool Mesh::Load(const std::string& fileName,
                 AssetManager* assetMamager,
                 bool isRightHanded)
+{
+    if (!Decode(fileName, assetMamager, isRightHanded))
+    {
+        return false;
+    }
+    Upload(assetMamager, false);
+    return true;
+}
+
+//==============================================================
+// 読み込み前半（GL を使わない）
+//
+// 元ファイルと同じ場所の <ファイル名>.tmesh を先に調べ、
+// 内容ハッシュが一致すれば Assimp を通さずに復元する。
+// パック内のモデルはパック内の .tmesh だけを使い、書き出しはしない。
+//==============================================================
+bool Mesh::Decode(const std::string& fileName,
+                  AssetManager* assetMamager,
+                  bool isRightHanded)
+{
+    const AssetFileSystem& fs = assetMamager->GetFileSystem();
+    const bool packed = fs.IsPacked(fileName);
+
+    std::string fullName  = fs.GetFullPath(fileName);
+    std::string cachePath = fullName + MeshCache::kExtension;
+
+    auto pending = std::make_unique<MeshLoadData>();
+
+    uint64_t hash = 0;
+    bool hasHash = false;
+    bool cached  = false;
+    if (packed)
+    {
+        AssetData source;
+        hasHash = fs.Read(fileName, source);
+        if (hasHash)
+        {
+            hash = MeshCache::HashSourceData(source.GetData(), source.GetSize(), isRightHanded);
+        }
+        cached = hasHash &&
+                 fs.Read(fileName + MeshCache::kExtension, pending->cacheFile) &&
+                 pending->cache.OpenMemory(pending->cacheFile.GetData(),
+                                           pending->cacheFile.GetSize(), hash);
+    }
+    else
+    {
+        hasHash = MeshCache::HashSourceFile(fullName, isRightHanded, hash);
+        cached  = hasHash && pending->cache.Open(cachePath, hash);
+    }
+
+    if (cached)
+    {
+        pending->data = &pending->cache.GetData();
+        LoadFromCache(*pending->data);
+    }
+    else
+    {
+        bool loaded = packed
+            ? LoadFromFile(fileName, isRightHanded, pending->built, &fs)
+            : LoadFromFile(fullName, isRightHanded, pending->built);
+        if (!loaded)
+        {
+            return false;
+        }
+        if (!packed && hasHash && MeshCache::Write(cachePath, hash, pending->built))
+        {
+            std::cerr << "[Mesh] Cache written: " << cachePath << std::endl;
+        }
+        pending->data = &pending->built;
+    }
+
+    // キャッシュには元のキーを残し、メモリ上でだけ圧縮する
+    CompressAnimations(assetMamager->GetAnimationCompression());
+
+    mPending = std::move(pending);
+    return true;
+}
+
+//==============================================================
+// 読み込み後半（メインスレッド）
+//  - VAO とマテリアルを作り、持ち越したデータを捨てる
+//  - 物理判定用の三角形は量子化位置を戻して作る
+//    （誤差は AABB 半径の 1/32767 程度）
+//==============================================================
+void Mesh::Upload(AssetManager* assetMamager, bool asyncTextures)
+{
+    if (!mPending)
+        return;
+
+    const MeshCacheData& cacheData = *mPending->data;
+
+    std::vector<float> verts;
+    for (const auto& sub : cacheData.subMeshes)
+    {
+        const uint8_t* base   = static_cast<const uint8_t*>(sub.vertices);
+        size_t         stride = sub.skinned ? sizeof(PackedSkinnedVertex) : sizeof(PackedVertex);
+
+        verts.resize(sub.numVerts * 3);
+        for (unsigned int i = 0; i < sub.numVerts; i++)
+        {
+            int16_t pos[3];
+            std::memcpy(pos, base + i * stride + offsetof(PackedVertex, pos), sizeof(pos));
+            verts[i * 3]     = std::max(pos[0] / 32767.0f, -1.0f) * sub.quant.scale.x + sub.quant.offset.x;
+            verts[i * 3 + 1] = std::max(pos[1] / 32767.0f, -1.0f) * sub.quant.scale.y + sub.quant.offset.y;
+            verts[i * 3 + 2] = std::max(pos[2] / 32767.0f, -1.0f) * sub.quant.scale.z + sub.quant.offset.z;
+        }
+        CreateVertexArray(sub, verts.data());
+    }
+
+    for (const auto& desc : cacheData.materials)
+    {
+        CreateMaterial(desc, assetMamager, asyncTextures);
+    }
+
+    mPending.reset();
+}
+
+//==============================================================
+// アニメーションの圧縮
+//  - クリップごとのメモリと誤差をログに出す
+//==============================================================
+void Mesh::CompressAnimations(const AnimationCompressionSettings& settings)
+{
+    if (!settings.enabled || mAnimationClips.empty())
+        return;
+
+    size_t rawTotal = 0;
+    size_t packedTotal = 0;
+    for (auto& clip : mAnimationClips)
+    {
+        AnimationCompressionStats stats = AnimationCompression::Compress(clip, settings);
+        rawTotal    += stats.rawBytes;
+        packedTotal += stats.compressedBytes;
+
+        std::cerr << "[Mesh] Clip \"" << clip.mName << "\": "
+                  << stats.rawBytes / 1024 << " KB -> "
+                  << stats.compressedBytes / 1024 << " KB, keys "
+                  << stats.rawKeys << " -> " << stats.keptKeys
+                  << ", max error pos " << stats.maxPositionError
+                  << " rot " << Math::ToDegrees(stats.maxRotationError) << " deg"
+                  << " scale " << stats.maxScaleError << std::endl;
+    }
+    std::cerr << "[Mesh] Animation memory " << rawTotal / 1024 << " KB -> "
+              << packedTotal / 1024 << " KB" << std::endl;
+}
+
+//==============================================================
+// Assimp で読み込み
+//==============================================================
+bool Mesh::LoadFromFile(const std::string& fullName,
+                        bool isRightHanded,
+                        MeshCacheData& cacheData,
+                        const AssetFileSystem* fs)
 {
     unsigned int ASSIMP_LOAD_FLAGS =
         aiProcess_Triangulate |
@@ -538,79 +857,135 @@ bool Mesh::Load(const std::string& fileName,
         ASSIMP_LOAD_FLAGS |= aiProcess_MakeLeftHanded;
     }
 
-    std::string fullName = assetMamager->GetAssetsPath() + fileName;
-    mScene = mImporter.ReadFile(fullName, ASSIMP_LOAD_FLAGS);
-    if (!mScene)
+    // Importer はこの関数内だけで使い、aiScene は抜けるときに解放する
+    Assimp::Importer importer;
+    if (fs)
     {
-        std::cerr << "Assimp Load Error: " << mImporter.GetErrorString() << std::endl;
+        // Importer が解放する
+        importer.SetIOHandler(new PackIOSystem(*fs));
+    }
+    const aiScene* scene = importer.ReadFile(fullName, ASSIMP_LOAD_FLAGS);
+    if (!scene)
+    {
+        std::cerr << "Assimp Load Error: " << importer.GetErrorString() << std::endl;
         return false;
     }
 
     // ルートノードの逆変換（ボーン計算で使用）
-    aiMatrix4x4 inv = mScene->mRootNode->mTransformation;
+    aiMatrix4x4 inv = scene->mRootNode->mTransformation;
     inv = inv.Inverse();
     MatrixAi2Gl(mGlobalInverseTransform, inv);
 
-    LoadMeshData();
-    LoadMaterials(assetMamager);
-    LoadAnimations();
+    LoadMeshData(scene, cacheData);
+    LoadMaterials(scene, cacheData);
+    LoadSkeleton(scene->mRootNode, -1);
+    LoadAnimations(scene);
+    BindSkeleton();
+
+    //----------------------------------------------------------
+    // キャッシュに書き出す残りの情報
+    //----------------------------------------------------------
+    cacheData.globalInverse = mGlobalInverseTransform;
+    cacheData.boundsMin     = mBoundingMin;
+    cacheData.boundsMax     = mBoundingMax;
+    cacheData.numLods       = mNumLods;
+    cacheData.skeleton      = mSkeleton;
+    cacheData.clips         = mAnimationClips;
+
+    cacheData.bones.resize(mNumBones);
+    for (const auto& [name, index] : mBoneMapping)
+    {
+        cacheData.bones[index].name   = name;
+        cacheData.bones[index].offset = mBoneInfo[index].BoneOffset;
+    }
 
     return true;
 }
 
 //==============================================================
-// シーン中の全 aiMesh から VAO を構築
+// キャッシュから復元（GL を使わない部分）
+//  - VAO とマテリアルは Upload() で作る
+//==============================================================
+void Mesh::LoadFromCache(const MeshCacheData& cacheData)
+{
+    mGlobalInverseTransform = cacheData.globalInverse;
+
+    mBoundingMin    = cacheData.boundsMin;
+    mBoundingMax    = cacheData.boundsMax;
+    mBoundingCenter = (mBoundingMin + mBoundingMax) * 0.5f;
+    mBoundingRadius = (mBoundingMax - mBoundingCenter).Length();
+    mNumLods        = std::max(mNumLods, cacheData.numLods);
+
+    mNumBones = static_cast<unsigned int>(cacheData.bones.size());
+    mBoneInfo.resize(mNumBones);
+    for (unsigned int i = 0; i < mNumBones; i++)
+    {
+        mBoneMapping[cacheData.bones[i].name] = i;
+        mBoneInfo[i].BoneOffset = cacheData.bones[i].offset;
+    }
+
+    mSkeleton       = cacheData.skeleton;
+    mAnimationClips = cacheData.clips;
+    BindSkeleton();
+}
+
+//==============================================================
+// シーン中の全 aiMesh をパック済みサブメッシュに変換
 //==============================================================
-void Mesh::LoadMeshData()
+void Mesh::LoadMeshData(const aiScene* scene, MeshCacheData& cacheData)
 {
-    for (int i = 0; i < static_cast<int>(mScene->mNumMeshes); i++)
+    for (int i = 0; i < static_cast<int>(scene->mNumMeshes); i++)
     {
-        aiMesh* m = mScene->mMeshes[i];
+        aiMesh* m = scene->mMeshes[i];
 
         if (m->HasBones())
         {
-            CreateMeshBone(m);
+            CreateMeshBone(m, cacheData);
         }
         else
         {
-            CreateMesh(m);
+            CreateMesh(m, cacheData);
         }
     }
 }
 
 //==============================================================
 // マテリアル読み込み
-// - Ambient / Diffuse / Specular / Shininess を Material に反映
-// - Diffuse テクスチャ（外部 or 埋め込み）を読み込む
+// - Ambient / Diffuse / Specular / Shininess を記述に写す（Material は Upload() で作る）
+// - Diffuse テクスチャ（外部 or 埋め込み）も記述に含める
 //==============================================================
-void Mesh::LoadMaterials(AssetManager* assetMamager)
+void Mesh::LoadMaterials(const aiScene* scene, MeshCacheData& cacheData)
 {
-    for (unsigned int i = 0; i < mScene->mNumMaterials; i++)
+    for (unsigned int i = 0; i < scene->mNumMaterials; i++)
     {
-        aiMaterial* pMaterial = mScene->mMaterials[i];
-        std::shared_ptr<Material> mat = std::make_shared<Material>();
+        aiMaterial* pMaterial = scene->mMaterials[i];
+        CachedMaterial desc;
 
         // 色（Ambient / Diffuse / Specular）
         aiColor3D color(0.f, 0.f, 0.f);
 
         if (AI_SUCCESS == pMaterial->Get(AI_MATKEY_COLOR_AMBIENT, color))
         {
-            mat->SetAmbientColor(Vector3(color.r, color.g, color.b));
+            desc.flags  |= CachedMaterial::HasAmbient;
+            desc.ambient = Vector3(color.r, color.g, color.b);
         }
         if (AI_SUCCESS == pMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, color))
         {
-            mat->SetDiffuseColor(Vector3(color.r, color.g, color.b));
+            desc.flags  |= CachedMaterial::HasDiffuse;
+            desc.diffuse = Vector3(color.r, color.g, color.b);
         }
         if (AI_SUCCESS == pMaterial->Get(AI_MATKEY_COLOR_SPECULAR, color))
         {
-            mat->SetSpecularColor(Vector3(color.r, color.g, color.b));
+            desc.flags   |= CachedMaterial::HasSpecular;
+            desc.specular = Vector3(color.r, color.g, color.b);
         }
 
         // スペキュラー強度
         float shininess = 32.0f;
         if (AI_SUCCESS == pMaterial->Get(AI_MATKEY_SHININESS, shininess))
         {
-            mat->SetSpecPower(shininess);
+            desc.flags    |= CachedMaterial::HasShininess;
+            desc.specPower = shininess;
         }
 
         // Diffuse テクスチャ
@@ -623,67 +998,244 @@ void Mesh::LoadMaterials(AssetManager* assetMamager)
             if (!texPath.empty() && texPath[0] == '*')
             {
                 int index = std::atoi(texPath.c_str() + 1);
-                if (index >= 0 && index < static_cast<int>(mScene->mNumTextures))
+                if (index >= 0 && index < static_cast<int>(scene->mNumTextures))
                 {
-                    aiTexture* aiTex = mScene->mTextures[index];
-                    std::string key = "_EMBED_" + std::to_string(index);
+                    aiTexture* aiTex = scene->mTextures[index];
 
-                    const uint8_t* imageData = reinterpret_cast<const uint8_t*>(aiTex->pcData);
-                    size_t imageSize = (aiTex->mHeight == 0)
+                    desc.flags       |= CachedMaterial::HasEmbedded;
+                    desc.embeddedKey  = "_EMBED_" + std::to_string(index);
+                    desc.embeddedSize = (aiTex->mHeight == 0)
                         ? aiTex->mWidth
                         : aiTex->mWidth * aiTex->mHeight * 4;
 
-                    auto tex = assetMamager->GetEmbeddedTexture(key, imageData, imageSize);
-                    if (tex)
-                    {
-                        mat->SetDiffuseMap(tex);
-                    }
+                    // aiScene はキャッシュ書き出し前に解放されるので複製しておく
+                    desc.embeddedData = static_cast<const uint8_t*>(
+                        cacheData.Retain(aiTex->pcData, desc.embeddedSize));
                 }
             }
             else
             {
                 // 通常のファイルパス
-                auto tex = assetMamager->GetTexture(texPath);
-                if (tex)
-                {
-                    mat->SetDiffuseMap(tex);
-                }
+                desc.flags      |= CachedMaterial::HasTexture;
+                desc.texturePath = texPath;
             }
         }
 
-        mMaterials.push_back(mat);
+        cacheData.materials.push_back(desc);
+    }
+}
+
+//==============================================================
+// マテリアル記述 → Material
+//  - asyncTextures なら外部テクスチャは LoadTextureAsync で頼み、
+//    届くまではプレースホルダで描く（埋め込み画像は元データが
+//    Upload() の後に消えるのでその場で読む）
+//==============================================================
+void Mesh::CreateMaterial(const CachedMaterial& desc,
+                          AssetManager* assetMamager,
+                          bool asyncTextures)
+{
+    std::shared_ptr<Material> mat = std::make_shared<Material>();
+
+    if (desc.flags & CachedMaterial::HasAmbient)   mat->SetAmbientColor(desc.ambient);
+    if (desc.flags & CachedMaterial::HasDiffuse)   mat->SetDiffuseColor(desc.diffuse);
+    if (desc.flags & CachedMaterial::HasSpecular)  mat->SetSpecularColor(desc.specular);
+    if (desc.flags & CachedMaterial::HasShininess) mat->SetSpecPower(desc.specPower);
+
+    std::shared_ptr<Texture> tex;
+    if (desc.flags & CachedMaterial::HasEmbedded)
+    {
+        tex = assetMamager->GetEmbeddedTexture(desc.embeddedKey, desc.embeddedData, desc.embeddedSize);
+    }
+    else if (desc.flags & CachedMaterial::HasTexture)
+    {
+        tex = asyncTextures
+            ? assetMamager->LoadTextureAsync(desc.texturePath).Get()
+            : assetMamager->GetTexture(desc.texturePath);
+    }
+    if (tex)
+    {
+        mat->SetDiffuseMap(tex);
+    }
+
+    mMaterials.push_back(mat);
+}
+
+//==============================================================
+// aiNode 階層をフラット配列へ焼く
+//  - 行きがけ順に追加するので、親は必ず子より前に並ぶ
+//==============================================================
+void Mesh::LoadSkeleton(const aiNode* pNode, int parent)
+{
+    int index = static_cast<int>(mSkeleton.GetNumNodes());
+
+    Matrix4 local;
+    MatrixAi2Gl(local, pNode->mTransformation);
+
+    mSkeleton.mNames.emplace_back(pNode->mName.C_Str());
+    mSkeleton.mParents.push_back(parent);
+    mSkeleton.mLocalBind.push_back(local);
+
+    for (unsigned int i = 0; i < pNode->mNumChildren; i++)
+    {
+        LoadSkeleton(pNode->mChildren[i], index);
     }
 }
 
 //==============================================================
 // シーン内のアニメーションを AnimationClip に変換
+//  - キー列は時刻と値を分けた SoA でエンジン側へコピーする
 //==============================================================
-void Mesh::LoadAnimations()
+void Mesh::LoadAnimations(const aiScene* scene)
 {
     mAnimationClips.clear();
 
-    if (!mScene || mScene->mNumAnimations == 0)
+    if (scene->mNumAnimations == 0)
     {
         std::cerr << "[Mesh] No animations found in scene." << std::endl;
         return;
     }
 
-    std::cerr << "[Mesh] Found " << mScene->mNumAnimations << " animation(s)." << std::endl;
+    std::cerr << "[Mesh] Found " << scene->mNumAnimations << " animation(s)." << std::endl;
 
-    for (unsigned int i = 0; i < mScene->mNumAnimations; i++)
+    for (unsigned int i = 0; i < scene->mNumAnimations; i++)
     {
-        const aiAnimation* anim = mScene->mAnimations[i];
+        const aiAnimation* anim = scene->mAnimations[i];
 
         AnimationClip clip;
-        clip.mAnimation       = anim;
         clip.mName            = anim->mName.C_Str(); // 空文字の場合もあり
         clip.mDuration        = static_cast<float>(anim->mDuration);
         clip.mTicksPerSecond  = (anim->mTicksPerSecond != 0.0)
                                   ? static_cast<float>(anim->mTicksPerSecond)
                                   : 25.0f; // TicksPerSecond が 0 の場合のデフォルト
 
-        mAnimationClips.emplace_back(clip);
+        clip.mChannels.resize(anim->mNumChannels);
+        for (unsigned int c = 0; c < anim->mNumChannels; c++)
+        {
+            const aiNodeAnim* src = anim->mChannels[c];
+            NodeAnimation&    dst = clip.mChannels[c];
+            dst.mNodeName = src->mNodeName.C_Str();
+
+            dst.mPositionTimes.resize(src->mNumPositionKeys);
+            dst.mPositions.resize(src->mNumPositionKeys);
+            for (unsigned int k = 0; k < src->mNumPositionKeys; k++)
+            {
+                const aiVectorKey& key = src->mPositionKeys[k];
+                dst.mPositionTimes[k] = static_cast<float>(key.mTime);
+                dst.mPositions[k]     = Vector3(key.mValue.x, key.mValue.y, key.mValue.z);
+            }
+
+            dst.mRotationTimes.resize(src->mNumRotationKeys);
+            dst.mRotations.resize(src->mNumRotationKeys);
+            for (unsigned int k = 0; k < src->mNumRotationKeys; k++)
+            {
+                const aiQuatKey& key = src->mRotationKeys[k];
+                dst.mRotationTimes[k] = static_cast<float>(key.mTime);
+                dst.mRotations[k].Set(key.mValue.x, key.mValue.y, key.mValue.z, key.mValue.w);
+                dst.mRotations[k].Normalize();
+            }
+
+            dst.mScalingTimes.resize(src->mNumScalingKeys);
+            dst.mScalings.resize(src->mNumScalingKeys);
+            for (unsigned int k = 0; k < src->mNumScalingKeys; k++)
+            {
+                const aiVectorKey& key = src->mScalingKeys[k];
+                dst.mScalingTimes[k] = static_cast<float>(key.mTime);
+                dst.mScalings[k]     = Vector3(key.mValue.x, key.mValue.y, key.mValue.z);
+            }
+        }
+
+        mAnimationClips.emplace_back(std::move(clip));
+    }
+}
+
+//==============================================================
+// ノード番号 → ボーン番号 / チャネル番号の対応表
+//  - 毎フレームの名前検索をなくすため、読み込み時に 1 回だけ作る
+//  - キーが 1 つも無いチャネルはバインド姿勢のままにする
+//==============================================================
+void Mesh::BindSkeleton()
+{
+    const size_t numNodes = mSkeleton.GetNumNodes();
+
+    std::unordered_map<std::string, int> nodeIndex;
+    nodeIndex.reserve(numNodes);
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        nodeIndex.emplace(mSkeleton.mNames[i], static_cast<int>(i));
+    }
+
+    // ブレンド用にバインド姿勢を TRS へ分解しておく
+    mSkeleton.mBindPose.resize(numNodes);
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        mSkeleton.mBindPose[i] = BoneTransform::FromMatrix(mSkeleton.mLocalBind[i]);
+    }
+
+    // 末端からの段数（子は親より後ろにあるので逆順に 1 回なめる）
+    mSkeleton.mHeights.assign(numNodes, 0);
+    for (size_t i = numNodes; i-- > 1;)
+    {
+        int parent = mSkeleton.mParents[i];
+        if (parent >= 0)
+        {
+            mSkeleton.mHeights[parent] = std::max(mSkeleton.mHeights[parent],
+                                                  mSkeleton.mHeights[i] + 1);
+        }
+    }
+
+    mSkeleton.mBoneIndices.assign(numNodes, -1);
+    for (const auto& [name, bone] : mBoneMapping)
+    {
+        auto iter = nodeIndex.find(name);
+        if (iter != nodeIndex.end())
+        {
+            mSkeleton.mBoneIndices[iter->second] = static_cast<int>(bone);
+        }
+    }
+
+    for (auto& clip : mAnimationClips)
+    {
+        clip.mNodeChannels.assign(numNodes, -1);
+        for (size_t c = 0; c < clip.mChannels.size(); c++)
+        {
+            const NodeAnimation& ch = clip.mChannels[c];
+            if (ch.mPositionTimes.empty() || ch.mRotationTimes.empty() || ch.mScalingTimes.empty())
+            {
+                continue;
+            }
+            auto iter = nodeIndex.find(ch.mNodeName);
+            if (iter != nodeIndex.end())
+            {
+                clip.mNodeChannels[iter->second] = static_cast<int>(c);
+            }
+        }
+    }
+}
+
+//==============================================================
+// 骨格とクリップを直接与える
+//==============================================================
+void Mesh::SetAnimationData(const Skeleton& skeleton,
+                            const std::vector<std::string>& boneNames,
+                            std::vector<AnimationClip> clips)
+{
+    Unload();
+
+    mSkeleton.mNames     = skeleton.mNames;
+    mSkeleton.mParents   = skeleton.mParents;
+    mSkeleton.mLocalBind = skeleton.mLocalBind;
+
+    for (const auto& name : boneNames)
+    {
+        mBoneMapping.emplace(name, static_cast<unsigned int>(mBoneMapping.size()));
     }
+    mNumBones = static_cast<unsigned int>(mBoneMapping.size());
+    mBoneInfo.assign(mNumBones, BoneInfo());
+    mGlobalInverseTransform = Matrix4::Identity;
+
+    mAnimationClips = std::move(clips);
+    BindSkeleton();
 }
 
 //==============================================================
@@ -691,13 +1243,20 @@ void Mesh::LoadAnimations()
 //==============================================================
 void Mesh::Unload()
 {
-    mScene = nullptr;
     mVertexArray.clear();
     mMaterials.clear();
     mAnimationClips.clear();
+    mSkeleton = Skeleton();
     mBoneInfo.clear();
     mBoneMapping.clear();
     mNumBones = 0;
+    mNumLods  = 1;
+
+    // 境界（作り直し・再ロードで前のメッシュの値が残らないように）
+    mBoundingMin    = Vector3(Math::Infinity, Math::Infinity, Math::Infinity);
+    mBoundingMax    = Vector3(Math::NegInfinity, Math::NegInfinity, Math::NegInfinity);
+    mBoundingCenter = Vector3::Zero;
+    mBoundingRadius = 0.0f;
 }
 
 //==============================================================
@@ -715,22 +1274,154 @@ std::shared_ptr<Material> Mesh::GetMaterial(size_t index)
 //==============================================================
 // 指定アニメーションの指定時刻のボーン行列配列を計算
 // outTransforms には「ボーン数ぶん」の行列が詰められる。
+//
+// ノードは親が先に並んでいるので、先頭から 1 回なめるだけでよい。
+// 行列乗算順は ToyLib の Matrix4 に合わせて local * parent。
+//
+// 読むのは Skeleton / BoneInfo / clip だけで、書き込み先は
+// すべて引数なので、別スレッドから同時に呼んでも安全。
 //==============================================================
 void Mesh::ComputePoseAtTime(
     float animationTime,
-    const aiAnimation* pAnimation,
-    std::vector<Matrix4>& outTransforms)
+    const AnimationClip& clip,
+    std::vector<Matrix4>& outTransforms,
+    std::vector<Matrix4>& globalPose,
+    AnimationCursor* cursor,
+    int skipLeafLevels) const
 {
-    Matrix4 identity = Matrix4::Identity;
+    const size_t numNodes = mSkeleton.GetNumNodes();
+    outTransforms.resize(mNumBones, Matrix4::Identity);
+    globalPose.resize(numNodes);
 
-    // ルートノードからボーン階層を再帰的に更新
-    ComputeBoneHierarchy(animationTime, mScene->mRootNode, identity, pAnimation);
+    if (cursor)
+    {
+        cursor->Bind(clip);
+    }
 
-    // FinalTransformation をそのまま出力配列にコピー
-    outTransforms.resize(mNumBones);
-    for (unsigned int i = 0; i < mNumBones; i++)
+    for (size_t i = 0; i < numNodes; i++)
     {
-        outTransforms[i] = mBoneInfo[i].FinalTransformation;
+        // キーがあれば補間、無ければバインド時のローカル変換
+        // （LOD で落とした末端ノードもバインド姿勢）
+        int channel = (i < clip.mNodeChannels.size()) ? clip.mNodeChannels[i] : -1;
+        if (mSkeleton.mHeights[i] < skipLeafLevels)
+        {
+            channel = -1;
+        }
+        Matrix4 local;
+        if (channel >= 0)
+        {
+            unsigned int* keys = cursor ? &cursor->mKeys[channel * 3] : nullptr;
+
+            BoneTransform trs;
+            SampleChannel(trs, animationTime, clip.mChannels[channel], keys);
+
+            // ※ 左手・右手の最終的な系は事前処理フラグで調整済み。
+            local = trs.ToMatrix();
+        }
+        else
+        {
+            local = mSkeleton.mLocalBind[i];
+        }
+
+        // 親のグローバル変換と合成
+        int parent = mSkeleton.mParents[i];
+        globalPose[i] = (parent >= 0) ? local * globalPose[parent] : local;
+
+        // Final = BoneOffset * Global * InvRoot
+        int bone = mSkeleton.mBoneIndices[i];
+        if (bone >= 0)
+        {
+            outTransforms[bone] =
+                mBoneInfo[bone].BoneOffset *
+                globalPose[i] *
+                mGlobalInverseTransform;
+        }
+    }
+}
+
+//==============================================================
+// 1 チャネル分のキー補間
+//==============================================================
+void Mesh::SampleChannel(BoneTransform& out,
+                         float animationTime,
+                         const NodeAnimation& nodeAnim,
+                         unsigned int* keys)
+{
+    CalcInterpolatedScaling(out.mScale, animationTime, nodeAnim, keys ? keys + 2 : nullptr);
+    CalcInterpolatedRotation(out.mRotation, animationTime, nodeAnim, keys ? keys + 1 : nullptr);
+    CalcInterpolatedPosition(out.mTranslation, animationTime, nodeAnim, keys);
+}
+
+//==============================================================
+// ローカル姿勢のサンプリング
+//  - キーの無いノード（と LOD で落とした末端）はバインド姿勢の TRS を入れ、
+//    mAnimated = 0 にする
+//==============================================================
+void Mesh::SampleLocalPose(
+    float animationTime,
+    const AnimationClip& clip,
+    AnimationPose& outPose,
+    AnimationCursor* cursor,
+    int skipLeafLevels) const
+{
+    const size_t numNodes = mSkeleton.GetNumNodes();
+    outPose.Resize(numNodes);
+
+    if (cursor)
+    {
+        cursor->Bind(clip);
+    }
+
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        int channel = (i < clip.mNodeChannels.size()) ? clip.mNodeChannels[i] : -1;
+        if (mSkeleton.mHeights[i] < skipLeafLevels)
+        {
+            channel = -1;
+        }
+        if (channel >= 0)
+        {
+            unsigned int* keys = cursor ? &cursor->mKeys[channel * 3] : nullptr;
+            SampleChannel(outPose.mLocals[i], animationTime, clip.mChannels[channel], keys);
+            outPose.mAnimated[i] = 1;
+        }
+        else
+        {
+            outPose.mLocals[i]   = mSkeleton.mBindPose[i];
+            outPose.mAnimated[i] = 0;
+        }
+    }
+}
+
+//==============================================================
+// ローカル姿勢 → スキニング行列
+//  - ComputePoseAtTime() の階層計算部分と同じ
+//==============================================================
+void Mesh::ComputeSkinningMatrices(
+    const AnimationPose& pose,
+    std::vector<Matrix4>& outTransforms,
+    std::vector<Matrix4>& globalPose) const
+{
+    const size_t numNodes = std::min(mSkeleton.GetNumNodes(), pose.GetNumNodes());
+    outTransforms.resize(mNumBones, Matrix4::Identity);
+    globalPose.resize(numNodes);
+
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        Matrix4 local = pose.mAnimated[i] ? pose.mLocals[i].ToMatrix()
+                                          : mSkeleton.mLocalBind[i];
+
+        int parent = mSkeleton.mParents[i];
+        globalPose[i] = (parent >= 0) ? local * globalPose[parent] : local;
+
+        int bone = mSkeleton.mBoneIndices[i];
+        if (bone >= 0)
+        {
+            outTransforms[bone] =
+                mBoneInfo[bone].BoneOffset *
+                globalPose[i] *
+                mGlobalInverseTransform;
+        }
     }
 }
 
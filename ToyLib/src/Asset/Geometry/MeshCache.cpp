@@ -0,0 +1,573 @@
+#include "Asset/Geometry/MeshCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+namespace toy {
+
+namespace {
+
+//==============================================================
+// ファイルヘッダ（先頭 128 byte）
+//==============================================================
+struct FileHeader
+{
+    char     magic[4];        // "TMSH"
+    uint32_t version;
+    uint64_t sourceHash;
+    uint32_t numSubMeshes;
+    uint32_t numMaterials;
+    uint32_t numBones;
+    uint32_t numNodes;
+    uint32_t numClips;
+    int32_t  numLods;
+    float    boundsMin[3];
+    float    boundsMax[3];
+    float    globalInverse[16];
+};
+static_assert(sizeof(FileHeader) == 128, "FileHeader must be 128 bytes");
+
+const char kMagic[4] = { 'T', 'M', 'S', 'H' };
+
+// 頂点ブロブの先頭アライメント
+constexpr size_t kBlobAlign = 16;
+
+//==============================================================
+// 書き出し用バッファ
+//==============================================================
+struct ByteWriter
+{
+    std::vector<uint8_t> buf;
+
+    void PutBytes(const void* data, size_t size)
+    {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        buf.insert(buf.end(), p, p + size);
+    }
+
+    template <typename T>
+    void Put(const T& v)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "POD only");
+        PutBytes(&v, sizeof(T));
+    }
+
+    void PutString(const std::string& s)
+    {
+        Put(static_cast<uint32_t>(s.size()));
+        PutBytes(s.data(), s.size());
+    }
+
+    void PutVector3(const Vector3& v)
+    {
+        Put(v.x); Put(v.y); Put(v.z);
+    }
+
+    void PutMatrix(const Matrix4& m)
+    {
+        PutBytes(&m.mat[0][0], sizeof(float) * 16);
+    }
+
+    void Align(size_t alignment)
+    {
+        while (buf.size() % alignment != 0) buf.push_back(0);
+    }
+};
+
+//==============================================================
+// 読み込み用カーソル（範囲外アクセスで ok = false）
+//==============================================================
+struct ByteReader
+{
+    const uint8_t* base;
+    size_t         size;
+    size_t         pos = 0;
+    bool           ok  = true;
+
+    const uint8_t* GetBytes(size_t n)
+    {
+        if (!ok || n > size - pos)
+        {
+            ok = false;
+            return nullptr;
+        }
+        const uint8_t* p = base + pos;
+        pos += n;
+        return p;
+    }
+
+    template <typename T>
+    T Get()
+    {
+        T v{};
+        if (const uint8_t* p = GetBytes(sizeof(T)))
+        {
+            std::memcpy(&v, p, sizeof(T));
+        }
+        return v;
+    }
+
+    std::string GetString()
+    {
+        uint32_t len = Get<uint32_t>();
+        const uint8_t* p = GetBytes(len);
+        return p ? std::string(reinterpret_cast<const char*>(p), len) : std::string();
+    }
+
+    Vector3 GetVector3()
+    {
+        float x = Get<float>();
+        float y = Get<float>();
+        float z = Get<float>();
+        return Vector3(x, y, z);
+    }
+
+    Matrix4 GetMatrix()
+    {
+        Matrix4 m;
+        if (const uint8_t* p = GetBytes(sizeof(float) * 16))
+        {
+            std::memcpy(&m.mat[0][0], p, sizeof(float) * 16);
+        }
+        return m;
+    }
+
+    void Align(size_t alignment)
+    {
+        size_t pad = (alignment - pos % alignment) % alignment;
+        GetBytes(pad);
+    }
+};
+
+//==============================================================
+// キー列（時刻配列 → 値配列の順）
+//==============================================================
+void PutTrack(ByteWriter& w, const std::vector<float>& times, const std::vector<Vector3>& values)
+{
+    w.Put(static_cast<uint32_t>(times.size()));
+    w.PutBytes(times.data(), sizeof(float) * times.size());
+    for (const auto& v : values)
+    {
+        w.PutVector3(v);
+    }
+}
+
+void PutTrack(ByteWriter& w, const std::vector<float>& times, const std::vector<Quaternion>& values)
+{
+    w.Put(static_cast<uint32_t>(times.size()));
+    w.PutBytes(times.data(), sizeof(float) * times.size());
+    for (const auto& q : values)
+    {
+        w.Put(q.x); w.Put(q.y); w.Put(q.z); w.Put(q.w);
+    }
+}
+
+bool GetTimes(ByteReader& r, std::vector<float>& times)
+{
+    uint32_t n = r.Get<uint32_t>();
+    const uint8_t* p = r.ok ? r.GetBytes(sizeof(float) * static_cast<size_t>(n)) : nullptr;
+    if (!p) return false;
+    times.resize(n);
+    std::memcpy(times.data(), p, sizeof(float) * n);
+    return true;
+}
+
+void GetTrack(ByteReader& r, std::vector<float>& times, std::vector<Vector3>& values)
+{
+    if (!GetTimes(r, times)) return;
+    values.resize(times.size());
+    for (auto& v : values)
+    {
+        v = r.GetVector3();
+    }
+}
+
+void GetTrack(ByteReader& r, std::vector<float>& times, std::vector<Quaternion>& values)
+{
+    if (!GetTimes(r, times)) return;
+    values.resize(times.size());
+    for (auto& q : values)
+    {
+        float x = r.Get<float>();
+        float y = r.Get<float>();
+        float z = r.Get<float>();
+        float w = r.Get<float>();
+        q.Set(x, y, z, w);
+    }
+}
+
+} // namespace
+
+//==============================================================
+// 変換時バッファの保持
+//==============================================================
+const void* MeshCacheData::Retain(const void* data, size_t size)
+{
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    mStorage.emplace_back(p, p + size);
+    return mStorage.back().data();
+}
+
+MeshCache::MeshCache()
+: mMapped(nullptr)
+, mSize(0)
+{
+}
+
+MeshCache::~MeshCache()
+{
+    Close();
+}
+
+//==============================================================
+// 内容ハッシュ（FNV-1a 64bit）
+//==============================================================
+namespace {
+struct SourceHasher
+{
+    static constexpr uint64_t kPrime = 1099511628211ull;
+    uint64_t hash = 14695981039346656037ull;
+
+    // 形式バージョンと読み込みオプションも鍵に含める
+    explicit SourceHasher(bool isRightHanded)
+    {
+        uint32_t salt[2] = { MeshCache::kVersion, isRightHanded ? 1u : 0u };
+        Mix(reinterpret_cast<const uint8_t*>(salt), sizeof(salt));
+    }
+
+    void Mix(const uint8_t* p, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            hash ^= p[i];
+            hash *= kPrime;
+        }
+    }
+};
+}
+
+bool MeshCache::HashSourceFile(const std::string& path,
+                               bool isRightHanded,
+                               uint64_t& outHash)
+{
+    FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) return false;
+
+    SourceHasher hasher(isRightHanded);
+
+    std::vector<uint8_t> chunk(1 << 16);
+    size_t n;
+    while ((n = std::fread(chunk.data(), 1, chunk.size(), fp)) > 0)
+    {
+        hasher.Mix(chunk.data(), n);
+    }
+    std::fclose(fp);
+
+    outHash = hasher.hash;
+    return true;
+}
+
+uint64_t MeshCache::HashSourceData(const void* data, size_t size, bool isRightHanded)
+{
+    SourceHasher hasher(isRightHanded);
+    hasher.Mix(static_cast<const uint8_t*>(data), size);
+    return hasher.hash;
+}
+
+//==============================================================
+// mmap して解析
+//==============================================================
+bool MeshCache::Open(const std::string& cachePath, uint64_t sourceHash)
+{
+    Close();
+
+    if (!mFile.Open(cachePath))
+    {
+        return false;
+    }
+
+    // 全体をすぐ読むので先読みを促す
+    mFile.Prefetch(0, mFile.GetSize());
+    return OpenMemory(mFile.GetData(), mFile.GetSize(), sourceHash);
+}
+
+//==============================================================
+// メモリ上のキャッシュを解析（アセットパック内のエントリなど）
+//==============================================================
+bool MeshCache::OpenMemory(const void* data, size_t size, uint64_t sourceHash)
+{
+    if (!data || size < sizeof(FileHeader))
+    {
+        Close();
+        return false;
+    }
+
+    mMapped = static_cast<const uint8_t*>(data);
+    mSize   = size;
+    if (!Parse(sourceHash))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void MeshCache::Close()
+{
+    mFile.Close();
+    mMapped = nullptr;
+    mSize   = 0;
+    mData   = MeshCacheData();
+}
+
+//==============================================================
+// 解析
+//  - 頂点・インデックスはコピーせずマップ領域を指す
+//  - アニメーション等の小さいデータはエンジン側の構造体へコピー
+//==============================================================
+bool MeshCache::Parse(uint64_t sourceHash)
+{
+    ByteReader r{ mMapped, mSize };
+
+    FileHeader header = r.Get<FileHeader>();
+    if (!r.ok ||
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion ||
+        header.sourceHash != sourceHash)
+    {
+        return false;
+    }
+
+    MeshCacheData& d = mData;
+    d.boundsMin = Vector3(header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]);
+    d.boundsMax = Vector3(header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]);
+    d.numLods   = header.numLods;
+    std::memcpy(&d.globalInverse.mat[0][0], header.globalInverse, sizeof(float) * 16);
+
+    //----------------------------------------------------------
+    // サブメッシュ
+    //----------------------------------------------------------
+    d.subMeshes.resize(header.numSubMeshes);
+    for (auto& sub : d.subMeshes)
+    {
+        sub.skinned       = r.Get<uint32_t>() != 0;
+        sub.materialIndex = r.Get<uint32_t>();
+        sub.numVerts      = r.Get<uint32_t>();
+        uint32_t numLods  = r.Get<uint32_t>();
+        if (!r.ok || numLods == 0 || numLods > 16) return false;
+
+        size_t totalIndices = 0;
+        sub.lodCounts.resize(numLods);
+        for (auto& c : sub.lodCounts)
+        {
+            c = r.Get<uint32_t>();
+            totalIndices += c;
+        }
+        sub.quant.offset = r.GetVector3();
+        sub.quant.scale  = r.GetVector3();
+
+        size_t stride = sub.skinned ? sizeof(PackedSkinnedVertex) : sizeof(PackedVertex);
+        if (!r.ok || sub.numVerts > mSize / stride || totalIndices > mSize / sizeof(unsigned int))
+        {
+            return false;
+        }
+
+        r.Align(kBlobAlign);
+        sub.vertices = r.GetBytes(stride * sub.numVerts);
+        sub.indices  = reinterpret_cast<const unsigned int*>(r.GetBytes(sizeof(unsigned int) * totalIndices));
+        if (!r.ok) return false;
+
+        // 壊れたキャッシュで GPU の範囲外を読まないように
+        for (size_t i = 0; i < totalIndices; i++)
+        {
+            if (sub.indices[i] >= sub.numVerts) return false;
+        }
+    }
+
+    //----------------------------------------------------------
+    // マテリアル
+    //----------------------------------------------------------
+    d.materials.resize(header.numMaterials);
+    for (auto& mat : d.materials)
+    {
+        mat.flags       = r.Get<uint32_t>();
+        mat.ambient     = r.GetVector3();
+        mat.diffuse     = r.GetVector3();
+        mat.specular    = r.GetVector3();
+        mat.specPower   = r.Get<float>();
+        mat.texturePath = r.GetString();
+        mat.embeddedKey = r.GetString();
+        uint64_t size   = r.Get<uint64_t>();
+        if (!r.ok || size > mSize) return false;
+
+        r.Align(kBlobAlign);
+        mat.embeddedSize = static_cast<size_t>(size);
+        mat.embeddedData = size ? r.GetBytes(mat.embeddedSize) : nullptr;
+    }
+
+    //----------------------------------------------------------
+    // ボーン
+    //----------------------------------------------------------
+    d.bones.resize(header.numBones);
+    for (auto& bone : d.bones)
+    {
+        bone.name   = r.GetString();
+        bone.offset = r.GetMatrix();
+    }
+
+    //----------------------------------------------------------
+    // スケルトン（親は必ず自分より前）
+    //----------------------------------------------------------
+    Skeleton& skel = d.skeleton;
+    skel.mNames.resize(header.numNodes);
+    skel.mParents.resize(header.numNodes);
+    skel.mLocalBind.resize(header.numNodes);
+    for (uint32_t i = 0; i < header.numNodes; i++)
+    {
+        skel.mNames[i]     = r.GetString();
+        skel.mParents[i]   = r.Get<int32_t>();
+        skel.mLocalBind[i] = r.GetMatrix();
+        if (!r.ok || skel.mParents[i] >= static_cast<int>(i)) return false;
+    }
+
+    //----------------------------------------------------------
+    // アニメーション
+    //----------------------------------------------------------
+    d.clips.resize(header.numClips);
+    for (auto& clip : d.clips)
+    {
+        clip.mName           = r.GetString();
+        clip.mDuration       = r.Get<float>();
+        clip.mTicksPerSecond = r.Get<float>();
+        uint32_t numChannels = r.Get<uint32_t>();
+        if (!r.ok || numChannels > header.numNodes) return false;
+
+        clip.mChannels.resize(numChannels);
+        for (auto& ch : clip.mChannels)
+        {
+            ch.mNodeName = r.GetString();
+            GetTrack(r, ch.mPositionTimes, ch.mPositions);
+            GetTrack(r, ch.mRotationTimes, ch.mRotations);
+            GetTrack(r, ch.mScalingTimes, ch.mScalings);
+        }
+    }
+
+    return r.ok;
+}
+
+//==============================================================
+// 書き出し
+//==============================================================
+bool MeshCache::Write(const std::string& cachePath,
+                      uint64_t sourceHash,
+                      const MeshCacheData& d)
+{
+    ByteWriter w;
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version      = kVersion;
+    header.sourceHash   = sourceHash;
+    header.numSubMeshes = static_cast<uint32_t>(d.subMeshes.size());
+    header.numMaterials = static_cast<uint32_t>(d.materials.size());
+    header.numBones     = static_cast<uint32_t>(d.bones.size());
+    header.numNodes     = static_cast<uint32_t>(d.skeleton.GetNumNodes());
+    header.numClips     = static_cast<uint32_t>(d.clips.size());
+    header.numLods      = d.numLods;
+    header.boundsMin[0] = d.boundsMin.x; header.boundsMin[1] = d.boundsMin.y; header.boundsMin[2] = d.boundsMin.z;
+    header.boundsMax[0] = d.boundsMax.x; header.boundsMax[1] = d.boundsMax.y; header.boundsMax[2] = d.boundsMax.z;
+    std::memcpy(header.globalInverse, &d.globalInverse.mat[0][0], sizeof(float) * 16);
+    w.Put(header);
+
+    for (const auto& sub : d.subMeshes)
+    {
+        w.Put(static_cast<uint32_t>(sub.skinned ? 1 : 0));
+        w.Put(static_cast<uint32_t>(sub.materialIndex));
+        w.Put(static_cast<uint32_t>(sub.numVerts));
+        w.Put(static_cast<uint32_t>(sub.lodCounts.size()));
+        size_t totalIndices = 0;
+        for (unsigned int c : sub.lodCounts)
+        {
+            w.Put(static_cast<uint32_t>(c));
+            totalIndices += c;
+        }
+        w.PutVector3(sub.quant.offset);
+        w.PutVector3(sub.quant.scale);
+
+        size_t stride = sub.skinned ? sizeof(PackedSkinnedVertex) : sizeof(PackedVertex);
+        w.Align(kBlobAlign);
+        w.PutBytes(sub.vertices, stride * sub.numVerts);
+        w.PutBytes(sub.indices, sizeof(unsigned int) * totalIndices);
+    }
+
+    for (const auto& mat : d.materials)
+    {
+        w.Put(mat.flags);
+        w.PutVector3(mat.ambient);
+        w.PutVector3(mat.diffuse);
+        w.PutVector3(mat.specular);
+        w.Put(mat.specPower);
+        w.PutString(mat.texturePath);
+        w.PutString(mat.embeddedKey);
+        w.Put(static_cast<uint64_t>(mat.embeddedSize));
+        w.Align(kBlobAlign);
+        if (mat.embeddedSize)
+        {
+            w.PutBytes(mat.embeddedData, mat.embeddedSize);
+        }
+    }
+
+    for (const auto& bone : d.bones)
+    {
+        w.PutString(bone.name);
+        w.PutMatrix(bone.offset);
+    }
+
+    for (size_t i = 0; i < d.skeleton.GetNumNodes(); i++)
+    {
+        w.PutString(d.skeleton.mNames[i]);
+        w.Put(static_cast<int32_t>(d.skeleton.mParents[i]));
+        w.PutMatrix(d.skeleton.mLocalBind[i]);
+    }
+
+    for (const auto& clip : d.clips)
+    {
+        w.PutString(clip.mName);
+        w.Put(clip.mDuration);
+        w.Put(clip.mTicksPerSecond);
+        w.Put(static_cast<uint32_t>(clip.mChannels.size()));
+        for (const auto& ch : clip.mChannels)
+        {
+            w.PutString(ch.mNodeName);
+            PutTrack(w, ch.mPositionTimes, ch.mPositions);
+            PutTrack(w, ch.mRotationTimes, ch.mRotations);
+            PutTrack(w, ch.mScalingTimes, ch.mScalings);
+        }
+    }
+
+    //----------------------------------------------------------
+    // 途中で落ちても壊れたキャッシュを残さないよう一時ファイル経由
+    //----------------------------------------------------------
+    std::string tmpPath = cachePath + ".tmp";
+    FILE* fp = std::fopen(tmpPath.c_str(), "wb");
+    if (!fp)
+    {
+        std::cerr << "[MeshCache] Cannot write: " << tmpPath << std::endl;
+        return false;
+    }
+    bool written = std::fwrite(w.buf.data(), 1, w.buf.size(), fp) == w.buf.size();
+    written = (std::fclose(fp) == 0) && written;
+
+    std::remove(cachePath.c_str());
+    if (!written || std::rename(tmpPath.c_str(), cachePath.c_str()) != 0)
+    {
+        std::remove(tmpPath.c_str());
+        std::cerr << "[MeshCache] Write failed: " << cachePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace toy
@@ -0,0 +1,313 @@
+#include "Asset/Geometry/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace toy {
+namespace MeshOptimizer {
+
+//==============================================================
+// ACMR（Average Cache Miss Ratio）
+//==============================================================
+float ComputeACMR(const std::vector<unsigned int>& indices,
+                  unsigned int numVerts,
+                  unsigned int cacheSize)
+{
+    if (indices.size() < 3) return 0.0f;
+
+    // 各頂点が FIFO に入った時刻（0 = 未登録）
+    std::vector<unsigned int> stamp(numVerts, 0);
+    unsigned int time   = cacheSize + 1;
+    unsigned int misses = 0;
+
+    for (unsigned int v : indices)
+    {
+        if (time - stamp[v] > cacheSize)
+        {
+            stamp[v] = time++;
+            misses++;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+}
+
+//==============================================================
+// Tipsify（Sander et al. 2007）
+//  - 「扇の中心」となる頂点 f の未出力三角形をまとめて出力し、
+//    次の中心はキャッシュに残っていて、かつ残り三角形が
+//    キャッシュからあふれない頂点を優先する。
+//  - 候補が無ければデッドエンドスタック → 先頭からの走査で再開
+//    （ここがクラスタ境界になる）
+//==============================================================
+void OptimizeVertexCache(std::vector<unsigned int>& indices,
+                         unsigned int numVerts,
+                         std::vector<unsigned int>* outClusters,
+                         unsigned int cacheSize)
+{
+    const size_t numTris = indices.size() / 3;
+    if (outClusters) outClusters->clear();
+    if (numTris == 0 || numVerts == 0) return;
+
+    //----------------------------------------------------------
+    // 頂点 → 三角形の隣接表（CSR）
+    //----------------------------------------------------------
+    std::vector<unsigned int> live(numVerts, 0);
+    for (unsigned int v : indices) live[v]++;
+
+    std::vector<unsigned int> offsets(numVerts + 1, 0);
+    for (unsigned int v = 0; v < numVerts; v++) offsets[v + 1] = offsets[v] + live[v];
+
+    std::vector<unsigned int> adjacency(indices.size());
+    {
+        std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < indices.size(); i++)
+        {
+            adjacency[fill[indices[i]]++] = static_cast<unsigned int>(i / 3);
+        }
+    }
+
+    std::vector<unsigned int> cacheTime(numVerts, 0);
+    std::vector<bool>         emitted(numTris, false);
+    std::vector<unsigned int> deadEnd;
+    std::vector<unsigned int> candidates;
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+
+    unsigned int time   = cacheSize + 1;
+    unsigned int cursor = 0;
+    int          fan    = static_cast<int>(indices[0]);
+
+    if (outClusters) outClusters->push_back(0);
+
+    while (fan >= 0)
+    {
+        candidates.clear();
+
+        // 扇の中心 f に接する未出力三角形を出力
+        for (unsigned int a = offsets[fan]; a < offsets[fan + 1]; a++)
+        {
+            unsigned int t = adjacency[a];
+            if (emitted[t]) continue;
+
+            for (int k = 0; k < 3; k++)
+            {
+                unsigned int v = indices[t * 3 + k];
+                result.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                live[v]--;
+                if (time - cacheTime[v] > cacheSize)
+                {
+                    cacheTime[v] = time++;
+                }
+            }
+            emitted[t] = true;
+        }
+
+        //------------------------------------------------------
+        // 次の中心を選ぶ
+        //------------------------------------------------------
+        int best = -1;
+        int bestPriority = -1;
+        for (unsigned int v : candidates)
+        {
+            if (live[v] == 0) continue;
+
+            // 残り三角形を出力してもキャッシュに収まるなら「古さ」を優先度にする
+            int priority = 0;
+            if (time - cacheTime[v] + 2 * live[v] <= cacheSize)
+            {
+                priority = static_cast<int>(time - cacheTime[v]);
+            }
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                best = static_cast<int>(v);
+            }
+        }
+
+        if (best < 0)
+        {
+            // デッドエンド：最近出力した頂点から生きているものを探す
+            while (!deadEnd.empty())
+            {
+                unsigned int d = deadEnd.back();
+                deadEnd.pop_back();
+                if (live[d] > 0)
+                {
+                    best = static_cast<int>(d);
+                    break;
+                }
+            }
+
+            // それも無ければ頂点番号順に走査（キャッシュは途切れる）
+            if (best < 0)
+            {
+                while (cursor < numVerts && live[cursor] == 0) cursor++;
+                if (cursor < numVerts)
+                {
+                    best = static_cast<int>(cursor);
+                }
+            }
+
+            if (best >= 0 && outClusters && result.size() / 3 < numTris)
+            {
+                outClusters->push_back(static_cast<unsigned int>(result.size() / 3));
+            }
+        }
+
+        fan = best;
+    }
+
+    indices.swap(result);
+}
+
+//==============================================================
+// オーバードロー削減
+//  - クラスタごとに重心と面積重み付き法線を求め、
+//    dot(重心 - メッシュ重心, 法線) の降順に並べ替える
+//==============================================================
+void OptimizeOverdraw(std::vector<unsigned int>& indices,
+                      const float* verts,
+                      unsigned int numVerts,
+                      const std::vector<unsigned int>& clusters,
+                      unsigned int maxClusterTriangles)
+{
+    const size_t numTris = indices.size() / 3;
+    if (clusters.empty() || numTris == 0 || numVerts == 0) return;
+
+    //----------------------------------------------------------
+    // 大きなクラスタを分割
+    //----------------------------------------------------------
+    std::vector<unsigned int> bounds;
+    for (size_t i = 0; i < clusters.size(); i++)
+    {
+        unsigned int begin = clusters[i];
+        unsigned int end   = (i + 1 < clusters.size()) ? clusters[i + 1] : static_cast<unsigned int>(numTris);
+        for (unsigned int t = begin; t < end; t += std::max(maxClusterTriangles, 1u))
+        {
+            bounds.push_back(t);
+        }
+    }
+    if (bounds.size() <= 1) return;
+
+    struct ClusterInfo
+    {
+        unsigned int begin;  // 三角形番号
+        unsigned int end;
+        float        sortKey;
+    };
+
+    //----------------------------------------------------------
+    // メッシュ全体の重心（面積重み付き）
+    //----------------------------------------------------------
+    auto triArea = [&](size_t t, float n[3], float c[3])
+    {
+        const float* p0 = verts + indices[t * 3]     * 3;
+        const float* p1 = verts + indices[t * 3 + 1] * 3;
+        const float* p2 = verts + indices[t * 3 + 2] * 3;
+        float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+        float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+        n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+        n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+        n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+        for (int k = 0; k < 3; k++) c[k] = (p0[k] + p1[k] + p2[k]) / 3.0f;
+        return std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) * 0.5f;
+    };
+
+    float meshCenter[3] = { 0, 0, 0 };
+    float totalArea = 0.0f;
+    for (size_t t = 0; t < numTris; t++)
+    {
+        float n[3], c[3];
+        float a = triArea(t, n, c);
+        for (int k = 0; k < 3; k++) meshCenter[k] += c[k] * a;
+        totalArea += a;
+    }
+    if (totalArea <= 0.0f) return;
+    for (int k = 0; k < 3; k++) meshCenter[k] /= totalArea;
+
+    //----------------------------------------------------------
+    // クラスタごとのソートキー
+    //----------------------------------------------------------
+    std::vector<ClusterInfo> infos;
+    infos.reserve(bounds.size());
+    for (size_t i = 0; i < bounds.size(); i++)
+    {
+        ClusterInfo info;
+        info.begin = bounds[i];
+        info.end   = (i + 1 < bounds.size()) ? bounds[i + 1] : static_cast<unsigned int>(numTris);
+
+        float normal[3] = { 0, 0, 0 };
+        float center[3] = { 0, 0, 0 };
+        float area = 0.0f;
+        for (unsigned int t = info.begin; t < info.end; t++)
+        {
+            float n[3], c[3];
+            float a = triArea(t, n, c);
+            for (int k = 0; k < 3; k++)
+            {
+                normal[k] += n[k];   // 外積の大きさ＝面積×2 なので自然に面積重み
+                center[k] += c[k] * a;
+            }
+            area += a;
+        }
+
+        float len = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        info.sortKey = 0.0f;
+        if (area > 0.0f && len > 0.0f)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                info.sortKey += (center[k] / area - meshCenter[k]) * (normal[k] / len);
+            }
+        }
+        infos.push_back(info);
+    }
+
+    std::stable_sort(infos.begin(), infos.end(),
+                     [](const ClusterInfo& a, const ClusterInfo& b) { return a.sortKey > b.sortKey; });
+
+    std::vector<unsigned int> result;
+    result.reserve(indices.size());
+    for (const auto& info : infos)
+    {
+        result.insert(result.end(),
+                      indices.begin() + info.begin * 3,
+                      indices.begin() + info.end * 3);
+    }
+    indices.swap(result);
+}
+
+//==============================================================
+// 頂点フェッチ順の最適化
+//==============================================================
+std::vector<unsigned int> OptimizeVertexFetch(std::vector<unsigned int>& indices,
+                                              unsigned int numVerts)
+{
+    const unsigned int kUnused = ~0u;
+    std::vector<unsigned int> remap(numVerts, kUnused);
+    unsigned int next = 0;
+
+    for (unsigned int& v : indices)
+    {
+        if (remap[v] == kUnused)
+        {
+            remap[v] = next++;
+        }
+        v = remap[v];
+    }
+
+    // 参照されない頂点は末尾へ（頂点数は変えない）
+    for (unsigned int v = 0; v < numVerts; v++)
+    {
+        if (remap[v] == kUnused)
+        {
+            remap[v] = next++;
+        }
+    }
+    return remap;
+}
+
+} // namespace MeshOptimizer
+} // namespace toy
@@ -0,0 +1,485 @@
+#include "Asset/Geometry/MeshSimplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace toy {
+namespace MeshSimplifier {
+
+namespace {
+
+//==============================================================
+// 頂点の種類
+//  - Manifold : 内部頂点。どの隣接頂点へも縮約可能
+//  - Border   : 境界上の頂点。境界辺に沿ってのみ縮約可能
+//  - Locked   : UV シーム / 非多様体。動かさない
+//==============================================================
+enum VertexKind : uint8_t
+{
+    kManifold,
+    kBorder,
+    kLocked,
+};
+
+struct Vec3d
+{
+    double x, y, z;
+};
+
+static Vec3d Sub(const Vec3d& a, const Vec3d& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+static double Dot(const Vec3d& a, const Vec3d& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static Vec3d Cross(const Vec3d& a, const Vec3d& b)
+{
+    return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+//==============================================================
+// 二次誤差行列（対称 4x4 を 10 要素で保持）
+//  - 平面 (n, d) からの距離の二乗和を表す
+//  - w は面積などの重み合計（誤差の正規化に使う）
+//==============================================================
+struct Quadric
+{
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0, c = 0;
+    double w = 0;
+
+    void AddPlane(const Vec3d& n, double d, double weight)
+    {
+        a00 += weight * n.x * n.x; a01 += weight * n.x * n.y; a02 += weight * n.x * n.z;
+        a11 += weight * n.y * n.y; a12 += weight * n.y * n.z; a22 += weight * n.z * n.z;
+        b0  += weight * n.x * d;   b1  += weight * n.y * d;   b2  += weight * n.z * d;
+        c   += weight * d * d;
+        w   += weight;
+    }
+
+    void Add(const Quadric& q)
+    {
+        a00 += q.a00; a01 += q.a01; a02 += q.a02;
+        a11 += q.a11; a12 += q.a12; a22 += q.a22;
+        b0  += q.b0;  b1  += q.b1;  b2  += q.b2;
+        c   += q.c;   w   += q.w;
+    }
+
+    // 点 p における誤差（距離の二乗の重み付き平均）
+    double Eval(const Vec3d& p) const
+    {
+        double r = a00 * p.x * p.x + a11 * p.y * p.y + a22 * p.z * p.z
+                 + 2.0 * (a01 * p.x * p.y + a02 * p.x * p.z + a12 * p.y * p.z)
+                 + 2.0 * (b0 * p.x + b1 * p.y + b2 * p.z)
+                 + c;
+        return (w > 0.0) ? std::fabs(r) / w : std::fabs(r);
+    }
+};
+
+struct Collapse
+{
+    unsigned int from;
+    unsigned int to;
+    double       cost;
+};
+
+static uint64_t EdgeKey(unsigned int a, unsigned int b)
+{
+    return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+//--------------------------------------------------------------
+// 座標が完全一致する頂点を 1 つの代表頂点にまとめる
+//  - 戻り値[v] = v と同じ座標を持つ最初の頂点番号
+//--------------------------------------------------------------
+static std::vector<unsigned int> BuildPositionRemap(const float* verts, unsigned int numVerts)
+{
+    struct KeyHash
+    {
+        size_t operator()(const std::array<uint32_t, 3>& k) const
+        {
+            return (k[0] * 73856093u) ^ (k[1] * 19349663u) ^ (k[2] * 83492791u);
+        }
+    };
+
+    std::vector<unsigned int> remap(numVerts);
+    std::unordered_map<std::array<uint32_t, 3>, unsigned int, KeyHash> table;
+    table.reserve(numVerts);
+
+    for (unsigned int i = 0; i < numVerts; i++)
+    {
+        std::array<uint32_t, 3> key;
+        std::memcpy(key.data(), verts + i * 3, sizeof(uint32_t) * 3);
+        auto it = table.emplace(key, i).first;
+        remap[i] = it->second;
+    }
+    return remap;
+}
+
+//--------------------------------------------------------------
+// 現在の三角形リストから境界辺（対になる逆向き辺が無い辺）を集める
+//  - 辺は代表頂点の番号で扱う
+//  - 同じ向きの辺が 2 回以上現れる非多様体の頂点は nonManifold に記録
+//--------------------------------------------------------------
+static void CollectEdges(const std::vector<unsigned int>& indices,
+                         const std::vector<unsigned int>& posRemap,
+                         std::unordered_set<uint64_t>& borderEdges,
+                         std::vector<bool>& nonManifold)
+{
+    std::unordered_map<uint64_t, unsigned int> edgeCount;
+    edgeCount.reserve(indices.size());
+
+    for (size_t i = 0; i < indices.size(); i += 3)
+    {
+        for (int e = 0; e < 3; e++)
+        {
+            unsigned int a = posRemap[indices[i + e]];
+            unsigned int b = posRemap[indices[i + (e + 1) % 3]];
+            edgeCount[EdgeKey(a, b)]++;
+        }
+    }
+
+    borderEdges.clear();
+    for (const auto& [key, count] : edgeCount)
+    {
+        unsigned int a = static_cast<unsigned int>(key >> 32);
+        unsigned int b = static_cast<unsigned int>(key & 0xffffffffu);
+
+        if (count > 1)
+        {
+            nonManifold[a] = true;
+            nonManifold[b] = true;
+        }
+        if (edgeCount.find(EdgeKey(b, a)) == edgeCount.end())
+        {
+            borderEdges.insert(key);
+        }
+    }
+}
+
+} // namespace
+
+//==============================================================
+// Simplify
+//  - 1 パスごとに「コストの低い縮約候補」を貪欲に適用し、
+//    縮約に関わった頂点の周辺はそのパスでは再縮約しない。
+//  - 目標数に届くか、許容誤差を超える候補しか無くなったら終了。
+//==============================================================
+std::vector<unsigned int> Simplify(const float* verts,
+                                   unsigned int numVerts,
+                                   const unsigned int* indices,
+                                   unsigned int numIndices,
+                                   unsigned int targetIndexCount,
+                                   float maxError,
+                                   float* outError)
+{
+    std::vector<unsigned int> result(indices, indices + numIndices);
+    if (outError) *outError = 0.0f;
+    if (numVerts == 0 || numIndices < 3 || targetIndexCount >= numIndices)
+    {
+        return result;
+    }
+
+    //----------------------------------------------------------
+    // 座標を中心 0 / 半径 1 に正規化（誤差をスケール非依存にする）
+    //----------------------------------------------------------
+    Vec3d minP{  1e30,  1e30,  1e30 };
+    Vec3d maxP{ -1e30, -1e30, -1e30 };
+    for (unsigned int i = 0; i < numIndices; i++)
+    {
+        const float* p = verts + indices[i] * 3;
+        minP = { std::min(minP.x, (double)p[0]), std::min(minP.y, (double)p[1]), std::min(minP.z, (double)p[2]) };
+        maxP = { std::max(maxP.x, (double)p[0]), std::max(maxP.y, (double)p[1]), std::max(maxP.z, (double)p[2]) };
+    }
+    Vec3d  center{ (minP.x + maxP.x) * 0.5, (minP.y + maxP.y) * 0.5, (minP.z + maxP.z) * 0.5 };
+    Vec3d  ext = Sub(maxP, center);
+    double radius = std::sqrt(Dot(ext, ext));
+    if (radius <= 0.0) radius = 1.0;
+
+    std::vector<Vec3d> pos(numVerts);
+    for (unsigned int i = 0; i < numVerts; i++)
+    {
+        pos[i] = { (verts[i * 3]     - center.x) / radius,
+                   (verts[i * 3 + 1] - center.y) / radius,
+                   (verts[i * 3 + 2] - center.z) / radius };
+    }
+
+    //----------------------------------------------------------
+    // 代表頂点と頂点種別
+    //----------------------------------------------------------
+    std::vector<unsigned int> posRemap = BuildPositionRemap(verts, numVerts);
+
+    // 同一座標に複数頂点が参照されていれば UV/法線シーム
+    std::vector<unsigned int> wedgeCount(numVerts, 0);
+    {
+        std::vector<bool> referenced(numVerts, false);
+        for (unsigned int i = 0; i < numIndices; i++)
+        {
+            unsigned int v = indices[i];
+            if (!referenced[v])
+            {
+                referenced[v] = true;
+                wedgeCount[posRemap[v]]++;
+            }
+        }
+    }
+
+    std::unordered_set<uint64_t> borderEdges;
+    std::vector<bool> nonManifold(numVerts, false);
+    CollectEdges(result, posRemap, borderEdges, nonManifold);
+
+    std::vector<VertexKind> kind(numVerts, kManifold);
+    for (uint64_t key : borderEdges)
+    {
+        kind[key >> 32]           = kBorder;
+        kind[key & 0xffffffffu]   = kBorder;
+    }
+    for (unsigned int i = 0; i < numVerts; i++)
+    {
+        unsigned int c = posRemap[i];
+        if (wedgeCount[c] > 1 || nonManifold[c])
+        {
+            kind[c] = kLocked;
+        }
+    }
+
+    //----------------------------------------------------------
+    // 二次誤差行列（代表頂点ごと）
+    //  - 各三角形の平面を面積で重み付け
+    //  - 境界辺には辺を含み面に垂直な平面を強めに加えて形を保つ
+    //----------------------------------------------------------
+    const double kBorderWeight = 10.0;
+    std::vector<Quadric> quadrics(numVerts);
+    for (size_t i = 0; i < result.size(); i += 3)
+    {
+        unsigned int v[3] = { posRemap[result[i]], posRemap[result[i + 1]], posRemap[result[i + 2]] };
+        Vec3d  n    = Cross(Sub(pos[v[1]], pos[v[0]]), Sub(pos[v[2]], pos[v[0]]));
+        double len  = std::sqrt(Dot(n, n));
+        if (len <= 0.0) continue;
+
+        Vec3d  nn   = { n.x / len, n.y / len, n.z / len };
+        double d    = -Dot(nn, pos[v[0]]);
+        double area = len * 0.5;
+        for (int k = 0; k < 3; k++)
+        {
+            quadrics[v[k]].AddPlane(nn, d, area);
+        }
+
+        for (int e = 0; e < 3; e++)
+        {
+            unsigned int a = v[e];
+            unsigned int b = v[(e + 1) % 3];
+            if (borderEdges.find(EdgeKey(a, b)) == borderEdges.end()) continue;
+
+            Vec3d  edge    = Sub(pos[b], pos[a]);
+            double edgeLen = std::sqrt(Dot(edge, edge));
+            if (edgeLen <= 0.0) continue;
+
+            Vec3d  bn    = Cross(edge, nn);
+            double bnLen = std::sqrt(Dot(bn, bn));
+            if (bnLen <= 0.0) continue;
+            bn = { bn.x / bnLen, bn.y / bnLen, bn.z / bnLen };
+
+            double bd = -Dot(bn, pos[a]);
+            quadrics[a].AddPlane(bn, bd, edgeLen * edgeLen * kBorderWeight);
+            quadrics[b].AddPlane(bn, bd, edgeLen * edgeLen * kBorderWeight);
+        }
+    }
+
+    //----------------------------------------------------------
+    // 縮約パス
+    //----------------------------------------------------------
+    const double maxErrorSq = static_cast<double>(maxError) * maxError;
+    double resultErrorSq = 0.0;
+
+    std::vector<unsigned int> remap(numVerts);
+    std::vector<bool>         touched(numVerts);
+    std::vector<Collapse>     candidates;
+    std::vector<unsigned int> triOffsets(numVerts + 1);
+    std::vector<unsigned int> triList;
+
+    while (result.size() > targetIndexCount)
+    {
+        CollectEdges(result, posRemap, borderEdges, nonManifold);
+
+        //------------------------------------------------------
+        // 候補収集：v → u（v を u に寄せる）
+        //------------------------------------------------------
+        candidates.clear();
+        for (size_t i = 0; i < result.size(); i += 3)
+        {
+            for (int e = 0; e < 3; e++)
+            {
+                unsigned int a = result[i + e];
+                unsigned int b = result[i + (e + 1) % 3];
+                unsigned int ca = posRemap[a];
+                unsigned int cb = posRemap[b];
+                if (ca == cb) continue;
+
+                bool isBorderEdge =
+                    borderEdges.count(EdgeKey(ca, cb)) || borderEdges.count(EdgeKey(cb, ca));
+
+                const unsigned int pair[2][2] = { { a, b }, { b, a } };
+                for (const auto& p : pair)
+                {
+                    unsigned int from = p[0];
+                    unsigned int to   = p[1];
+                    VertexKind   k    = kind[posRemap[from]];
+
+                    bool allowed =
+                        (k == kManifold && !isBorderEdge) ||
+                        (k == kBorder   && isBorderEdge && kind[posRemap[to]] != kManifold);
+                    if (!allowed) continue;
+
+                    Quadric q = quadrics[posRemap[from]];
+                    q.Add(quadrics[posRemap[to]]);
+                    candidates.push_back({ from, to, q.Eval(pos[to]) });
+                }
+            }
+        }
+
+        if (candidates.empty()) break;
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Collapse& x, const Collapse& y) { return x.cost < y.cost; });
+
+        //------------------------------------------------------
+        // 頂点 → 三角形の隣接表（CSR 形式）
+        //------------------------------------------------------
+        std::fill(triOffsets.begin(), triOffsets.end(), 0);
+        for (unsigned int v : result) triOffsets[v + 1]++;
+        for (unsigned int i = 0; i < numVerts; i++) triOffsets[i + 1] += triOffsets[i];
+        triList.assign(result.size(), 0);
+        {
+            std::vector<unsigned int> fill(triOffsets.begin(), triOffsets.end() - 1);
+            for (size_t i = 0; i < result.size(); i++)
+            {
+                triList[fill[result[i]]++] = static_cast<unsigned int>(i / 3);
+            }
+        }
+
+        //------------------------------------------------------
+        // 貪欲に適用
+        //------------------------------------------------------
+        for (unsigned int i = 0; i < numVerts; i++) remap[i] = i;
+        std::fill(touched.begin(), touched.end(), false);
+
+        // 1 回の縮約でおおよそ 2 三角形（6 インデックス）減る
+        size_t budget = (result.size() - targetIndexCount) / 6 + 1;
+        size_t applied = 0;
+
+        for (const Collapse& c : candidates)
+        {
+            if (applied >= budget) break;
+            if (c.cost > maxErrorSq) break;
+            if (touched[c.from] || touched[c.to]) continue;
+
+            // 面の反転チェック：v を含み u を含まない三角形の法線が大きく変わらないか
+            bool flipped = false;
+            for (unsigned int t = triOffsets[c.from]; t < triOffsets[c.from + 1] && !flipped; t++)
+            {
+                const unsigned int* tri = &result[triList[t] * 3];
+                if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to) continue;
+
+                Vec3d p0 = pos[tri[0]], p1 = pos[tri[1]], p2 = pos[tri[2]];
+                Vec3d nOld = Cross(Sub(p1, p0), Sub(p2, p0));
+                if (tri[0] == c.from) p0 = pos[c.to];
+                if (tri[1] == c.from) p1 = pos[c.to];
+                if (tri[2] == c.from) p2 = pos[c.to];
+                Vec3d nNew = Cross(Sub(p1, p0), Sub(p2, p0));
+
+                double lenOld = std::sqrt(Dot(nOld, nOld));
+                double lenNew = std::sqrt(Dot(nNew, nNew));
+                if (lenNew <= 1e-12 || Dot(nOld, nNew) < 0.25 * lenOld * lenNew)
+                {
+                    flipped = true;
+                }
+            }
+            if (flipped) continue;
+
+            // 周辺頂点をこのパス中はロック
+            for (unsigned int t = triOffsets[c.from]; t < triOffsets[c.from + 1]; t++)
+            {
+                const unsigned int* tri = &result[triList[t] * 3];
+                touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = true;
+            }
+            touched[c.to] = true;
+
+            remap[c.from] = c.to;
+            quadrics[posRemap[c.to]].Add(quadrics[posRemap[c.from]]);
+            resultErrorSq = std::max(resultErrorSq, c.cost);
+            applied++;
+        }
+
+        if (applied == 0) break;
+
+        //------------------------------------------------------
+        // インデックス書き換え＋縮退三角形の除去
+        //------------------------------------------------------
+        size_t write = 0;
+        for (size_t i = 0; i < result.size(); i += 3)
+        {
+            unsigned int a = remap[result[i]];
+            unsigned int b = remap[result[i + 1]];
+            unsigned int c = remap[result[i + 2]];
+            if (posRemap[a] == posRemap[b] ||
+                posRemap[b] == posRemap[c] ||
+                posRemap[c] == posRemap[a])
+            {
+                continue;
+            }
+            result[write++] = a;
+            result[write++] = b;
+            result[write++] = c;
+        }
+        result.resize(write);
+    }
+
+    if (outError) *outError = static_cast<float>(std::sqrt(resultErrorSq));
+    return result;
+}
+
+//==============================================================
+// GenerateLodChain
+//  - 前段の結果をさらに半分へ（段ごとに許容誤差も倍に）
+//==============================================================
+std::vector<std::vector<unsigned int>> GenerateLodChain(const float* verts,
+                                                        unsigned int numVerts,
+                                                        const std::vector<unsigned int>& indices,
+                                                        int maxLevels,
+                                                        unsigned int minTriangles)
+{
+    std::vector<std::vector<unsigned int>> lods;
+    lods.push_back(indices);
+
+    if (indices.size() / 3 < minTriangles)
+    {
+        return lods;
+    }
+
+    float maxError = 0.02f;
+    for (int level = 1; level < maxLevels; level++)
+    {
+        const std::vector<unsigned int>& prev = lods.back();
+        unsigned int target = static_cast<unsigned int>(prev.size() / 2 / 3 * 3);
+
+        std::vector<unsigned int> next = Simplify(verts, numVerts,
+                                                  prev.data(),
+                                                  static_cast<unsigned int>(prev.size()),
+                                                  target, maxError);
+
+        // 15% も減らないなら以降の段は作っても無駄
+        if (next.empty() || next.size() > prev.size() * 85 / 100)
+        {
+            break;
+        }
+
+        lods.push_back(std::move(next));
+        maxError *= 2.0f;
+    }
+    return lods;
+}
+
+} // namespace MeshSimplifier
+} // namespace toy
@@ -1,6 +1,9 @@
 #include "Asset/Geometry/VertexArray.h"
 #include "Asset/Geometry/Polygon.h"
 #include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 namespace toy {
 
@@ -190,6 +193,112 @@ VertexArray::VertexArray(unsigned int numVerts,
     CreatePolygons(verts, indices, mNumIndices);
 }
 
+//==============================================================
+// 量子化インターリーブ共通
+//  - 1 本の VBO に全属性を詰める
+//  0: 位置   snorm16 x3（正規化して -1..1 → シェーダで復元）
+//  1: 法線   snorm16 x2（八面体エンコード）
+//  2: UV     half x2
+//==============================================================
+void VertexArray::CreatePackedBuffers(const void* packed,
+                                      unsigned int stride,
+                                      const unsigned int* indices)
+{
+    // VAO
+    glGenVertexArrays(1, &mVertexBufferID);
+    glBindVertexArray(mVertexBufferID);
+
+    //------------------------------------------
+    // インデックスバッファ
+    //------------------------------------------
+    glGenBuffers(1, &mIndexBufferID);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferID);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 sizeof(unsigned int) * mNumIndices,
+                 indices,
+                 GL_STATIC_DRAW);
+
+    //------------------------------------------
+    // 頂点バッファ（インターリーブ 1 本）
+    //------------------------------------------
+    glGenBuffers(1, &mVertexBuffer[0]);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer[0]);
+    glBufferData(GL_ARRAY_BUFFER,
+                 static_cast<GLsizeiptr>(stride) * mNumVerts,
+                 packed,
+                 GL_STATIC_DRAW);
+
+    // position
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_SHORT, GL_TRUE, stride,
+                          reinterpret_cast<void*>(offsetof(PackedVertex, pos)));
+
+    // normal（八面体 2 成分。シェーダ側の z は 0 になる）
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride,
+                          reinterpret_cast<void*>(offsetof(PackedVertex, normal)));
+
+    // uv
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride,
+                          reinterpret_cast<void*>(offsetof(PackedVertex, uv)));
+}
+
+//==============================================================
+// コンストラクタ（量子化インターリーブ：ボーンなし）
+//==============================================================
+VertexArray::VertexArray(const PackedVertex* packed,
+                         unsigned int numVerts,
+                         const VertexQuantization& q,
+                         const float* verts,
+                         const unsigned int* indices,
+                         unsigned int numIndices)
+{
+    mNumVerts     = numVerts;
+    mNumIndices   = numIndices;
+    mIsQuantized  = true;
+    mQuantization = q;
+
+    CreatePackedBuffers(packed, sizeof(PackedVertex), indices);
+
+    // 三角形ポリゴン（ローカル座標）生成
+    CreatePolygons(verts, indices, mNumIndices);
+}
+
+//==============================================================
+// コンストラクタ（量子化インターリーブ：スキンあり）
+//  3: BoneID uint8 x4（整数属性）
+//  4: Weight unorm8 x4
+//==============================================================
+VertexArray::VertexArray(const PackedSkinnedVertex* packed,
+                         unsigned int numVerts,
+                         const VertexQuantization& q,
+                         const float* verts,
+                         const unsigned int* indices,
+                         unsigned int numIndices)
+{
+    mNumVerts     = numVerts;
+    mNumIndices   = numIndices;
+    mIsQuantized  = true;
+    mQuantization = q;
+
+    const unsigned int stride = sizeof(PackedSkinnedVertex);
+    CreatePackedBuffers(packed, stride, indices);
+
+    // bone id : layout(location = 3)
+    glEnableVertexAttribArray(3);
+    glVertexAttribIPointer(3, 4, GL_UNSIGNED_BYTE, stride,
+                           reinterpret_cast<void*>(offsetof(PackedSkinnedVertex, bones)));
+
+    // weight : layout(location = 4)
+    glEnableVertexAttribArray(4);
+    glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+                          reinterpret_cast<void*>(offsetof(PackedSkinnedVertex, weights)));
+
+    // 三角形ポリゴン（ローカル座標）生成
+    CreatePolygons(verts, indices, mNumIndices);
+}
+
 //==============================================================
 // コンストラクタ（スプライト用）
 //  - 1頂点あたり 8 float (pos + normal + uv)
@@ -368,6 +477,68 @@ std::vector<Polygon> VertexArray::GetWorldPolygons(const Matrix4& worldTransform
     return result;
 }
 
+//==============================================================
+// LOD インデックスの設定
+//  - 全レベルを連結して IBO を作り直す
+//  - 物理判定用ポリゴンは元メッシュ（LOD0）のまま
+//==============================================================
+void VertexArray::SetLodIndices(const std::vector<std::vector<unsigned int>>& lods)
+{
+    if (lods.empty()) return;
+
+    std::vector<unsigned int> packed;
+    std::vector<unsigned int> counts;
+    for (const auto& l : lods)
+    {
+        counts.push_back(static_cast<unsigned int>(l.size()));
+        packed.insert(packed.end(), l.begin(), l.end());
+    }
+    SetLodIndices(packed.data(), counts);
+}
+
+void VertexArray::SetLodIndices(const unsigned int* packedIndices,
+                                const std::vector<unsigned int>& lodCounts)
+{
+    if (lodCounts.empty()) return;
+
+    unsigned int total = 0;
+    mLodLevels.clear();
+    for (unsigned int count : lodCounts)
+    {
+        mLodLevels.push_back({ total, count });
+        total += count;
+    }
+    mNumIndices = mLodLevels[0].numIndices;
+
+    // VAO に紐づいた IBO を差し替える
+    glBindVertexArray(mVertexBufferID);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBufferID);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 sizeof(unsigned int) * total,
+                 packedIndices,
+                 GL_STATIC_DRAW);
+}
+
+//==============================================================
+// LOD ごとのインデックス数 / オフセット
+//  - LOD 未設定なら LOD0（全インデックス）を返す
+//  - 範囲外の lod は最も粗いレベルに丸める
+//==============================================================
+unsigned int VertexArray::GetLodNumIndices(int lod) const
+{
+    if (mLodLevels.empty()) return mNumIndices;
+    lod = std::clamp(lod, 0, static_cast<int>(mLodLevels.size()) - 1);
+    return mLodLevels[lod].numIndices;
+}
+
+const void* VertexArray::GetLodIndexOffset(int lod) const
+{
+    if (mLodLevels.empty()) return nullptr;
+    lod = std::clamp(lod, 0, static_cast<int>(mLodLevels.size()) - 1);
+    return reinterpret_cast<const void*>(
+        static_cast<uintptr_t>(mLodLevels[lod].offset) * sizeof(unsigned int));
+}
+
 //==============================================================
 // デストラクタ
 //==============================================================
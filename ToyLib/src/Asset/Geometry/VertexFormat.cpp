@@ -0,0 +1,208 @@
+#include "Asset/Geometry/VertexFormat.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace toy {
+namespace VertexFormat {
+
+namespace {
+
+// -1..1 → snorm16
+int16_t ToSnorm16(float v)
+{
+    v = std::clamp(v, -1.0f, 1.0f);
+    return static_cast<int16_t>(std::lround(v * 32767.0f));
+}
+
+} // namespace
+
+//==============================================================
+// float → half
+//  - 正規化数 / 非正規化数 / Inf / NaN を扱う
+//  - 仮数は最近接偶数丸め
+//==============================================================
+uint16_t FloatToHalf(float f)
+{
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+
+    uint32_t sign = (x >> 16) & 0x8000u;
+    uint32_t absx = x & 0x7fffffffu;
+
+    // NaN / Inf
+    if (absx >= 0x7f800000u)
+    {
+        return static_cast<uint16_t>(sign | 0x7c00u | ((absx > 0x7f800000u) ? 0x200u : 0u));
+    }
+
+    // half で表現できない大きさ → Inf
+    if (absx >= 0x477ff000u)
+    {
+        return static_cast<uint16_t>(sign | 0x7c00u);
+    }
+
+    // 非正規化数（またはゼロ）
+    if (absx < 0x38800000u)
+    {
+        if (absx < 0x33000000u)
+        {
+            return static_cast<uint16_t>(sign);
+        }
+        uint32_t mant  = (absx & 0x007fffffu) | 0x00800000u;
+        int      shift = 113 - static_cast<int>(absx >> 23) + 13;
+        uint32_t half  = mant >> shift;
+        uint32_t rem   = mant & ((1u << shift) - 1u);
+        uint32_t mid   = 1u << (shift - 1);
+        if (rem > mid || (rem == mid && (half & 1u)))
+        {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // 正規化数：指数を付け替えて仮数を 13bit 丸め
+    uint32_t half = ((absx - 0x38000000u) >> 13);
+    uint32_t rem  = absx & 0x1fffu;
+    if (rem > 0x1000u || (rem == 0x1000u && (half & 1u)))
+    {
+        half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+//==============================================================
+// 八面体エンコード
+//  - 単位球を八面体に投影し、下半球を折り返して正方形に収める
+//==============================================================
+void EncodeOctahedral(float x, float y, float z, int16_t out[2])
+{
+    float l1 = std::fabs(x) + std::fabs(y) + std::fabs(z);
+    if (l1 <= 0.0f)
+    {
+        out[0] = 0;
+        out[1] = ToSnorm16(1.0f);
+        return;
+    }
+    x /= l1;
+    y /= l1;
+    z /= l1;
+
+    if (z < 0.0f)
+    {
+        float ox = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        float oy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = ox;
+        y = oy;
+    }
+    out[0] = ToSnorm16(x);
+    out[1] = ToSnorm16(y);
+}
+
+//==============================================================
+// 位置の量子化範囲
+//  - AABB の中心を offset、半サイズを scale とする
+//  - 厚みゼロの軸（平面の地面など）で割り算が壊れないよう下限を設ける
+//==============================================================
+VertexQuantization ComputeQuantization(const float* verts, unsigned int numVerts)
+{
+    VertexQuantization q;
+    if (numVerts == 0) return q;
+
+    Vector3 minV(verts[0], verts[1], verts[2]);
+    Vector3 maxV = minV;
+    for (unsigned int i = 1; i < numVerts; i++)
+    {
+        minV.x = Math::Min(minV.x, verts[i * 3]);
+        minV.y = Math::Min(minV.y, verts[i * 3 + 1]);
+        minV.z = Math::Min(minV.z, verts[i * 3 + 2]);
+        maxV.x = Math::Max(maxV.x, verts[i * 3]);
+        maxV.y = Math::Max(maxV.y, verts[i * 3 + 1]);
+        maxV.z = Math::Max(maxV.z, verts[i * 3 + 2]);
+    }
+
+    q.offset = (minV + maxV) * 0.5f;
+    q.scale  = (maxV - minV) * 0.5f;
+    q.scale.x = Math::Max(q.scale.x, 1e-6f);
+    q.scale.y = Math::Max(q.scale.y, 1e-6f);
+    q.scale.z = Math::Max(q.scale.z, 1e-6f);
+    return q;
+}
+
+//==============================================================
+// 共通部分（位置・法線・UV）
+//==============================================================
+template <typename T>
+static void PackCommon(T& v,
+                       unsigned int i,
+                       const float* verts,
+                       const float* norms,
+                       const float* uvs,
+                       const VertexQuantization& q)
+{
+    v.pos[0] = ToSnorm16((verts[i * 3]     - q.offset.x) / q.scale.x);
+    v.pos[1] = ToSnorm16((verts[i * 3 + 1] - q.offset.y) / q.scale.y);
+    v.pos[2] = ToSnorm16((verts[i * 3 + 2] - q.offset.z) / q.scale.z);
+    v.pos[3] = 0;
+
+    EncodeOctahedral(norms[i * 3], norms[i * 3 + 1], norms[i * 3 + 2], v.normal);
+
+    v.uv[0] = FloatToHalf(uvs[i * 2]);
+    v.uv[1] = FloatToHalf(uvs[i * 2 + 1]);
+}
+
+void PackVertices(unsigned int numVerts,
+                  const float* verts,
+                  const float* norms,
+                  const float* uvs,
+                  const VertexQuantization& q,
+                  std::vector<PackedVertex>& out)
+{
+    out.resize(numVerts);
+    for (unsigned int i = 0; i < numVerts; i++)
+    {
+        PackCommon(out[i], i, verts, norms, uvs, q);
+    }
+}
+
+void PackSkinnedVertices(unsigned int numVerts,
+                         const float* verts,
+                         const float* norms,
+                         const float* uvs,
+                         const unsigned int* boneids,
+                         const float* weights,
+                         const VertexQuantization& q,
+                         std::vector<PackedSkinnedVertex>& out)
+{
+    out.resize(numVerts);
+    for (unsigned int i = 0; i < numVerts; i++)
+    {
+        PackedSkinnedVertex& v = out[i];
+        PackCommon(v, i, verts, norms, uvs, q);
+
+        //------------------------------------------------------
+        // ウェイト：合計を 1 に正規化 → 255 段階に丸め、
+        //           端数は最大ウェイトのボーンに寄せて合計 255 を保つ
+        //------------------------------------------------------
+        const float* w = weights + i * 4;
+        float sum = w[0] + w[1] + w[2] + w[3];
+        int   total = 0;
+        int   maxIdx = 0;
+        for (int k = 0; k < 4; k++)
+        {
+            v.bones[k] = static_cast<uint8_t>(std::min(boneids[i * 4 + k], 255u));
+
+            float nw = (sum > 0.0f) ? w[k] / sum : (k == 0 ? 1.0f : 0.0f);
+            int   qw = static_cast<int>(std::lround(nw * 255.0f));
+            v.weights[k] = static_cast<uint8_t>(std::clamp(qw, 0, 255));
+            total += v.weights[k];
+            if (w[k] > w[maxIdx]) maxIdx = k;
+        }
+        int fixedW = static_cast<int>(v.weights[maxIdx]) + (255 - total);
+        v.weights[maxIdx] = static_cast<uint8_t>(std::clamp(fixedW, 0, 255));
+    }
+}
+
+} // namespace VertexFormat
+} // namespace toy
@@ -1,4 +1,5 @@
 #include "Asset/Material/Texture.h"
+#include "Asset/Material/TextureCache.h"
 #include "Asset/AssetManager.h"
 
 #include <SDL3/SDL.h>
@@ -7,11 +8,177 @@
 
 #include <vector>
 #include <cmath>
+#include <cstring>
 #include <algorithm>
 #include <iostream>
 
 namespace toy {
 
+namespace {
+//============================================================
+// 読み込み前のテクスチャの代わりに結びつける 1x1 の白
+//  - マテリアル色がそのまま出るので、届くまでの見た目が破綻しない
+//============================================================
+GLuint GetPlaceholderTexture()
+{
+    static GLuint sPlaceholder = 0;
+    if (sPlaceholder == 0)
+    {
+        const unsigned char white[4] = { 255, 255, 255, 255 };
+        glGenTextures(1, &sPlaceholder);
+        glBindTexture(GL_TEXTURE_2D, sPlaceholder);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    return sPlaceholder;
+}
+
+//============================================================
+// 画像データ → ABGR8888（little endian で RGBA 順）の Surface
+//  - 失敗時は nullptr（エラー出力済み）
+//============================================================
+SDL_Surface* DecodeSurface(const std::string& fileName,
+                           const AssetData& data,
+                           const std::string& fullPath)
+{
+    SDL_IOStream* io = SDL_IOFromConstMem(data.GetData(), data.GetSize());
+    if (!io)
+    {
+        std::cerr << "[Texture] SDL_IOFromConstMem failed: "
+                  << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    // TGA など中身から判別できない形式もあるので拡張子を添える
+    //   第二引数 true で、読み込み終了後に io を自動クローズ
+    const size_t dot = fileName.find_last_of('.');
+    const std::string type = (dot != std::string::npos) ? fileName.substr(dot + 1) : "";
+    SDL_Surface* image = IMG_LoadTyped_IO(io, true, type.c_str());
+    if (!image)
+    {
+        std::cerr << "[Texture] Failed to load image: "
+                  << fullPath << " : " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    // --------------------------------------------------------
+    // OpenGL 用フォーマットへ変換（ABGR8888 → RGBA 相当）
+    //    ※ SDL3 でも SDL_ConvertSurface は利用可能
+    // --------------------------------------------------------
+    SDL_Surface* conv = SDL_ConvertSurface(image, SDL_PIXELFORMAT_ABGR8888);
+    SDL_DestroySurface(image); // 元 surface は破棄
+
+    if (!conv)
+    {
+        std::cerr << "[Texture] SDL_ConvertSurface failed: "
+                  << SDL_GetError() << std::endl;
+    }
+    return conv;
+}
+
+// 行の詰め物を除いた RGBA 配列にする
+void CopyPixels(const SDL_Surface* surface, std::vector<uint8_t>& out)
+{
+    const int w = surface->w;
+    const int h = surface->h;
+    out.resize(static_cast<size_t>(w) * h * 4);
+    for (int y = 0; y < h; y++)
+    {
+        std::memcpy(out.data() + static_cast<size_t>(y) * w * 4,
+                    static_cast<const uint8_t*>(surface->pixels) + static_cast<size_t>(y) * surface->pitch,
+                    static_cast<size_t>(w) * 4);
+    }
+}
+
+//============================================================
+// デコード済み画像 → GPU へ送る形（ミップ・BC 圧縮）
+//  - 圧縮形式は設定と画像のアルファ有無で決める
+//============================================================
+void BuildLevels(std::vector<uint8_t>&& base,
+                 int w,
+                 int h,
+                 const TextureSettings& settings,
+                 TextureCacheData& out)
+{
+    switch (settings.compression)
+    {
+        case TextureCompressionMode::Auto:
+            out.format = TextureCompression::HasAlpha(base.data(), base.size() / 4)
+                ? TextureFormat::BC3
+                : TextureFormat::BC1;
+            break;
+        case TextureCompressionMode::BC7:
+            out.format = TextureFormat::BC7;
+            break;
+        default:
+            out.format = TextureFormat::RGBA8;
+            break;
+    }
+
+    std::vector<std::vector<uint8_t>> mips;
+    if (settings.mipmaps)
+    {
+        TextureCompression::GenerateMips(base.data(), w, h, mips);
+    }
+
+    auto addLevel = [&out](std::vector<uint8_t>&& rgba, int lw, int lh)
+    {
+        TextureLevel level;
+        level.width  = lw;
+        level.height = lh;
+        if (out.format == TextureFormat::RGBA8)
+        {
+            level.size = rgba.size();
+            level.data = out.Retain(std::move(rgba));
+        }
+        else
+        {
+            std::vector<uint8_t> encoded;
+            TextureCompression::Encode(out.format, rgba.data(), lw, lh, encoded);
+            level.size = encoded.size();
+            level.data = out.Retain(std::move(encoded));
+        }
+        out.levels.push_back(level);
+    };
+
+    addLevel(std::move(base), w, h);
+    int lw = w;
+    int lh = h;
+    for (auto& mip : mips)
+    {
+        lw = std::max(1, lw / 2);
+        lh = std::max(1, lh / 2);
+        addLevel(std::move(mip), lw, lh);
+    }
+}
+
+GLenum ToGLFormat(TextureFormat format)
+{
+    switch (format)
+    {
+        case TextureFormat::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case TextureFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TextureFormat::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        default:                 return GL_RGBA8;
+    }
+}
+}
+
+//============================================================
+// Decode() から Upload() まで持ち越すデータ
+//  - キャッシュから読んだときは mmap 領域を指したまま GL へ転送する
+//  - cacheFile はパック内の .ttex（cache より後に解放されるよう先に置く）
+//============================================================
+struct TextureLoadData
+{
+    AssetData               cacheFile;
+    TextureCache            cache;
+    TextureCacheData        built;
+    const TextureCacheData* data = nullptr;
+    TextureSettings         settings;
+};
+
 Texture::Texture()
 : mTextureID(0)
 , mWidth(0)
@@ -29,36 +196,93 @@ Texture::~Texture()
 //============================================================
 bool Texture::Load(const std::string& fileName, AssetManager* assetManager)
 {
-    // AssetManager で設定された AssetsPath を基準にフルパスを組み立てる
-    std::string fullName = assetManager->GetAssetsPath() + fileName;
+    return Decode(fileName, assetManager) && Upload();
+}
 
-    SDL_Surface* image = IMG_Load(fullName.c_str());
-    if (!image)
+//============================================================
+// 読み込み前半：デコード・ミップ生成・圧縮（GL を使わない）
+//
+// 圧縮する設定なら <ファイル名>.ttex を先に調べ、内容ハッシュが
+// 一致すれば画像のデコードもエンコードもせずに各段を mmap で使う。
+// パック内の画像はパック内の .ttex だけを使い、書き出しはしない。
+//============================================================
+bool Texture::Decode(const std::string& fileName, AssetManager* assetManager)
+{
+    // パック（無ければ AssetsPath 以下のファイル）から読む
+    const AssetFileSystem& fs = assetManager->GetFileSystem();
+    AssetData data;
+    if (!fs.Read(fileName, data))
     {
-        std::cerr << "[Texture] Failed to load image: "
-                  << fullName << " : " << SDL_GetError() << std::endl;
+        std::cerr << "[Texture] Failed to open image: "
+                  << fs.GetFullPath(fileName) << std::endl;
         return false;
     }
 
-    // --------------------------------------------------------
-    // 1) OpenGL 用フォーマットへ変換（ABGR8888 → RGBA 相当）
-    //    ※ SDL3 でも SDL_ConvertSurface は利用可能
-    // --------------------------------------------------------
-    SDL_Surface* conv = SDL_ConvertSurface(image, SDL_PIXELFORMAT_ABGR8888);
-    SDL_DestroySurface(image); // 元 surface は破棄
+    auto pending = std::make_unique<TextureLoadData>();
+    pending->settings = assetManager->GetTextureSettings();
+    const TextureSettings& settings = pending->settings;
+
+    // 無圧縮はデコードが軽く、キャッシュの方が大きくなるので使わない
+    const bool useCache = settings.cache &&
+                          settings.compression != TextureCompressionMode::None;
+    const bool packed = fs.IsPacked(fileName);
+    const std::string cachePath = fs.GetFullPath(fileName) + TextureCache::kExtension;
+
+    uint64_t hash = 0;
+    if (useCache)
+    {
+        hash = TextureCache::HashSourceData(data.GetData(), data.GetSize(), settings);
+        const bool cached = packed
+            ? (fs.Read(fileName + TextureCache::kExtension, pending->cacheFile) &&
+               pending->cache.OpenMemory(pending->cacheFile.GetData(),
+                                         pending->cacheFile.GetSize(), hash))
+            : pending->cache.Open(cachePath, hash);
+        if (cached)
+        {
+            pending->data = &pending->cache.GetData();
+            mPending = std::move(pending);
+            return true;
+        }
+    }
 
+    SDL_Surface* conv = DecodeSurface(fileName, data, fs.GetFullPath(fileName));
     if (!conv)
     {
-        std::cerr << "[Texture] SDL_ConvertSurface failed: "
-                  << SDL_GetError() << std::endl;
         return false;
     }
 
-    const int w = conv->w;
-    const int h = conv->h;
+    std::vector<uint8_t> base;
+    CopyPixels(conv, base);
+    BuildLevels(std::move(base), conv->w, conv->h, settings, pending->built);
+    SDL_DestroySurface(conv);
+
+    if (useCache && !packed && TextureCache::Write(cachePath, hash, pending->built))
+    {
+        std::cerr << "[Texture] Cache written: " << cachePath << std::endl;
+    }
+
+    pending->data = &pending->built;
+    mPending = std::move(pending);
+    return true;
+}
+
+//============================================================
+// 読み込み後半：GL テクスチャ作成（メインスレッド）
+//  - 全ミップを転送し、段があればトライリニア＋異方性フィルタ
+//============================================================
+bool Texture::Upload()
+{
+    if (!mPending)
+    {
+        return false;
+    }
+
+    const TextureCacheData& data     = *mPending->data;
+    const TextureSettings&  settings = mPending->settings;
+    const GLenum            format   = ToGLFormat(data.format);
 
     // --------------------------------------------------------
-    // 2) 行パディング対策
+    // 1) 行パディング対策
     //    UNPACK_ALIGNMENT=1 にして 4byte アライメントを気にしないようにする
     // --------------------------------------------------------
     GLint prevUnpack = 0;
@@ -66,39 +290,267 @@ bool Texture::Load(const std::string& fileName, AssetManager* assetManager)
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
     // --------------------------------------------------------
-    // 3) OpenGL テクスチャ生成
+    // 2) OpenGL テクスチャ生成
     //    ABGR8888 だが little endian では RGBA 順と互換になるため GL_RGBA で扱う
+    //    BC 形式はブロックのまま転送する
     // --------------------------------------------------------
+    Unload();
     glGenTextures(1, &mTextureID);
     glBindTexture(GL_TEXTURE_2D, mTextureID);
 
-    glTexImage2D(
-        GL_TEXTURE_2D,
-        0,
-        GL_RGBA8,          // 内部フォーマット
-        w,
-        h,
-        0,
-        GL_RGBA,           // 入力フォーマット
-        GL_UNSIGNED_BYTE,
-        conv->pixels
-    );
+    const GLint numLevels = static_cast<GLint>(data.levels.size());
+    for (GLint i = 0; i < numLevels; i++)
+    {
+        const TextureLevel& level = data.levels[i];
+        if (data.format == TextureFormat::RGBA8)
+        {
+            glTexImage2D(
+                GL_TEXTURE_2D,
+                i,
+                GL_RGBA8,          // 内部フォーマット
+                level.width,
+                level.height,
+                0,
+                GL_RGBA,           // 入力フォーマット
+                GL_UNSIGNED_BYTE,
+                level.data
+            );
+        }
+        else
+        {
+            glCompressedTexImage2D(
+                GL_TEXTURE_2D,
+                i,
+                format,
+                level.width,
+                level.height,
+                0,
+                static_cast<GLsizei>(level.size),
+                level.data
+            );
+        }
+    }
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, numLevels - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    numLevels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    if (settings.anisotropy > 1.0f)
+    {
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, settings.anisotropy);
+    }
 
     // 元の alignment に戻す
     glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpack);
 
-    mWidth  = w;
-    mHeight = h;
+    mWidth  = data.levels[0].width;
+    mHeight = data.levels[0].height;
 
+    mPending.reset();
+    return true;
+}
+
+//============================================================
+// RGBA8 配列から作成（アトラスなど実行時に組んだ画像）
+//  - ミップは画像ファイルと同じ経路で作る
+//  - BC 圧縮は 4x4 ブロックが隣の画像にまたがるのでしない
+//============================================================
+bool Texture::CreateFromRGBA(const uint8_t* rgba,
+                             int width,
+                             int height,
+                             const TextureSettings& settings)
+{
+    if (!rgba || width <= 0 || height <= 0)
+    {
+        return false;
+    }
+
+    auto pending = std::make_unique<TextureLoadData>();
+    pending->settings = settings;
+    pending->settings.compression = TextureCompressionMode::None;
+
+    std::vector<uint8_t> base(rgba, rgba + static_cast<size_t>(width) * height * 4);
+    BuildLevels(std::move(base), width, height, pending->settings, pending->built);
+
+    pending->data = &pending->built;
+    mPending = std::move(pending);
+    return Upload();
+}
+
+//============================================================
+// 画像ファイル → RGBA8 配列（GL を使わない）
+//============================================================
+bool Texture::DecodeRGBA(const std::string& fileName,
+                         AssetManager* assetManager,
+                         std::vector<uint8_t>& outPixels,
+                         int& outWidth,
+                         int& outHeight)
+{
+    const AssetFileSystem& fs = assetManager->GetFileSystem();
+    AssetData data;
+    if (!fs.Read(fileName, data))
+    {
+        std::cerr << "[Texture] Failed to open image: "
+                  << fs.GetFullPath(fileName) << std::endl;
+        return false;
+    }
+
+    SDL_Surface* conv = DecodeSurface(fileName, data, fs.GetFullPath(fileName));
+    if (!conv)
+    {
+        return false;
+    }
+
+    CopyPixels(conv, outPixels);
+    outWidth  = conv->w;
+    outHeight = conv->h;
     SDL_DestroySurface(conv);
     return true;
 }
 
+//============================================================
+// 配列テクスチャ作成
+//  - 領域を確保してから層ごとに流し込み、ミップは GL に作らせる
+//============================================================
+bool Texture::CreateArray(const std::vector<const uint8_t*>& layers,
+                          int width,
+                          int height,
+                          const TextureSettings& settings)
+{
+    GLint maxLayers = 0;
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+    if (layers.empty() || width <= 0 || height <= 0 ||
+        static_cast<GLint>(layers.size()) > maxLayers)
+    {
+        std::cerr << "[Texture] Invalid array texture: "
+                  << width << " x " << height << " x " << layers.size() << std::endl;
+        return false;
+    }
+
+    const GLsizei numLayers = static_cast<GLsizei>(layers.size());
+
+    GLint prevUnpack = 0;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpack);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    Unload();
+    glGenTextures(1, &mTextureID);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureID);
+
+    glTexImage3D(
+        GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8,
+        width, height, numLayers, 0,
+        GL_RGBA, GL_UNSIGNED_BYTE,
+        nullptr
+    );
+    for (GLsizei i = 0; i < numLayers; i++)
+    {
+        glTexSubImage3D(
+            GL_TEXTURE_2D_ARRAY, 0,
+            0, 0, i,
+            width, height, 1,
+            GL_RGBA, GL_UNSIGNED_BYTE,
+            layers[i]
+        );
+    }
+
+    if (settings.mipmaps)
+    {
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    }
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+                    settings.mipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    if (settings.anisotropy > 1.0f)
+    {
+        glTexParameterf(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_ANISOTROPY_EXT, settings.anisotropy);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpack);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    mWidth     = width;
+    mHeight    = height;
+    mIsArray   = true;
+    mNumLayers = numLayers;
+    return true;
+}
+
+//============================================================
+// 画像ファイル群 → 配列テクスチャ
+//============================================================
+bool Texture::LoadArray(const std::vector<std::string>& fileNames,
+                        AssetManager* assetManager)
+{
+    std::vector<std::vector<uint8_t>> images(fileNames.size());
+    std::vector<const uint8_t*> layers;
+    int width  = 0;
+    int height = 0;
+
+    for (size_t i = 0; i < fileNames.size(); i++)
+    {
+        int w = 0;
+        int h = 0;
+        if (!DecodeRGBA(fileNames[i], assetManager, images[i], w, h))
+        {
+            return false;
+        }
+        if (i == 0)
+        {
+            width  = w;
+            height = h;
+        }
+        else if (w != width || h != height)
+        {
+            std::cerr << "[Texture] Array layer size mismatch: " << fileNames[i]
+                      << " (" << w << " x " << h << ", expected "
+                      << width << " x " << height << ")" << std::endl;
+            return false;
+        }
+        layers.push_back(images[i].data());
+    }
+
+    return CreateArray(layers, width, height, assetManager->GetTextureSettings());
+}
+
+//============================================================
+// GPU の対応に合わせて設定を落とす
+//  - BC7 は GL 4.2 / ARB_texture_compression_bptc（macOS の 4.1 には無い）
+//  - BC1 / BC3 は EXT_texture_compression_s3tc
+//============================================================
+void Texture::ApplyDeviceLimits(TextureSettings& settings)
+{
+    if (settings.compression == TextureCompressionMode::BC7 && !GLEW_ARB_texture_compression_bptc)
+    {
+        std::cerr << "[Texture] BC7 not supported, falling back to BC1/BC3" << std::endl;
+        settings.compression = TextureCompressionMode::Auto;
+    }
+    if (settings.compression == TextureCompressionMode::Auto && !GLEW_EXT_texture_compression_s3tc)
+    {
+        std::cerr << "[Texture] S3TC not supported, textures are uncompressed" << std::endl;
+        settings.compression = TextureCompressionMode::None;
+    }
+
+    if (settings.anisotropy > 1.0f)
+    {
+        if (!GLEW_EXT_texture_filter_anisotropic)
+        {
+            settings.anisotropy = 1.0f;
+        }
+        else
+        {
+            GLfloat maxAnisotropy = 1.0f;
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
+            settings.anisotropy = std::min(settings.anisotropy, maxAnisotropy);
+        }
+    }
+}
+
 //============================================================
 // メモリ上の画像データから読み込み（埋め込みテクスチャなど）
 //   - Assimp の aiTexture などに対応
@@ -144,7 +596,9 @@ bool Texture::LoadFromMemory(const void* data, int size)
         image->pixels
     );
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    // 埋め込み画像はキャッシュしないので、ミップは GL 側で作る
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
     mWidth  = image->w;
@@ -208,6 +662,42 @@ void Texture::CreateForRendering(int w, int h, unsigned int format)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 }
 
+//============================================================
+// データテクスチャ（RGBA32F）
+//   - フィルタは NEAREST 固定（texelFetch で読む前提）
+//============================================================
+bool Texture::CreateFloatData(const float* rgba, int width, int height)
+{
+    GLint maxSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+    if (width <= 0 || height <= 0 || width > maxSize || height > maxSize)
+    {
+        std::cerr << "[Texture] Data texture size out of range: "
+                  << width << " x " << height << std::endl;
+        return false;
+    }
+
+    mWidth  = width;
+    mHeight = height;
+
+    glGenTextures(1, &mTextureID);
+    glBindTexture(GL_TEXTURE_2D, mTextureID);
+
+    glTexImage2D(
+        GL_TEXTURE_2D, 0, GL_RGBA32F,
+        mWidth, mHeight, 0,
+        GL_RGBA, GL_FLOAT,
+        rgba
+    );
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    return true;
+}
+
 //============================================================
 // シャドウマップ用テクスチャ（depth）
 //   - sampler2DShadow 前提の深度比較テクスチャ
@@ -393,13 +883,38 @@ bool Texture::CreateFromPixels(const void* pixels,
     return true;
 }
 
+//============================================================
+// 部分更新（glTexSubImage2D）
+//============================================================
+bool Texture::UpdatePixels(int x, int y, int width, int height, const void* pixels)
+{
+    if (mTextureID == 0 || mIsArray)
+        return false;
+    if (x < 0 || y < 0 || width <= 0 || height <= 0 ||
+        x + width > mWidth || y + height > mHeight)
+        return false;
+
+    // RGBA8 の行は常に 4 バイト境界なので UNPACK_ALIGNMENT は既定のまま
+    glBindTexture(GL_TEXTURE_2D, mTextureID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height,
+                    GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return true;
+}
+
 //============================================================
 // OpenGL へのバインド
+//  - 読み込み前（非同期読み込み中など）はプレースホルダを結ぶ
 //============================================================
 void Texture::SetActive(int unit)
 {
     glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(GL_TEXTURE_2D, mTextureID);
+    if (mIsArray)
+    {
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mTextureID);
+        return;
+    }
+    glBindTexture(GL_TEXTURE_2D, mTextureID != 0 ? mTextureID : GetPlaceholderTexture());
 }
 
 //============================================================
@@ -412,6 +927,8 @@ void Texture::Unload()
         glDeleteTextures(1, &mTextureID);
         mTextureID = 0;
     }
+    mIsArray   = false;
+    mNumLayers = 1;
 }
 
 } // namespace toy
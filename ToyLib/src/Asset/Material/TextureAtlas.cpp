@@ -0,0 +1,398 @@
+#include "Asset/Material/TextureAtlas.h"
+#include "Asset/Material/Texture.h"
+#include "Asset/AssetManager.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+
+//==============================================================
+// スカイライン法のパッカー（1 ページ分）
+//  - 置いた矩形の上端を左から「段」の列で持ち、
+//    上端が一番低くなる位置（同じなら狭い段）に置く
+//==============================================================
+class SkylinePacker
+{
+public:
+    SkylinePacker(int width, int height)
+    : mWidth(width)
+    , mHeight(height)
+    {
+        mNodes.push_back({ 0, 0, width });
+    }
+
+    bool Insert(int w, int h, int& outX, int& outY)
+    {
+        size_t bestIndex = mNodes.size();
+        int bestTop   = INT_MAX;
+        int bestWidth = INT_MAX;
+        int bestY     = 0;
+
+        for (size_t i = 0; i < mNodes.size(); i++)
+        {
+            int y = 0;
+            if (!Fit(i, w, h, y))
+            {
+                continue;
+            }
+            const int top = y + h;
+            if (top < bestTop || (top == bestTop && mNodes[i].width < bestWidth))
+            {
+                bestIndex = i;
+                bestTop   = top;
+                bestWidth = mNodes[i].width;
+                bestY     = y;
+            }
+        }
+
+        if (bestIndex == mNodes.size())
+        {
+            return false;
+        }
+
+        outX = mNodes[bestIndex].x;
+        outY = bestY;
+        AddLevel(bestIndex, outX, outY, w, h);
+        return true;
+    }
+
+private:
+    struct Node
+    {
+        int x;
+        int y;       // この段の上端（ここから下へ置ける）
+        int width;
+    };
+
+    // index の段の左端に置いたときの y（またがる段の最大）
+    bool Fit(size_t index, int w, int h, int& outY) const
+    {
+        if (mNodes[index].x + w > mWidth)
+        {
+            return false;
+        }
+
+        int y = 0;
+        int remaining = w;
+        for (size_t i = index; remaining > 0; i++)
+        {
+            y = std::max(y, mNodes[i].y);
+            if (y + h > mHeight)
+            {
+                return false;
+            }
+            remaining -= mNodes[i].width;
+        }
+        outY = y;
+        return true;
+    }
+
+    void AddLevel(size_t index, int x, int y, int w, int h)
+    {
+        mNodes.insert(mNodes.begin() + index, { x, y + h, w });
+
+        // 新しい段に隠れた後ろの段を削る
+        for (size_t i = index + 1; i < mNodes.size();)
+        {
+            const int prevRight = mNodes[i - 1].x + mNodes[i - 1].width;
+            if (mNodes[i].x >= prevRight)
+            {
+                break;
+            }
+            const int shrink = prevRight - mNodes[i].x;
+            mNodes[i].x     += shrink;
+            mNodes[i].width -= shrink;
+            if (mNodes[i].width > 0)
+            {
+                break;
+            }
+            mNodes.erase(mNodes.begin() + i);
+        }
+
+        // 同じ高さの隣り合う段をまとめる
+        for (size_t i = 0; i + 1 < mNodes.size();)
+        {
+            if (mNodes[i].y == mNodes[i + 1].y)
+            {
+                mNodes[i].width += mNodes[i + 1].width;
+                mNodes.erase(mNodes.begin() + i + 1);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    int mWidth;
+    int mHeight;
+    std::vector<Node> mNodes;
+};
+
+struct Placement
+{
+    int page = 0;
+    int x    = 0;    // padding を含む矩形の左上
+    int y    = 0;
+};
+
+//==============================================================
+// order の順に詰める
+//  - multiPage が false なら 1 ページに収まらなければ失敗
+//==============================================================
+bool PackAll(const std::vector<size_t>& order,
+             const std::vector<int>& widths,
+             const std::vector<int>& heights,
+             int pageSize,
+             bool multiPage,
+             std::vector<Placement>& out,
+             int& outNumPages)
+{
+    std::vector<SkylinePacker> pages;
+    pages.emplace_back(pageSize, pageSize);
+    out.assign(order.size(), Placement());
+
+    for (size_t index : order)
+    {
+        Placement& p = out[index];
+        bool placed = false;
+        for (size_t page = 0; page < pages.size() && !placed; page++)
+        {
+            if (pages[page].Insert(widths[index], heights[index], p.x, p.y))
+            {
+                p.page = static_cast<int>(page);
+                placed = true;
+            }
+        }
+        if (placed)
+        {
+            continue;
+        }
+        if (!multiPage)
+        {
+            return false;
+        }
+
+        pages.emplace_back(pageSize, pageSize);
+        if (!pages.back().Insert(widths[index], heights[index], p.x, p.y))
+        {
+            return false;
+        }
+        p.page = static_cast<int>(pages.size() - 1);
+    }
+
+    outNumPages = static_cast<int>(pages.size());
+    return true;
+}
+
+//==============================================================
+// ページへ転写（周囲 padding 画素は端の画素を複製）
+//==============================================================
+void Blit(std::vector<uint8_t>& page,
+          int pageSize,
+          int dstX,
+          int dstY,
+          const uint8_t* src,
+          int w,
+          int h,
+          int padding)
+{
+    for (int dy = -padding; dy < h + padding; dy++)
+    {
+        const int sy = std::clamp(dy, 0, h - 1);
+        uint8_t* dstRow = page.data() +
+            (static_cast<size_t>(dstY + padding + dy) * pageSize + dstX + padding) * 4;
+        const uint8_t* srcRow = src + static_cast<size_t>(sy) * w * 4;
+
+        for (int dx = -padding; dx < w + padding; dx++)
+        {
+            const int sx = std::clamp(dx, 0, w - 1);
+            std::memcpy(dstRow + dx * 4, srcRow + sx * 4, 4);
+        }
+    }
+}
+
+} // namespace
+
+TextureAtlas::TextureAtlas()
+: mNumPages(0)
+, mPageSize(0)
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+//==============================================================
+// 登録
+//==============================================================
+bool TextureAtlas::AddImage(const std::string& name, const uint8_t* rgba, int width, int height)
+{
+    if (!rgba || width <= 0 || height <= 0)
+    {
+        std::cerr << "[TextureAtlas] Invalid image: " << name << std::endl;
+        return false;
+    }
+
+    Source src;
+    src.name   = name;
+    src.width  = width;
+    src.height = height;
+    src.pixels.assign(rgba, rgba + static_cast<size_t>(width) * height * 4);
+
+    auto it = std::find_if(mSources.begin(), mSources.end(),
+                           [&name](const Source& s) { return s.name == name; });
+    if (it != mSources.end())
+    {
+        *it = std::move(src);
+    }
+    else
+    {
+        mSources.push_back(std::move(src));
+    }
+    return true;
+}
+
+bool TextureAtlas::AddFile(const std::string& fileName, AssetManager* assetManager)
+{
+    std::vector<uint8_t> pixels;
+    int w = 0;
+    int h = 0;
+    if (!Texture::DecodeRGBA(fileName, assetManager, pixels, w, h))
+    {
+        return false;
+    }
+    return AddImage(fileName, pixels.data(), w, h);
+}
+
+//==============================================================
+// パックしてテクスチャ化
+//  - 面積から見積もった最小の 2 の冪から試し、入らなければ倍にする
+//  - maxPageSize でも入らなければ複数ページ（配列テクスチャ）にする
+//==============================================================
+bool TextureAtlas::Build(int maxPageSize, int padding, AssetManager* assetManager)
+{
+    if (mSources.empty())
+    {
+        std::cerr << "[TextureAtlas] No images to build" << std::endl;
+        return false;
+    }
+    padding = std::max(0, padding);
+
+    const size_t count = mSources.size();
+    std::vector<int> widths(count);
+    std::vector<int> heights(count);
+    std::vector<size_t> order(count);
+    size_t totalArea = 0;
+    int maxEdge = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        widths[i]  = mSources[i].width  + padding * 2;
+        heights[i] = mSources[i].height + padding * 2;
+        totalArea += static_cast<size_t>(widths[i]) * heights[i];
+        maxEdge = std::max(maxEdge, std::max(widths[i], heights[i]));
+        order[i] = i;
+    }
+
+    if (maxEdge > maxPageSize)
+    {
+        std::cerr << "[TextureAtlas] Image larger than page (" << maxPageSize << ")" << std::endl;
+        return false;
+    }
+
+    // 高さの大きい順（同じなら幅の大きい順）に置くと隙間が減る
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+    {
+        if (heights[a] != heights[b]) return heights[a] > heights[b];
+        return widths[a] > widths[b];
+    });
+
+    int pageSize = 64;
+    while (pageSize < maxPageSize &&
+           (static_cast<size_t>(pageSize) * pageSize < totalArea || pageSize < maxEdge))
+    {
+        pageSize *= 2;
+    }
+    pageSize = std::min(pageSize, maxPageSize);
+
+    std::vector<Placement> placements;
+    int numPages = 0;
+    while (!PackAll(order, widths, heights, pageSize, pageSize >= maxPageSize, placements, numPages))
+    {
+        if (pageSize >= maxPageSize)
+        {
+            std::cerr << "[TextureAtlas] Packing failed" << std::endl;
+            return false;
+        }
+        pageSize = std::min(pageSize * 2, maxPageSize);
+    }
+
+    //----------------------------------------------------------
+    // ページを組んで領域を記録
+    //----------------------------------------------------------
+    std::vector<std::vector<uint8_t>> pages(numPages,
+        std::vector<uint8_t>(static_cast<size_t>(pageSize) * pageSize * 4, 0));
+    const float inv = 1.0f / static_cast<float>(pageSize);
+
+    mRegions.clear();
+    for (size_t i = 0; i < count; i++)
+    {
+        const Source&    src = mSources[i];
+        const Placement& p   = placements[i];
+        Blit(pages[p.page], pageSize, p.x, p.y, src.pixels.data(), src.width, src.height, padding);
+
+        TextureRegion region;
+        region.u0     = (p.x + padding) * inv;
+        region.v0     = (p.y + padding) * inv;
+        region.u1     = (p.x + padding + src.width) * inv;
+        region.v1     = (p.y + padding + src.height) * inv;
+        region.width  = src.width;
+        region.height = src.height;
+        region.layer  = p.page;
+        mRegions[src.name] = region;
+    }
+
+    const TextureSettings settings = assetManager ? assetManager->GetTextureSettings()
+                                                  : TextureSettings();
+    auto texture = std::make_shared<Texture>();
+    bool created = false;
+    if (numPages == 1)
+    {
+        created = texture->CreateFromRGBA(pages[0].data(), pageSize, pageSize, settings);
+    }
+    else
+    {
+        std::vector<const uint8_t*> layers;
+        for (auto& page : pages)
+        {
+            layers.push_back(page.data());
+        }
+        created = texture->CreateArray(layers, pageSize, pageSize, settings);
+    }
+    if (!created)
+    {
+        mRegions.clear();
+        return false;
+    }
+
+    mTexture  = texture;
+    mNumPages = numPages;
+    mPageSize = pageSize;
+    mSources.clear();
+    mSources.shrink_to_fit();
+    return true;
+}
+
+const TextureRegion* TextureAtlas::FindRegion(const std::string& name) const
+{
+    auto it = mRegions.find(name);
+    return (it != mRegions.end()) ? &it->second : nullptr;
+}
+
+} // namespace toy
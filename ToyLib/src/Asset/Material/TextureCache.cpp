@@ -0,0 +1,255 @@
+#include "Asset/Material/TextureCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+
+//==============================================================
+// ファイルヘッダ（先頭 64 byte）→ 段の表 → 各段のデータ
+//==============================================================
+struct FileHeader
+{
+    char     magic[4];        // "TTEX"
+    uint32_t version;
+    uint64_t sourceHash;
+    uint32_t format;          // TextureFormat
+    uint32_t width;
+    uint32_t height;
+    uint32_t numLevels;
+    uint8_t  reserved[32];
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader must be 64 bytes");
+
+struct LevelEntry
+{
+    uint64_t offset;          // ファイル先頭から（kDataAlign 境界）
+    uint64_t size;
+    uint32_t width;
+    uint32_t height;
+};
+static_assert(sizeof(LevelEntry) == 24, "LevelEntry must be 24 bytes");
+
+const char kMagic[4] = { 'T', 'T', 'E', 'X' };
+
+// 各段の先頭アライメント
+constexpr size_t kDataAlign = 16;
+
+// 1x1 まで 16 段あれば 32768 px まで足りる
+constexpr uint32_t kMaxLevels = 16;
+
+size_t AlignUp(size_t v, size_t a)
+{
+    return (v + a - 1) / a * a;
+}
+
+} // namespace
+
+//==============================================================
+// 変換時バッファの保持
+//==============================================================
+const uint8_t* TextureCacheData::Retain(std::vector<uint8_t>&& data)
+{
+    mStorage.push_back(std::move(data));
+    return mStorage.back().data();
+}
+
+TextureCache::TextureCache()
+: mMapped(nullptr)
+, mSize(0)
+{
+}
+
+TextureCache::~TextureCache()
+{
+    Close();
+}
+
+//==============================================================
+// 内容ハッシュ（FNV-1a 64bit）
+//  - 形式バージョンと、結果を変える設定も鍵に含める
+//==============================================================
+uint64_t TextureCache::HashSourceData(const void* data, size_t size, const TextureSettings& settings)
+{
+    constexpr uint64_t kPrime = 1099511628211ull;
+    uint64_t hash = 14695981039346656037ull;
+
+    auto mix = [&hash](const uint8_t* p, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            hash ^= p[i];
+            hash *= kPrime;
+        }
+    };
+
+    uint32_t salt[3] =
+    {
+        kVersion,
+        settings.mipmaps ? 1u : 0u,
+        static_cast<uint32_t>(settings.compression),
+    };
+    mix(reinterpret_cast<const uint8_t*>(salt), sizeof(salt));
+    mix(static_cast<const uint8_t*>(data), size);
+    return hash;
+}
+
+//==============================================================
+// mmap して解析
+//==============================================================
+bool TextureCache::Open(const std::string& cachePath, uint64_t sourceHash)
+{
+    Close();
+
+    if (!mFile.Open(cachePath))
+    {
+        return false;
+    }
+
+    // 全体をすぐ GL へ送るので先読みを促す
+    mFile.Prefetch(0, mFile.GetSize());
+    return OpenMemory(mFile.GetData(), mFile.GetSize(), sourceHash);
+}
+
+bool TextureCache::OpenMemory(const void* data, size_t size, uint64_t sourceHash)
+{
+    if (!data || size < sizeof(FileHeader))
+    {
+        Close();
+        return false;
+    }
+
+    mMapped = static_cast<const uint8_t*>(data);
+    mSize   = size;
+    if (!Parse(sourceHash))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void TextureCache::Close()
+{
+    mFile.Close();
+    mMapped = nullptr;
+    mSize   = 0;
+    mData   = TextureCacheData();
+}
+
+//==============================================================
+// 解析（各段はコピーせずマップ領域を指す）
+//==============================================================
+bool TextureCache::Parse(uint64_t sourceHash)
+{
+    FileHeader header;
+    std::memcpy(&header, mMapped, sizeof(FileHeader));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion ||
+        header.sourceHash != sourceHash ||
+        header.format > static_cast<uint32_t>(TextureFormat::BC7) ||
+        header.numLevels == 0 || header.numLevels > kMaxLevels)
+    {
+        return false;
+    }
+
+    const size_t tableEnd = sizeof(FileHeader) + sizeof(LevelEntry) * header.numLevels;
+    if (tableEnd > mSize)
+    {
+        return false;
+    }
+
+    mData.format = static_cast<TextureFormat>(header.format);
+    mData.levels.resize(header.numLevels);
+    for (uint32_t i = 0; i < header.numLevels; i++)
+    {
+        LevelEntry e;
+        std::memcpy(&e, mMapped + sizeof(FileHeader) + sizeof(LevelEntry) * i, sizeof(LevelEntry));
+
+        // 壊れたキャッシュで GL に範囲外を読ませないように
+        if (e.width == 0 || e.height == 0 || e.width > 32768 || e.height > 32768 ||
+            e.size != TextureCompression::ComputeLevelSize(mData.format, e.width, e.height) ||
+            e.offset < tableEnd || e.offset > mSize || e.size > mSize - e.offset)
+        {
+            return false;
+        }
+
+        TextureLevel& level = mData.levels[i];
+        level.width  = static_cast<int>(e.width);
+        level.height = static_cast<int>(e.height);
+        level.data   = mMapped + e.offset;
+        level.size   = static_cast<size_t>(e.size);
+    }
+
+    return mData.levels[0].width  == static_cast<int>(header.width) &&
+           mData.levels[0].height == static_cast<int>(header.height);
+}
+
+//==============================================================
+// 書き出し
+//==============================================================
+bool TextureCache::Write(const std::string& cachePath,
+                         uint64_t sourceHash,
+                         const TextureCacheData& d)
+{
+    if (d.levels.empty() || d.levels.size() > kMaxLevels)
+    {
+        return false;
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version    = kVersion;
+    header.sourceHash = sourceHash;
+    header.format     = static_cast<uint32_t>(d.format);
+    header.width      = static_cast<uint32_t>(d.levels[0].width);
+    header.height     = static_cast<uint32_t>(d.levels[0].height);
+    header.numLevels  = static_cast<uint32_t>(d.levels.size());
+
+    std::vector<LevelEntry> table(d.levels.size());
+    size_t offset = sizeof(FileHeader) + sizeof(LevelEntry) * table.size();
+    for (size_t i = 0; i < d.levels.size(); i++)
+    {
+        offset = AlignUp(offset, kDataAlign);
+        table[i].offset = offset;
+        table[i].size   = d.levels[i].size;
+        table[i].width  = static_cast<uint32_t>(d.levels[i].width);
+        table[i].height = static_cast<uint32_t>(d.levels[i].height);
+        offset += d.levels[i].size;
+    }
+
+    std::vector<uint8_t> buf(offset, 0);
+    std::memcpy(buf.data(), &header, sizeof(FileHeader));
+    std::memcpy(buf.data() + sizeof(FileHeader), table.data(), sizeof(LevelEntry) * table.size());
+    for (size_t i = 0; i < d.levels.size(); i++)
+    {
+        std::memcpy(buf.data() + table[i].offset, d.levels[i].data, d.levels[i].size);
+    }
+
+    //----------------------------------------------------------
+    // 途中で落ちても壊れたキャッシュを残さないよう一時ファイル経由
+    //----------------------------------------------------------
+    std::string tmpPath = cachePath + ".tmp";
+    FILE* fp = std::fopen(tmpPath.c_str(), "wb");
+    if (!fp)
+    {
+        std::cerr << "[TextureCache] Cannot write: " << tmpPath << std::endl;
+        return false;
+    }
+    bool written = std::fwrite(buf.data(), 1, buf.size(), fp) == buf.size();
+    written = (std::fclose(fp) == 0) && written;
+
+    std::remove(cachePath.c_str());
+    if (!written || std::rename(tmpPath.c_str(), cachePath.c_str()) != 0)
+    {
+        std::remove(tmpPath.c_str());
+        std::cerr << "[TextureCache] Write failed: " << cachePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace toy
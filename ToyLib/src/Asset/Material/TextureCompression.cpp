@@ -0,0 +1,587 @@
+#include "Asset/Material/TextureCompression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace toy {
+namespace TextureCompression {
+
+namespace {
+
+// 4x4 ブロック（16 画素 × RGBA）
+using Block = uint8_t[16][4];
+
+//==============================================================
+// ブロックの取り出し（画像の外は端の画素を繰り返す）
+//==============================================================
+void LoadBlock(const uint8_t* rgba, int width, int height, int bx, int by, Block& out)
+{
+    for (int y = 0; y < 4; y++)
+    {
+        const int sy = std::min(by * 4 + y, height - 1);
+        for (int x = 0; x < 4; x++)
+        {
+            const int sx = std::min(bx * 4 + x, width - 1);
+            std::memcpy(out[y * 4 + x], rgba + (static_cast<size_t>(sy) * width + sx) * 4, 4);
+        }
+    }
+}
+
+//==============================================================
+// 主成分（ブロック内の色の広がりが最も大きい方向）
+//  - 共分散行列のべき乗法。channels は 3（RGB）か 4（RGBA）
+//  - 単色ブロックでは axis は 0 のまま
+//==============================================================
+void ComputePrincipalAxis(const Block& block, int channels, float mean[4], float axis[4])
+{
+    for (int c = 0; c < 4; c++)
+    {
+        mean[c] = 0.0f;
+        axis[c] = 0.0f;
+    }
+    for (int i = 0; i < 16; i++)
+    {
+        for (int c = 0; c < channels; c++) mean[c] += block[i][c];
+    }
+    for (int c = 0; c < channels; c++) mean[c] /= 16.0f;
+
+    float cov[4][4] = {};
+    for (int i = 0; i < 16; i++)
+    {
+        float d[4];
+        for (int c = 0; c < channels; c++) d[c] = block[i][c] - mean[c];
+        for (int r = 0; r < channels; r++)
+        {
+            for (int c = 0; c < channels; c++) cov[r][c] += d[r] * d[c];
+        }
+    }
+
+    // 分散の最も大きいチャネルの行から始める（直交した初期値を避ける）
+    int start = 0;
+    for (int c = 1; c < channels; c++)
+    {
+        if (cov[c][c] > cov[start][start]) start = c;
+    }
+    if (cov[start][start] <= 0.0f)
+    {
+        return;
+    }
+
+    float v[4] = {};
+    for (int c = 0; c < channels; c++) v[c] = cov[start][c];
+
+    for (int iter = 0; iter < 8; iter++)
+    {
+        float next[4] = {};
+        for (int r = 0; r < channels; r++)
+        {
+            for (int c = 0; c < channels; c++) next[r] += cov[r][c] * v[c];
+        }
+
+        float len = 0.0f;
+        for (int c = 0; c < channels; c++) len += next[c] * next[c];
+        len = std::sqrt(len);
+        if (len <= 1e-6f) return;
+
+        for (int c = 0; c < channels; c++) v[c] = next[c] / len;
+    }
+
+    for (int c = 0; c < channels; c++) axis[c] = v[c];
+}
+
+// 主成分上で最も離れた 2 点（inset：両端から範囲の 1/insetDiv 内側へ）
+void ComputeEndpoints(const Block& block, int channels, float insetDiv, float e0[4], float e1[4])
+{
+    float mean[4];
+    float axis[4];
+    ComputePrincipalAxis(block, channels, mean, axis);
+
+    float minT = 0.0f;
+    float maxT = 0.0f;
+    for (int i = 0; i < 16; i++)
+    {
+        float t = 0.0f;
+        for (int c = 0; c < channels; c++) t += (block[i][c] - mean[c]) * axis[c];
+        minT = std::min(minT, t);
+        maxT = std::max(maxT, t);
+    }
+
+    if (insetDiv > 0.0f)
+    {
+        const float inset = (maxT - minT) / insetDiv;
+        minT += inset;
+        maxT -= inset;
+    }
+
+    for (int c = 0; c < 4; c++)
+    {
+        e0[c] = std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+        e1[c] = std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+    }
+}
+
+// 各画素の補間位置 t（0 = e0、1 = e1）を固定して端点を最小二乗で解き直す
+//  - 全画素が同じ位置なら解けないので false
+bool RefitEndpoints(const Block& block, int channels, const float t[16], float e0[4], float e1[4])
+{
+    float a = 0.0f, b = 0.0f, c = 0.0f;
+    float d[4] = {}, e[4] = {};
+    for (int i = 0; i < 16; i++)
+    {
+        const float s = 1.0f - t[i];
+        a += s * s;
+        b += s * t[i];
+        c += t[i] * t[i];
+        for (int ch = 0; ch < channels; ch++)
+        {
+            d[ch] += s * block[i][ch];
+            e[ch] += t[i] * block[i][ch];
+        }
+    }
+
+    const float det = a * c - b * b;
+    if (std::fabs(det) < 1e-6f)
+    {
+        return false;
+    }
+    for (int ch = 0; ch < channels; ch++)
+    {
+        e0[ch] = std::clamp((c * d[ch] - b * e[ch]) / det, 0.0f, 255.0f);
+        e1[ch] = std::clamp((a * e[ch] - b * d[ch]) / det, 0.0f, 255.0f);
+    }
+    return true;
+}
+
+//==============================================================
+// BC1 カラーブロック（8 byte、常に 4 色モード）
+//==============================================================
+uint16_t To565(const float c[4])
+{
+    const int r = static_cast<int>(c[0] * 31.0f / 255.0f + 0.5f);
+    const int g = static_cast<int>(c[1] * 63.0f / 255.0f + 0.5f);
+    const int b = static_cast<int>(c[2] * 31.0f / 255.0f + 0.5f);
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+void From565(uint16_t v, int out[3])
+{
+    const int r = (v >> 11) & 31;
+    const int g = (v >> 5) & 63;
+    const int b = v & 31;
+    out[0] = (r << 3) | (r >> 2);
+    out[1] = (g << 2) | (g >> 4);
+    out[2] = (b << 3) | (b >> 2);
+}
+
+struct ColorCandidate
+{
+    uint16_t c0      = 0;
+    uint16_t c1      = 0;
+    uint32_t indices = 0;
+    int      error   = 0;
+};
+
+// 端点を 565 に丸めて、各画素に最も近いパレット色を選ぶ
+ColorCandidate EvaluateColor(const Block& block, const float e0[4], const float e1[4])
+{
+    ColorCandidate out;
+    uint16_t c0 = To565(e1);
+    uint16_t c1 = To565(e0);
+    if (c0 < c1) std::swap(c0, c1);
+    out.c0 = c0;
+    out.c1 = c1;
+
+    uint32_t indices = 0;
+    int error = 0;
+    if (c0 == c1)
+    {
+        int color[3];
+        From565(c0, color);
+        for (int i = 0; i < 16; i++)
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                const int d = block[i][c] - color[c];
+                error += d * d;
+            }
+        }
+    }
+    else
+    {
+        // パレット：c0, c1, 2/3 c0 + 1/3 c1, 1/3 c0 + 2/3 c1
+        int palette[4][3];
+        From565(c0, palette[0]);
+        From565(c1, palette[1]);
+        for (int c = 0; c < 3; c++)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+
+        for (int i = 0; i < 16; i++)
+        {
+            int best = 0;
+            int bestDist = INT32_MAX;
+            for (int p = 0; p < 4; p++)
+            {
+                int dist = 0;
+                for (int c = 0; c < 3; c++)
+                {
+                    const int d = block[i][c] - palette[p][c];
+                    dist += d * d;
+                }
+                if (dist < bestDist)
+                {
+                    bestDist = dist;
+                    best = p;
+                }
+            }
+            indices |= static_cast<uint32_t>(best) << (i * 2);
+            error += bestDist;
+        }
+    }
+
+    out.indices = indices;
+    out.error   = error;
+    return out;
+}
+
+void EncodeColorBlock(const Block& block, uint8_t* dst)
+{
+    // パレット番号 → c1 から c0 への補間位置
+    static const float kPos[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+
+    float e0[4];
+    float e1[4];
+    ComputeEndpoints(block, 3, 16.0f, e0, e1);
+    ColorCandidate best = EvaluateColor(block, e0, e1);
+
+    // 選んだパレットに合わせて端点を解き直す（良くなった分だけ採用）
+    for (int iter = 0; iter < 2 && best.error > 0 && best.c0 != best.c1; iter++)
+    {
+        float t[16];
+        for (int i = 0; i < 16; i++) t[i] = kPos[(best.indices >> (i * 2)) & 3];
+        if (!RefitEndpoints(block, 3, t, e0, e1)) break;
+
+        ColorCandidate cand = EvaluateColor(block, e0, e1);
+        if (cand.error >= best.error) break;
+        best = cand;
+    }
+
+    dst[0] = static_cast<uint8_t>(best.c0 & 0xff);
+    dst[1] = static_cast<uint8_t>(best.c0 >> 8);
+    dst[2] = static_cast<uint8_t>(best.c1 & 0xff);
+    dst[3] = static_cast<uint8_t>(best.c1 >> 8);
+    std::memcpy(dst + 4, &best.indices, 4);
+}
+
+//==============================================================
+// BC3 アルファブロック（8 byte、8 段階モード）
+//==============================================================
+void EncodeAlphaBlock(const Block& block, uint8_t* dst)
+{
+    int a0 = 0;
+    int a1 = 255;
+    for (int i = 0; i < 16; i++)
+    {
+        a0 = std::max(a0, static_cast<int>(block[i][3]));
+        a1 = std::min(a1, static_cast<int>(block[i][3]));
+    }
+
+    uint64_t indices = 0;
+    if (a0 != a1)
+    {
+        // a0 > a1 のとき：a0, a1, 両者の間を 7 等分した 6 段
+        int palette[8];
+        palette[0] = a0;
+        palette[1] = a1;
+        for (int k = 1; k <= 6; k++)
+        {
+            palette[k + 1] = ((7 - k) * a0 + k * a1) / 7;
+        }
+
+        for (int i = 0; i < 16; i++)
+        {
+            int best = 0;
+            int bestDist = INT32_MAX;
+            for (int p = 0; p < 8; p++)
+            {
+                const int dist = std::abs(block[i][3] - palette[p]);
+                if (dist < bestDist)
+                {
+                    bestDist = dist;
+                    best = p;
+                }
+            }
+            indices |= static_cast<uint64_t>(best) << (i * 3);
+        }
+    }
+
+    dst[0] = static_cast<uint8_t>(a0);
+    dst[1] = static_cast<uint8_t>(a1);
+    for (int b = 0; b < 6; b++)
+    {
+        dst[2 + b] = static_cast<uint8_t>((indices >> (b * 8)) & 0xff);
+    }
+}
+
+//==============================================================
+// BC7 ブロック（16 byte、モード 6 のみ）
+//  - 1 サブセット、RGBA 端点 7bit ＋ P ビット、4bit インデックス
+//  - 不透明／半透明を問わず使えて、エンコードが単純
+//==============================================================
+struct BitWriter
+{
+    uint8_t* dst;
+    int      pos = 0;
+
+    void Put(uint32_t value, int bits)
+    {
+        for (int b = 0; b < bits; b++, pos++)
+        {
+            if ((value >> b) & 1) dst[pos >> 3] |= static_cast<uint8_t>(1 << (pos & 7));
+        }
+    }
+};
+
+// 端点を 7bit ＋ 共有 P ビットに量子化（誤差の小さい P を選ぶ）
+void QuantizeBC7Endpoint(const float e[4], int q[4], int& pbit)
+{
+    float bestErr = 0.0f;
+    for (int p = 0; p < 2; p++)
+    {
+        int   cand[4];
+        float err = 0.0f;
+        for (int c = 0; c < 4; c++)
+        {
+            cand[c] = std::clamp(static_cast<int>((e[c] - p) * 0.5f + 0.5f), 0, 127);
+            const float d = static_cast<float>((cand[c] << 1) | p) - e[c];
+            err += d * d;
+        }
+        if (p == 0 || err < bestErr)
+        {
+            bestErr = err;
+            pbit = p;
+            std::memcpy(q, cand, sizeof(cand));
+        }
+    }
+}
+
+const int kBC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+struct BC7Candidate
+{
+    int q0[4];
+    int q1[4];
+    int p0 = 0;
+    int p1 = 0;
+    int indices[16];
+    int error = 0;
+};
+
+// 端点を量子化して、各画素に最も近い補間色を選ぶ
+BC7Candidate EvaluateBC7(const Block& block, const float e0[4], const float e1[4])
+{
+    BC7Candidate out;
+    QuantizeBC7Endpoint(e0, out.q0, out.p0);
+    QuantizeBC7Endpoint(e1, out.q1, out.p1);
+
+    int palette[16][4];
+    for (int c = 0; c < 4; c++)
+    {
+        const int v0 = (out.q0[c] << 1) | out.p0;
+        const int v1 = (out.q1[c] << 1) | out.p1;
+        for (int k = 0; k < 16; k++)
+        {
+            palette[k][c] = ((64 - kBC7Weights[k]) * v0 + kBC7Weights[k] * v1 + 32) >> 6;
+        }
+    }
+
+    for (int i = 0; i < 16; i++)
+    {
+        int best = 0;
+        int bestDist = INT32_MAX;
+        for (int k = 0; k < 16; k++)
+        {
+            int dist = 0;
+            for (int c = 0; c < 4; c++)
+            {
+                const int d = block[i][c] - palette[k][c];
+                dist += d * d;
+            }
+            if (dist < bestDist)
+            {
+                bestDist = dist;
+                best = k;
+            }
+        }
+        out.indices[i] = best;
+        out.error += bestDist;
+    }
+    return out;
+}
+
+void EncodeBC7Block(const Block& block, uint8_t* dst)
+{
+    float e0[4];
+    float e1[4];
+    ComputeEndpoints(block, 4, 0.0f, e0, e1);
+    BC7Candidate best = EvaluateBC7(block, e0, e1);
+
+    // 選んだインデックスに合わせて端点を解き直す（良くなった分だけ採用）
+    for (int iter = 0; iter < 2 && best.error > 0; iter++)
+    {
+        float t[16];
+        for (int i = 0; i < 16; i++) t[i] = kBC7Weights[best.indices[i]] / 64.0f;
+        if (!RefitEndpoints(block, 4, t, e0, e1)) break;
+
+        BC7Candidate cand = EvaluateBC7(block, e0, e1);
+        if (cand.error >= best.error) break;
+        best = cand;
+    }
+
+    // 先頭画素のインデックスは最上位ビットが 0（3bit で格納）になるよう端点を入れ替える
+    if (best.indices[0] & 8)
+    {
+        std::swap(best.q0, best.q1);
+        std::swap(best.p0, best.p1);
+        for (int& idx : best.indices) idx = 15 - idx;
+    }
+
+    std::memset(dst, 0, 16);
+    BitWriter w{ dst };
+    w.Put(1 << 6, 7);                       // モード 6
+    for (int c = 0; c < 4; c++)
+    {
+        w.Put(static_cast<uint32_t>(best.q0[c]), 7);
+        w.Put(static_cast<uint32_t>(best.q1[c]), 7);
+    }
+    w.Put(static_cast<uint32_t>(best.p0), 1);
+    w.Put(static_cast<uint32_t>(best.p1), 1);
+    w.Put(static_cast<uint32_t>(best.indices[0]), 3);
+    for (int i = 1; i < 16; i++)
+    {
+        w.Put(static_cast<uint32_t>(best.indices[i]), 4);
+    }
+}
+
+} // namespace
+
+//==============================================================
+// ミップ生成
+//==============================================================
+void GenerateMips(const uint8_t* rgba,
+                  int width,
+                  int height,
+                  std::vector<std::vector<uint8_t>>& outLevels)
+{
+    outLevels.clear();
+
+    const uint8_t* src = rgba;
+    int w = width;
+    int h = height;
+    while (w > 1 || h > 1)
+    {
+        const int nw = std::max(1, w / 2);
+        const int nh = std::max(1, h / 2);
+
+        std::vector<uint8_t> level(static_cast<size_t>(nw) * nh * 4);
+        for (int y = 0; y < nh; y++)
+        {
+            const int y0 = std::min(y * 2,     h - 1);
+            const int y1 = std::min(y * 2 + 1, h - 1);
+            for (int x = 0; x < nw; x++)
+            {
+                const int x0 = std::min(x * 2,     w - 1);
+                const int x1 = std::min(x * 2 + 1, w - 1);
+
+                const uint8_t* a = src + (static_cast<size_t>(y0) * w + x0) * 4;
+                const uint8_t* b = src + (static_cast<size_t>(y0) * w + x1) * 4;
+                const uint8_t* c = src + (static_cast<size_t>(y1) * w + x0) * 4;
+                const uint8_t* d = src + (static_cast<size_t>(y1) * w + x1) * 4;
+                uint8_t* o = level.data() + (static_cast<size_t>(y) * nw + x) * 4;
+                for (int ch = 0; ch < 4; ch++)
+                {
+                    o[ch] = static_cast<uint8_t>((a[ch] + b[ch] + c[ch] + d[ch] + 2) >> 2);
+                }
+            }
+        }
+
+        outLevels.push_back(std::move(level));
+        src = outLevels.back().data();
+        w = nw;
+        h = nh;
+    }
+}
+
+bool HasAlpha(const uint8_t* rgba, size_t numPixels)
+{
+    for (size_t i = 0; i < numPixels; i++)
+    {
+        if (rgba[i * 4 + 3] != 255) return true;
+    }
+    return false;
+}
+
+size_t ComputeLevelSize(TextureFormat format, int width, int height)
+{
+    const size_t blocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+    switch (format)
+    {
+        case TextureFormat::BC1: return blocks * 8;
+        case TextureFormat::BC3:
+        case TextureFormat::BC7: return blocks * 16;
+        default:                 return static_cast<size_t>(width) * height * 4;
+    }
+}
+
+//==============================================================
+// エンコード
+//==============================================================
+void Encode(TextureFormat format,
+            const uint8_t* rgba,
+            int width,
+            int height,
+            std::vector<uint8_t>& out)
+{
+    const size_t start = out.size();
+    out.resize(start + ComputeLevelSize(format, width, height));
+    uint8_t* dst = out.data() + start;
+
+    if (format == TextureFormat::RGBA8)
+    {
+        std::memcpy(dst, rgba, static_cast<size_t>(width) * height * 4);
+        return;
+    }
+
+    const int blocksX = (width + 3) / 4;
+    const int blocksY = (height + 3) / 4;
+    Block block;
+    for (int by = 0; by < blocksY; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            LoadBlock(rgba, width, height, bx, by, block);
+            switch (format)
+            {
+                case TextureFormat::BC1:
+                    EncodeColorBlock(block, dst);
+                    dst += 8;
+                    break;
+                case TextureFormat::BC3:
+                    EncodeAlphaBlock(block, dst);
+                    EncodeColorBlock(block, dst + 8);
+                    dst += 16;
+                    break;
+                default:
+                    EncodeBC7Block(block, dst);
+                    dst += 16;
+                    break;
+            }
+        }
+    }
+}
+
+} // namespace TextureCompression
+} // namespace toy
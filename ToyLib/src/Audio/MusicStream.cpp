@@ -0,0 +1,333 @@
+// Audio/MusicStream.cpp
+#include "Audio/MusicStream.h"
+
+#include "Asset/Audio/Music.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace toy {
+
+namespace {
+
+// これより空きが少なければデコードしない（細切れの mpg123_read を避ける）
+constexpr size_t kMinDecodeBytes = 4 * 1024;
+
+} // namespace
+
+MusicStream::MusicStream()
+: mLoop(true)
+, mEndOfStream(false)
+, mSource(0)
+, mFormat(AL_FORMAT_STEREO16)
+, mRate(0)
+, mFrameBytes(4)
+, mQueuedBytes(0)
+, mNumQueued(0)
+, mStarted(false)
+, mUnderruns(0)
+, mFade(1.0f)
+, mFadeTarget(1.0f)
+, mFadeSpeed(0.0f)
+{
+}
+
+MusicStream::~MusicStream()
+{
+}
+
+//--------------------------------------
+// 曲を開く
+//  - デコード位置を先頭に戻し、リングを曲のフォーマットに合わせて空にする
+//  - 最初のデータはオーディオスレッドが書くので、鳴り始めは次の Service 以降
+//--------------------------------------
+bool MusicStream::Open(std::shared_ptr<Music> music, bool loop,
+                       const MusicStreamSettings& settings)
+{
+    Close();
+    if (!music || music->GetRate() <= 0 || music->GetChannels() <= 0)
+        return false;
+
+    mSettings = settings;
+    mSettings.minBuffers = std::max(mSettings.minBuffers, 2);
+    mSettings.maxBuffers = std::max(mSettings.maxBuffers, mSettings.minBuffers);
+
+    // BGM は原点固定＆距離減衰なし（2D 的）
+    if (mSource == 0)
+    {
+        alGenSources(1, &mSource);
+        alSourcei (mSource, AL_SOURCE_RELATIVE, AL_TRUE);
+        alSource3f(mSource, AL_POSITION, 0, 0, 0);
+        alSourcef (mSource, AL_ROLLOFF_FACTOR, 0.0f);
+        alSourcei (mSource, AL_LOOPING, AL_FALSE); // ループは自前で実装
+    }
+    while (static_cast<int>(mBuffers.size()) < mSettings.minBuffers)
+    {
+        ALuint buf = 0;
+        alGenBuffers(1, &buf);
+        mBuffers.push_back(buf);
+        mFreeBuffers.push_back(buf);
+    }
+
+    mMusic = std::move(music);
+    mLoop  = loop;
+    mMusic->Rewind();
+
+    mFormat     = (mMusic->GetChannels() == 2) ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16;
+    mRate       = mMusic->GetRate();
+    mFrameBytes = static_cast<size_t>(mMusic->GetChannels()) * 2;
+
+    const size_t bytesPerSec = static_cast<size_t>(mRate) * mFrameBytes;
+    mRing.Reset(static_cast<size_t>(bytesPerSec * std::max(mSettings.ringSeconds, 0.25f)));
+    mEndOfStream.store(false, std::memory_order_release);
+
+    mQueuedBytes = 0;
+    mNumQueued   = 0;
+    mStarted     = false;
+
+    mFade       = 1.0f;
+    mFadeTarget = 1.0f;
+    mFadeSpeed  = 0.0f;
+    return true;
+}
+
+void MusicStream::Close()
+{
+    if (mSource != 0)
+    {
+        // 再生停止 → キュー済みバッファを外して空きへ
+        alSourceStop(mSource);
+
+        ALint queued = 0;
+        alGetSourcei(mSource, AL_BUFFERS_QUEUED, &queued);
+        while (queued-- > 0)
+        {
+            ALuint buf = 0;
+            alSourceUnqueueBuffers(mSource, 1, &buf);
+            mFreeBuffers.push_back(buf);
+        }
+    }
+
+    mMusic.reset();
+    mQueuedBytes = 0;
+    mNumQueued   = 0;
+    mStarted     = false;
+}
+
+void MusicStream::Release()
+{
+    Close();
+    if (mSource != 0)
+    {
+        alDeleteSources(1, &mSource);
+        mSource = 0;
+    }
+    if (!mBuffers.empty())
+    {
+        alDeleteBuffers(static_cast<ALsizei>(mBuffers.size()), mBuffers.data());
+    }
+    mBuffers.clear();
+    mFreeBuffers.clear();
+}
+
+//--------------------------------------
+// デコード（オーディオスレッド）
+//  - 曲末ではループなら先頭へ戻り、そうでなければ終わりの印を付ける
+//--------------------------------------
+size_t MusicStream::Decode(std::vector<unsigned char>& scratch)
+{
+    if (!mMusic || mEndOfStream.load(std::memory_order_relaxed))
+        return 0;
+
+    // フレーム境界で区切る（消費側もフレーム単位で読む）
+    size_t space = mRing.GetWritable();
+    space -= space % mFrameBytes;
+    if (space < kMinDecodeBytes)
+        return 0;
+
+    const size_t want = std::min(space, scratch.size() - scratch.size() % mFrameBytes);
+    size_t bytes = mMusic->ReadChunk(scratch.data(), want);
+    if (bytes == 0)
+    {
+        if (!mLoop)
+        {
+            mEndOfStream.store(true, std::memory_order_release);
+            return 0;
+        }
+
+        // 曲末に到達 → ループ再生
+        mMusic->Rewind();
+        bytes = mMusic->ReadChunk(scratch.data(), want);
+        if (bytes == 0)
+        {
+            // 先頭からも読めない（壊れたファイルなど）
+            mEndOfStream.store(true, std::memory_order_release);
+            return 0;
+        }
+    }
+
+    return mRing.Write(scratch.data(), bytes);
+}
+
+//--------------------------------------
+// 毎フレーム（ゲームスレッド）
+//  - 直近の重いフレームの 3 倍ぶんを先に積んでおく（上下限あり）
+//  - 1 バッファはその半分ほど。軽いフレームが続けば短くなり遅延が減る
+//--------------------------------------
+void MusicStream::Service(float deltaTime, float peakFrame, float volume)
+{
+    if (!mMusic || mSource == 0)
+        return;
+
+    // フェード
+    if (mFade != mFadeTarget)
+    {
+        const float step = mFadeSpeed * deltaTime;
+        mFade = (mFade < mFadeTarget)
+            ? std::min(mFade + step, mFadeTarget)
+            : std::max(mFade - step, mFadeTarget);
+    }
+    alSourcef(mSource, AL_GAIN, volume * mFade);
+
+    UnqueueProcessed();
+
+    const float lead  = std::clamp(peakFrame * 3.0f, mSettings.minLead, mSettings.maxLead);
+    const float chunk = std::clamp(peakFrame * 1.5f, mSettings.minChunk, mSettings.maxChunk);
+
+    const size_t bytesPerSec = static_cast<size_t>(mRate) * mFrameBytes;
+    size_t chunkBytes = static_cast<size_t>(bytesPerSec * chunk);
+    chunkBytes -= chunkBytes % mFrameBytes;
+    if (mUpload.size() < chunkBytes)
+    {
+        mUpload.resize(chunkBytes);
+    }
+
+    while (BytesToSeconds(mQueuedBytes) < lead || mNumQueued < mSettings.minBuffers)
+    {
+        size_t readable = mRing.GetReadable();
+        readable -= readable % mFrameBytes;
+        if (readable == 0)
+            break;
+
+        const ALuint buf = AcquireBuffer();
+        if (buf == 0)
+            break;
+
+        const size_t bytes = mRing.Read(mUpload.data(), std::min(readable, chunkBytes));
+        alBufferData(buf,
+                     mFormat,
+                     mUpload.data(),
+                     static_cast<ALsizei>(bytes),
+                     static_cast<ALsizei>(mRate));
+        alSourceQueueBuffers(mSource, 1, &buf);
+
+        mQueuedBytes += bytes;
+        mNumQueued++;
+    }
+
+    // 止まっていたら再開（最初の再生、または途切れた）
+    ALint state = 0;
+    alGetSourcei(mSource, AL_SOURCE_STATE, &state);
+    if (state != AL_PLAYING && mNumQueued > 0)
+    {
+        if (mStarted)
+        {
+            mUnderruns++;
+            printf("[MusicStream] Underrun (lead %.0f ms, %d buffers)\n",
+                   lead * 1000.0f, static_cast<int>(mBuffers.size()));
+        }
+        alSourcePlay(mSource);
+        mStarted = true;
+    }
+}
+
+void MusicStream::UnqueueProcessed()
+{
+    ALint processed = 0;
+    alGetSourcei(mSource, AL_BUFFERS_PROCESSED, &processed);
+
+    while (processed-- > 0)
+    {
+        ALuint buf = 0;
+        alSourceUnqueueBuffers(mSource, 1, &buf);
+
+        ALint size = 0;
+        alGetBufferi(buf, AL_SIZE, &size);
+        mQueuedBytes -= std::min(mQueuedBytes, static_cast<size_t>(size));
+        mNumQueued--;
+
+        mFreeBuffers.push_back(buf);
+    }
+}
+
+ALuint MusicStream::AcquireBuffer()
+{
+    if (mFreeBuffers.empty())
+    {
+        if (static_cast<int>(mBuffers.size()) >= mSettings.maxBuffers)
+            return 0;
+
+        ALuint buf = 0;
+        alGenBuffers(1, &buf);
+        if (buf == 0)
+            return 0;
+        mBuffers.push_back(buf);
+        return buf;
+    }
+
+    const ALuint buf = mFreeBuffers.back();
+    mFreeBuffers.pop_back();
+    return buf;
+}
+
+float MusicStream::BytesToSeconds(size_t bytes) const
+{
+    if (mRate <= 0)
+        return 0.0f;
+    return static_cast<float>(bytes) / (static_cast<float>(mRate) * mFrameBytes);
+}
+
+//--------------------------------------
+// フェード
+//--------------------------------------
+void MusicStream::SetFade(float fade)
+{
+    mFade       = std::clamp(fade, 0.0f, 1.0f);
+    mFadeTarget = mFade;
+    mFadeSpeed  = 0.0f;
+}
+
+void MusicStream::FadeTo(float target, float seconds)
+{
+    mFadeTarget = std::clamp(target, 0.0f, 1.0f);
+    if (seconds <= 0.0f)
+    {
+        mFade      = mFadeTarget;
+        mFadeSpeed = 0.0f;
+        return;
+    }
+    mFadeSpeed = std::fabs(mFadeTarget - mFade) / seconds;
+}
+
+bool MusicStream::IsFinished() const
+{
+    return mMusic &&
+           !mLoop &&
+           mEndOfStream.load(std::memory_order_acquire) &&
+           mRing.GetReadable() < mFrameBytes &&
+           mNumQueued == 0;
+}
+
+MusicStreamStats MusicStream::GetStats() const
+{
+    MusicStreamStats stats;
+    stats.numBuffers      = static_cast<int>(mBuffers.size());
+    stats.numQueued       = mNumQueued;
+    stats.queuedSeconds   = BytesToSeconds(mQueuedBytes);
+    stats.bufferedSeconds = mMusic ? BytesToSeconds(mRing.GetReadable()) : 0.0f;
+    stats.underruns       = mUnderruns;
+    return stats;
+}
+
+} // namespace toy
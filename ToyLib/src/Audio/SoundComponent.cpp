@@ -5,6 +5,7 @@
 #include "Engine/Core/Application.h"
 #include "Asset/AssetManager.h"
 #include "Asset/Audio/SoundEffect.h"
+#include "Audio/SoundMixer.h"
 #include "Engine/Render/Renderer.h"
 #include "Utils/MathUtil.h"
 #include <iostream>
@@ -19,19 +20,16 @@ SoundComponent::SoundComponent(Actor* owner, int updateOrder)
 , mUseDistanceAttenuation(false)
 , mIsExclusive(false)
 , mHasPlayed(false)
-, mSource(0)
+, mCategory(SoundCategory::Effect)
+, mPriority(0)
+, mVoice(0)
 {
 }
 
 SoundComponent::~SoundComponent()
 {
-    // 自前のソースを停止・破棄
+    // 鳴っているボイスを止める（ソースはプールへ戻る）
     Stop();
-    if (mSource != 0)
-    {
-        alDeleteSources(1, &mSource);
-        mSource = 0;
-    }
 }
 
 //--------------------------------------
@@ -57,30 +55,20 @@ void SoundComponent::Play()
     auto sound   = assets->GetSoundEffect(mSoundName);
     if (!sound) return;
 
-    // ソース生成（初回のみ）
-    if (mSource == 0)
-    {
-        alGenSources(1, &mSource);
-
-        // 距離減衰に関するパラメータ（3D SE 用）
-        // ※ mUseDistanceAttenuation のオン/オフに応じて
-        //    ここを分ける実装も可能
-        alSourcef(mSource, AL_REFERENCE_DISTANCE, 3.0f);  // この距離まではほぼフル音量
-        alSourcef(mSource, AL_MAX_DISTANCE,      50.0f);  // これ以上離れてもあまり変わらない
-        alSourcef(mSource, AL_ROLLOFF_FACTOR,    1.0f);   // 減衰の強さ
-    }
-
-    // バッファ・ボリューム・ループ設定
-    alSourcei(mSource, AL_BUFFER, sound->GetBuffer());
-    alSourcef(mSource, AL_GAIN, mVolume);
-    alSourcei(mSource, AL_LOOPING, mIsLoop ? AL_TRUE : AL_FALSE);
-
-    // 現在の Actor 位置を OpenAL ソースに反映
-    auto pos = GetOwner()->GetPosition();
-    alSource3f(mSource, AL_POSITION, pos.x, pos.y, pos.z);
+    // 前のボイスは止めて鳴らし直す
+    Stop();
 
-    // 再生開始
-    alSourcePlay(mSource);
+    // 距離減衰の値は VoiceParams の既定（参照 3 / 最大 50 / 減衰 1）
+    VoiceParams params;
+    params.sound      = sound;
+    params.category   = mCategory;
+    params.priority   = mPriority;
+    params.volume     = mVolume;
+    params.loop       = mIsLoop;
+    params.positional = mUseDistanceAttenuation;
+    params.position   = GetOwner()->GetPosition();
+
+    mVoice = app->GetSoundMixer()->GetVoicePool()->Play(params);
 }
 
 //--------------------------------------
@@ -88,9 +76,10 @@ void SoundComponent::Play()
 //--------------------------------------
 void SoundComponent::Stop()
 {
-    if (mSource != 0)
+    if (mVoice != 0)
     {
-        alSourceStop(mSource);
+        GetOwner()->GetApp()->GetSoundMixer()->GetVoicePool()->Stop(mVoice);
+        mVoice = 0;
     }
 }
 
@@ -99,11 +88,10 @@ void SoundComponent::Stop()
 //--------------------------------------
 bool SoundComponent::IsPlaying() const
 {
-    if (mSource == 0) return false;
+    if (mVoice == 0) return false;
 
-    ALint state = 0;
-    alGetSourcei(mSource, AL_SOURCE_STATE, &state);
-    return (state == AL_PLAYING);
+    // 仮想ボイス（今は音源が無い）も鳴っている扱い
+    return GetOwner()->GetApp()->GetSoundMixer()->GetVoicePool()->IsPlaying(mVoice);
 }
 
 //--------------------------------------
@@ -118,23 +106,19 @@ void SoundComponent::Update(float)
         mHasPlayed = true;
     }
 
-    if (mSource != 0)
+    if (mVoice != 0)
     {
-        ALint state = 0;
-        alGetSourcei(mSource, AL_SOURCE_STATE, &state);
+        auto* pool = GetOwner()->GetApp()->GetSoundMixer()->GetVoicePool();
 
-        // 再生中なら Actor の位置に追従させる
-        if (state == AL_PLAYING)
+        // 再生中なら Actor の位置に追従させる（仮想ボイスも距離の判定に使う）
+        if (pool->IsPlaying(mVoice))
         {
-            auto pos = GetOwner()->GetPosition();
-            alSource3f(mSource, AL_POSITION, pos.x, pos.y, pos.z);
+            pool->SetPosition(mVoice, GetOwner()->GetPosition());
         }
-
-        // ループしない場合、再生終了後にフラグリセットなどを行いたければここで処理
-        if (!mIsLoop && state == AL_STOPPED)
+        else
         {
-            // TODO: 必要ならここでイベント通知やフラグリセットを行う
-            // 例: mHasPlayed = false;
+            // ループしない場合の再生終了。イベント通知などを行いたければここで処理
+            mVoice = 0;
         }
     }
 }
@@ -4,9 +4,12 @@
 #include "Asset/AssetManager.h"
 #include "Asset/Audio/Music.h"
 #include "Asset/Audio/SoundEffect.h"
+#include "Utils/JsonHelper.h"
 
 #include <cstdio>
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 
 namespace toy {
 
@@ -14,9 +17,9 @@ SoundMixer::SoundMixer(AssetManager* assetManager)
 : mAssetManager(assetManager)
 , mDevice(nullptr)
 , mContext(nullptr)
-, mBgmSource(0)
-, mBgmPlaying(false)
+, mBgmActive(0)
 , mBgmLoop(true)
+, mPeakFrame(1.0f / 60.0f)
 , mBgmEnabled(true)
 , mSoundEnabled(true)
 , mVolume(1.0f)
@@ -24,22 +27,28 @@ SoundMixer::SoundMixer(AssetManager* assetManager)
     // OpenAL 初期化（デバイス + コンテキスト）
     InitOpenAL();
 
-    // BGM デコード用一時バッファ
-    mBgmDecodeBuffer.resize(BGM_CHUNK_SIZE);
+    // SE 用ソース（既定の数。LoadSettings で作り直す）
+    //  - ゲーム初期化中から SoundComponent が鳴らすので、ここで作っておく
+    if (mContext)
+    {
+        mVoicePool.Initialize(VoiceSettings());
+    }
+
+    // BGM デコード用のオーディオスレッド
+    StartStreamThread();
 }
 
 SoundMixer::~SoundMixer()
 {
-    // BGM ソース・バッファ片付け
-    ShutdownBGMSource();
-
-    // SE 用ワンショットソースの片付け
-    for (ALuint src : mOneShotSources)
+    // オーディオスレッドを止めてから BGM ソース・バッファ片付け
+    StopStreamThread();
+    for (auto& stream : mBgmStreams)
     {
-        alSourceStop(src);
-        alDeleteSources(1, &src);
+        stream.Release();
     }
-    mOneShotSources.clear();
+
+    // SE 用ソースの片付け（コンテキストを壊す前に）
+    mVoicePool.Shutdown();
 
     // OpenAL デバイス/コンテキスト破棄
     ShutdownOpenAL();
@@ -96,44 +105,55 @@ void SoundMixer::ShutdownOpenAL()
 }
 
 //--------------------------------------
-// BGM 用ソース/バッファ準備・破棄
+// オーディオスレッド
+//  - リングに空きがあるストリームをデコードし、無ければ少し眠る
+//  - ゲームスレッドが曲を切り替えるときだけロックを取り合うので、
+//    1 周ごとにロックを離す
 //--------------------------------------
-void SoundMixer::InitBGMSource()
+void SoundMixer::StartStreamThread()
 {
-    if (mBgmSource == 0)
+    mStreamQuit = false;
+    mStreamThread = std::thread(&SoundMixer::StreamThreadLoop, this);
+}
+
+void SoundMixer::StopStreamThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(mStreamMutex);
+        mStreamQuit = true;
+    }
+    mStreamCond.notify_all();
+
+    if (mStreamThread.joinable())
     {
-        // ストリーミング用ソース + バッファ
-        alGenSources(1, &mBgmSource);
-        alGenBuffers(BGM_NUM_BUFFERS, mBgmBuffers);
-
-        // BGM は原点固定＆距離減衰なし（2D 的）
-        alSource3f(mBgmSource, AL_POSITION, 0, 0, 0);
-        alSourcef (mBgmSource, AL_ROLLOFF_FACTOR, 0.0f);
-        alSourcei (mBgmSource, AL_LOOPING, AL_FALSE); // ループは自前で実装
+        mStreamThread.join();
     }
 }
 
-void SoundMixer::ShutdownBGMSource()
+void SoundMixer::StreamThreadLoop()
 {
-    if (mBgmSource != 0)
-    {
-        // 再生停止
-        alSourceStop(mBgmSource);
+    std::vector<unsigned char> scratch(BGM_DECODE_SIZE);
 
-        // キュー済みバッファを外す
-        ALint queued = 0;
-        alGetSourcei(mBgmSource, AL_BUFFERS_QUEUED, &queued);
-        while (queued-- > 0)
+    std::unique_lock<std::mutex> lock(mStreamMutex);
+    while (!mStreamQuit)
+    {
+        size_t decoded = 0;
+        for (auto& stream : mBgmStreams)
         {
-            ALuint buf = 0;
-            alSourceUnqueueBuffers(mBgmSource, 1, &buf);
+            decoded += stream.Decode(scratch);
         }
 
-        // ソース・バッファ削除
-        alDeleteSources(1, &mBgmSource);
-        alDeleteBuffers(BGM_NUM_BUFFERS, mBgmBuffers);
-
-        mBgmSource = 0;
+        if (decoded == 0)
+        {
+            // どれも満杯（または曲なし）：消費されるまで待つ
+            mStreamCond.wait_for(lock, std::chrono::milliseconds(10));
+        }
+        else
+        {
+            lock.unlock();
+            std::this_thread::yield();
+            lock.lock();
+        }
     }
 }
 
@@ -154,10 +174,8 @@ void SoundMixer::SetSoundEnable(bool enable)
 
 void SoundMixer::SetVolume(float volume)
 {
+    // BGM は次の Update でフェードと掛けて反映
     mVolume = std::clamp(volume, 0.0f, 1.0f);
-
-    if (mBgmSource != 0)
-        alSourcef(mBgmSource, AL_GAIN, mVolume);
 }
 
 //--------------------------------------
@@ -170,94 +188,178 @@ bool SoundMixer::LoadBGM(const std::string& fileName)
     return (mCurrentBGM != nullptr);
 }
 
-void SoundMixer::PlayBGM()
+//--------------------------------------
+// PlayBGM
+//  - 今の曲はもう一方のストリームへ回してフェードアウトし、
+//    新しい曲をフェードインする（前のフェードアウト中の曲は打ち切り）
+//  - 同じ Music は 2 本で同時にデコードできないので、
+//    同じ曲を鳴らし直すときはクロスフェードせずに切り替える
+//--------------------------------------
+void SoundMixer::PlayBGM(float fadeTime)
 {
-    if (!mBgmEnabled || !mCurrentBGM) return;
+    if (!mBgmEnabled || !mCurrentBGM || !mContext) return;
 
-    InitBGMSource();
-
-    // 既存キューをすべて外す
-    alSourceStop(mBgmSource);
-    ALint queued = 0;
-    alGetSourcei(mBgmSource, AL_BUFFERS_QUEUED, &queued);
-    while (queued-- > 0)
     {
-        ALuint buf = 0;
-        alSourceUnqueueBuffers(mBgmSource, 1, &buf);
-    }
+        std::lock_guard<std::mutex> lock(mStreamMutex);
 
-    // デコード位置を先頭に戻す
-    mCurrentBGM->Rewind();
+        MusicStream& current = mBgmStreams[mBgmActive];
+        MusicStream& other   = mBgmStreams[1 - mBgmActive];
+        other.Close();
 
-    // 最初に複数バッファを埋めてキューへ
-    for (int i = 0; i < BGM_NUM_BUFFERS; ++i)
-    {
-        size_t bytes = mCurrentBGM->ReadChunk(
-            mBgmDecodeBuffer.data(),
-            BGM_CHUNK_SIZE
-        );
-        if (bytes == 0) break;
-
-        ALenum format = (mCurrentBGM->GetChannels() == 2)
-            ? AL_FORMAT_STEREO16
-            : AL_FORMAT_MONO16;
-
-        alBufferData(mBgmBuffers[i],
-                     format,
-                     mBgmDecodeBuffer.data(),
-                     static_cast<ALsizei>(bytes),
-                     static_cast<ALsizei>(mCurrentBGM->GetRate()));
-
-        alSourceQueueBuffers(mBgmSource, 1, &mBgmBuffers[i]);
+        const bool crossfade = (fadeTime > 0.0f &&
+                                current.IsOpen() &&
+                                current.GetMusic() != mCurrentBGM);
+        if (crossfade)
+        {
+            current.FadeTo(0.0f, fadeTime);
+            mBgmActive = 1 - mBgmActive;
+        }
+        else
+        {
+            current.Close();
+        }
+
+        MusicStream& next = mBgmStreams[mBgmActive];
+        if (next.Open(mCurrentBGM, mBgmLoop, mBgmSettings))
+        {
+            next.SetFade(fadeTime > 0.0f ? 0.0f : 1.0f);
+            next.FadeTo(1.0f, fadeTime);
+        }
     }
 
-    alSourcef(mBgmSource, AL_GAIN, mVolume);
-    alSourcePlay(mBgmSource);
-    mBgmPlaying = true;
+    // 最初のデータをすぐにデコードさせる
+    mStreamCond.notify_one();
 }
 
-void SoundMixer::StopBGM()
+void SoundMixer::StopBGM(float fadeTime)
 {
-    if (mBgmSource != 0)
-    {
-        alSourceStop(mBgmSource);
-        mBgmPlaying = false;
+    std::lock_guard<std::mutex> lock(mStreamMutex);
 
-        if (mCurrentBGM)
-            mCurrentBGM->Rewind();
+    for (auto& stream : mBgmStreams)
+    {
+        if (fadeTime > 0.0f)
+            stream.FadeTo(0.0f, fadeTime);
+        else
+            stream.Close();
     }
 }
 
+void SoundMixer::CrossfadeBGM(const std::string& fileName, float fadeTime)
+{
+    if (!LoadBGM(fileName)) return;
+    PlayBGM(fadeTime < 0.0f ? mBgmSettings.crossfade : fadeTime);
+}
+
+MusicStreamStats SoundMixer::GetBGMStats() const
+{
+    return mBgmStreams[mBgmActive].GetStats();
+}
+
 //--------------------------------------
 // 効果音（ワンショット）
 //--------------------------------------
-void SoundMixer::PlaySoundEffect(const std::string& fileName)
+void SoundMixer::PlaySoundEffect(const std::string& fileName,
+                                 SoundCategory category,
+                                 int priority)
 {
     if (!mSoundEnabled) return;
 
     auto se = mAssetManager->GetSoundEffect(fileName);
     if (!se) return;
 
-    // 1 回使い捨てソースを生成
-    ALuint src = 0;
-    alGenSources(1, &src);
+    // プールのソースで鳴らす（2D 的に原点固定・距離減衰なし）
+    VoiceParams params;
+    params.sound    = se;
+    params.category = category;
+    params.priority = priority;
+    params.volume   = mVolume;
+    mVoicePool.Play(params);
+}
 
-    alSourcei(src, AL_BUFFER, se->GetBuffer());
-    alSourcef(src, AL_GAIN, mVolume);
-    alSource3f(src, AL_POSITION, 0, 0, 0);   // 現状は 2D 的に原点固定
-    alSourcef(src, AL_ROLLOFF_FACTOR, 0.0f); // 距離減衰なし
+//--------------------------------------
+// LoadSettings
+//   - Renderer_Settings.json の "audio" セクション
+//
+//   "audio": {
+//       "max_sources": 32,
+//       "max_voices": 128,
+//       "audible_threshold": 0.01,
+//       "category_caps": { "effect": 24, "ambient": 8, "voice": 4, "ui": 4 },
+//       "bgm": {
+//           "min_buffers": 3, "max_buffers": 12,
+//           "min_chunk": 0.025, "max_chunk": 0.25,
+//           "min_lead": 0.2, "max_lead": 1.0,
+//           "ring_seconds": 2.0, "crossfade": 1.5
+//       }
+//   }
+//--------------------------------------
+bool SoundMixer::LoadSettings(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        printf("[SoundMixer] Failed to open settings file: %s\n", filePath.c_str());
+        return false;
+    }
+
+    nlohmann::json data;
+    try
+    {
+        file >> data;
+    }
+    catch (const std::exception& e)
+    {
+        printf("[SoundMixer] JSON parse error: %s\n", e.what());
+        return false;
+    }
+
+    VoiceSettings settings = mVoicePool.GetSettings();
+    if (data.contains("audio"))
+    {
+        const auto& audio = data["audio"];
+        JsonHelper::GetInt  (audio, "max_sources",       settings.maxSources);
+        JsonHelper::GetInt  (audio, "max_voices",        settings.maxVoices);
+        JsonHelper::GetFloat(audio, "audible_threshold", settings.audibleThreshold);
 
-    alSourcePlay(src);
-    mOneShotSources.push_back(src);
+        if (audio.contains("category_caps"))
+        {
+            const auto& caps = audio["category_caps"];
+            for (int i = 0; i < static_cast<int>(SoundCategory::Count); i++)
+            {
+                const char* name = VoicePool::GetCategoryName(static_cast<SoundCategory>(i));
+                JsonHelper::GetInt(caps, name, settings.categoryCaps[i]);
+            }
+        }
+
+        // BGM（次に PlayBGM した曲から）
+        if (audio.contains("bgm"))
+        {
+            const auto& bgm = audio["bgm"];
+            JsonHelper::GetInt  (bgm, "min_buffers",  mBgmSettings.minBuffers);
+            JsonHelper::GetInt  (bgm, "max_buffers",  mBgmSettings.maxBuffers);
+            JsonHelper::GetFloat(bgm, "min_chunk",    mBgmSettings.minChunk);
+            JsonHelper::GetFloat(bgm, "max_chunk",    mBgmSettings.maxChunk);
+            JsonHelper::GetFloat(bgm, "min_lead",     mBgmSettings.minLead);
+            JsonHelper::GetFloat(bgm, "max_lead",     mBgmSettings.maxLead);
+            JsonHelper::GetFloat(bgm, "ring_seconds", mBgmSettings.ringSeconds);
+            JsonHelper::GetFloat(bgm, "crossfade",    mBgmSettings.crossfade);
+        }
+    }
+
+    if (mContext)
+    {
+        mVoicePool.Initialize(settings);
+    }
+    return true;
 }
 
 //--------------------------------------
 // 毎フレーム更新
 //  - リスナー位置更新（カメラの invViewMatrix ベース）
-//  - BGM ストリーミング
-//  - 再生終了した SE ソースの削除
+//  - BGM ストリーミング（デコード済み PCM を OpenAL のキューへ）
+//  - ボイスの更新（終了したものの片付け・音源の割り当て直し）
 //--------------------------------------
-void SoundMixer::Update(float,
+void SoundMixer::Update(float deltaTime,
                         const Matrix4& invViewMatrix)
 {
     //====================
@@ -282,85 +384,36 @@ void SoundMixer::Update(float,
     //====================
     // BGM ストリーミング
     //====================
-    if (mBgmPlaying && mCurrentBGM && mBgmSource != 0)
-    {
-        ALint processed = 0;
-        alGetSourcei(mBgmSource, AL_BUFFERS_PROCESSED, &processed);
-
-        while (processed-- > 0)
-        {
-            ALuint buf = 0;
-            alSourceUnqueueBuffers(mBgmSource, 1, &buf);
-
-            // 次のチャンクをデコード
-            size_t bytes = mCurrentBGM->ReadChunk(
-                mBgmDecodeBuffer.data(),
-                BGM_CHUNK_SIZE
-            );
+    // 直近の重いフレーム（先読み量とバッファの長さに使う。1 秒に 0.25 秒ずつ戻す）
+    mPeakFrame = std::max(deltaTime, mPeakFrame - deltaTime * 0.25f);
 
-            if (bytes > 0)
-            {
-                ALenum format = (mCurrentBGM->GetChannels() == 2)
-                    ? AL_FORMAT_STEREO16
-                    : AL_FORMAT_MONO16;
+    bool consumed = false;
+    for (auto& stream : mBgmStreams)
+    {
+        if (!stream.IsOpen())
+            continue;
 
-                alBufferData(buf,
-                             format,
-                             mBgmDecodeBuffer.data(),
-                             static_cast<ALsizei>(bytes),
-                             static_cast<ALsizei>(mCurrentBGM->GetRate()));
+        stream.Service(deltaTime, mPeakFrame, mVolume);
+        consumed = true;
 
-                alSourceQueueBuffers(mBgmSource, 1, &buf);
-            }
-            else
-            {
-                // 曲末に到達 → ループ再生
-                mCurrentBGM->Rewind();
-                bytes = mCurrentBGM->ReadChunk(
-                    mBgmDecodeBuffer.data(),
-                    BGM_CHUNK_SIZE
-                );
-
-                if (bytes > 0)
-                {
-                    ALenum format = (mCurrentBGM->GetChannels() == 2)
-                        ? AL_FORMAT_STEREO16
-                        : AL_FORMAT_MONO16;
-
-                    alBufferData(buf,
-                                 format,
-                                 mBgmDecodeBuffer.data(),
-                                 static_cast<ALsizei>(bytes),
-                                 static_cast<ALsizei>(mCurrentBGM->GetRate()));
-
-                    alSourceQueueBuffers(mBgmSource, 1, &buf);
-                }
-            }
+        // フェードアウトし終えた / ループしない曲が終わった
+        if (stream.IsFadedOut() || stream.IsFinished())
+        {
+            std::lock_guard<std::mutex> lock(mStreamMutex);
+            stream.Close();
         }
     }
 
-    //====================
-    // SE ソースの掃除
-    //====================
-    std::vector<ALuint> alive;
-    alive.reserve(mOneShotSources.size());
-
-    for (ALuint src : mOneShotSources)
+    // リングに空きができたのでデコードさせる
+    if (consumed)
     {
-        ALint state = 0;
-        alGetSourcei(src, AL_SOURCE_STATE, &state);
-
-        if (state == AL_STOPPED)
-        {
-            alDeleteSources(1, &src);
-        }
-        else
-        {
-            alive.push_back(src);
-        }
+        mStreamCond.notify_one();
     }
 
-    mOneShotSources.swap(alive);
+    //====================
+    // ボイス
+    //====================
+    mVoicePool.Update(deltaTime, pos);
 }
 
 } // namespace toy
@@ -0,0 +1,452 @@
+// Audio/VoicePool.cpp
+#include "Audio/VoicePool.h"
+
+#include "Asset/Audio/SoundEffect.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace toy {
+
+namespace {
+
+constexpr int kNumCategories = static_cast<int>(SoundCategory::Count);
+
+// ハンドル = (世代 << 16) | (添字 + 1)
+VoiceHandle MakeHandle(size_t index, uint16_t generation)
+{
+    return (static_cast<VoiceHandle>(generation) << 16) |
+           static_cast<VoiceHandle>(index + 1);
+}
+
+} // namespace
+
+VoicePool::VoicePool()
+: mListenerPos(Vector3::Zero)
+, mOrder(0)
+, mNextGeneration(0)
+{
+}
+
+VoicePool::~VoicePool()
+{
+    Shutdown();
+}
+
+//--------------------------------------
+// 初期化 / 後始末
+//--------------------------------------
+void VoicePool::Initialize(const VoiceSettings& settings)
+{
+    Shutdown();
+
+    mSettings = settings;
+    mSettings.maxSources = std::max(mSettings.maxSources, 1);
+    mSettings.maxVoices  = std::max(mSettings.maxVoices, mSettings.maxSources);
+
+    // 1 つずつ作り、失敗したらそこまで（BGM 用にも残しておく必要がある）
+    alGetError();
+    for (int i = 0; i < mSettings.maxSources; i++)
+    {
+        ALuint src = 0;
+        alGenSources(1, &src);
+        if (alGetError() != AL_NO_ERROR)
+        {
+            printf("[VoicePool] Only %d of %d sources available\n",
+                   i, mSettings.maxSources);
+            break;
+        }
+        mSources.push_back(src);
+    }
+
+    mFreeSources.clear();
+    for (int i = static_cast<int>(mSources.size()) - 1; i >= 0; i--)
+    {
+        mFreeSources.push_back(i);
+    }
+
+    mVoices.assign(mSettings.maxVoices, Voice());
+    mRanked.reserve(mVoices.size());
+    mWantReal.assign(mVoices.size(), 0);
+
+    mStats = VoiceStats();
+    mStats.numSources = static_cast<int>(mSources.size());
+}
+
+void VoicePool::Shutdown()
+{
+    StopAll();
+    if (!mSources.empty())
+    {
+        alDeleteSources(static_cast<ALsizei>(mSources.size()), mSources.data());
+    }
+    mSources.clear();
+    mFreeSources.clear();
+    mVoices.clear();
+    mWantReal.clear();
+}
+
+const char* VoicePool::GetCategoryName(SoundCategory category)
+{
+    switch (category)
+    {
+        case SoundCategory::Effect:  return "effect";
+        case SoundCategory::Ambient: return "ambient";
+        case SoundCategory::Voice:   return "voice";
+        case SoundCategory::UI:      return "ui";
+        default:                     return "";
+    }
+}
+
+//--------------------------------------
+// ハンドル → ボイス
+//--------------------------------------
+VoicePool::Voice* VoicePool::Find(VoiceHandle handle)
+{
+    const size_t index = (handle & 0xFFFF);
+    if (index == 0 || index > mVoices.size())
+        return nullptr;
+
+    Voice& v = mVoices[index - 1];
+    if (!v.inUse || v.generation != static_cast<uint16_t>(handle >> 16))
+        return nullptr;
+    return &v;
+}
+
+const VoicePool::Voice* VoicePool::Find(VoiceHandle handle) const
+{
+    return const_cast<VoicePool*>(this)->Find(handle);
+}
+
+//--------------------------------------
+// 順位：優先度 → 聞こえる大きさ → 新しいもの
+//--------------------------------------
+bool VoicePool::Outranks(const Voice& a, const Voice& b)
+{
+    if (a.params.priority != b.params.priority)
+        return a.params.priority > b.params.priority;
+    if (a.audibility != b.audibility)
+        return a.audibility > b.audibility;
+    return a.order > b.order;
+}
+
+float VoicePool::ComputeAudibility(const VoiceParams& params) const
+{
+    float gain = params.volume;
+    if (params.positional && params.rolloff > 0.0f)
+    {
+        const float ref  = std::max(params.referenceDistance, 0.001f);
+        const float dist = Math::Clamp((params.position - mListenerPos).Length(),
+                                       ref, std::max(params.maxDistance, ref));
+        gain *= ref / (ref + params.rolloff * (dist - ref));
+    }
+    return gain;
+}
+
+//--------------------------------------
+// 再生
+//  - まず仮想ボイスとして登録し、その場で割り当てを行う
+//    （上位に入れば今フレームから鳴る）
+//--------------------------------------
+VoiceHandle VoicePool::Play(const VoiceParams& params)
+{
+    if (!params.sound || params.sound->GetBuffer() == 0 || mVoices.empty())
+        return 0;
+
+    Voice candidate;
+    candidate.params     = params;
+    candidate.audibility = ComputeAudibility(params);
+    candidate.order      = ++mOrder;
+
+    // 空きを探す。無ければ最下位を追い出す（新しい音の方が上位のときだけ）
+    Voice* slot = nullptr;
+    Voice* lowest = nullptr;
+    for (Voice& v : mVoices)
+    {
+        if (!v.inUse)
+        {
+            slot = &v;
+            break;
+        }
+        if (!lowest || Outranks(*lowest, v))
+        {
+            lowest = &v;
+        }
+    }
+    if (!slot)
+    {
+        if (!lowest || !Outranks(candidate, *lowest))
+        {
+            mStats.numRejected++;
+            return 0;
+        }
+        Free(*lowest);
+        mStats.numStolen++;
+        slot = lowest;
+    }
+
+    // 0 は使わない（空きのスロットと区別がつくように）
+    if (++mNextGeneration == 0)
+    {
+        ++mNextGeneration;
+    }
+    const uint16_t generation = mNextGeneration;
+    *slot = std::move(candidate);
+    slot->inUse      = true;
+    slot->generation = generation;
+    slot->duration   = slot->params.sound->GetDuration();
+
+    Assign();
+    return MakeHandle(static_cast<size_t>(slot - mVoices.data()), generation);
+}
+
+void VoicePool::Stop(VoiceHandle handle)
+{
+    if (Voice* v = Find(handle))
+    {
+        Free(*v);
+    }
+}
+
+void VoicePool::StopAll()
+{
+    for (Voice& v : mVoices)
+    {
+        if (v.inUse)
+        {
+            Free(v);
+        }
+    }
+}
+
+bool VoicePool::IsPlaying(VoiceHandle handle) const
+{
+    return Find(handle) != nullptr;
+}
+
+void VoicePool::SetPosition(VoiceHandle handle, const Vector3& position)
+{
+    Voice* v = Find(handle);
+    if (!v) return;
+
+    v->params.position = position;
+    if (v->source >= 0 && v->params.positional)
+    {
+        alSource3f(mSources[v->source], AL_POSITION, position.x, position.y, position.z);
+    }
+}
+
+void VoicePool::SetVolume(VoiceHandle handle, float volume)
+{
+    Voice* v = Find(handle);
+    if (!v) return;
+
+    v->params.volume = volume;
+    if (v->source >= 0)
+    {
+        alSourcef(mSources[v->source], AL_GAIN, volume);
+    }
+}
+
+//--------------------------------------
+// 毎フレーム
+//--------------------------------------
+void VoicePool::Update(float deltaTime, const Vector3& listenerPos)
+{
+    mListenerPos = listenerPos;
+
+    for (Voice& v : mVoices)
+    {
+        if (!v.inUse)
+            continue;
+
+        // 実音源は OpenAL が止めたら終わり
+        if (v.source >= 0 && !v.params.loop)
+        {
+            ALint state = 0;
+            alGetSourcei(mSources[v.source], AL_SOURCE_STATE, &state);
+            if (state == AL_STOPPED)
+            {
+                Free(v);
+                continue;
+            }
+        }
+
+        // 経過（仮想ボイスはこれだけが再生位置）
+        v.time += deltaTime;
+        if (v.time >= v.duration)
+        {
+            if (!v.params.loop)
+            {
+                // 実音源はまだ鳴り終わっていなければ次のフレームで片付ける
+                if (v.source < 0)
+                {
+                    Free(v);
+                    continue;
+                }
+                v.time = v.duration;
+            }
+            else if (v.duration > 0.0f)
+            {
+                v.time = std::fmod(v.time, v.duration);
+            }
+        }
+
+        v.audibility = ComputeAudibility(v.params);
+    }
+
+    Assign();
+}
+
+//--------------------------------------
+// 割り当て
+//  - 聞こえるボイスを上位から並べ、ソース数と分類ごとの上限に収まる分に
+//    音源を渡す。外れたものは音源を返して仮想ボイスにする
+//--------------------------------------
+void VoicePool::Assign()
+{
+    mRanked.clear();
+    for (size_t i = 0; i < mVoices.size(); i++)
+    {
+        const Voice& v = mVoices[i];
+        if (v.inUse && v.audibility >= mSettings.audibleThreshold)
+        {
+            mRanked.push_back(static_cast<int>(i));
+        }
+    }
+    std::sort(mRanked.begin(), mRanked.end(),
+              [this](int a, int b) { return Outranks(mVoices[a], mVoices[b]); });
+
+    // 上位から枠を数える
+    int perCategory[kNumCategories] = {};
+    int numReal = 0;
+    const int numSources = static_cast<int>(mSources.size());
+
+    // 作業用は Initialize で確保済み（再生ごとに確保しない）
+    std::fill(mWantReal.begin(), mWantReal.end(), 0);
+    for (int i : mRanked)
+    {
+        const int c = static_cast<int>(mVoices[i].params.category);
+        if (numReal < numSources && perCategory[c] < mSettings.categoryCaps[c])
+        {
+            mWantReal[i] = 1;
+            perCategory[c]++;
+            numReal++;
+        }
+    }
+
+    // 先に返してから渡す（返した音源を上位のボイスが使えるように）
+    for (size_t i = 0; i < mVoices.size(); i++)
+    {
+        Voice& v = mVoices[i];
+        if (v.inUse && v.source >= 0 && !mWantReal[i])
+        {
+            ReleaseSource(v, /*keepTime=*/true);
+        }
+    }
+    for (int i : mRanked)
+    {
+        Voice& v = mVoices[i];
+        if (mWantReal[i] && v.source < 0)
+        {
+            StartSource(v);
+        }
+    }
+
+    // 統計
+    mStats.numVoices  = 0;
+    mStats.numReal    = 0;
+    mStats.numVirtual = 0;
+    std::fill(std::begin(mStats.realPerCategory), std::end(mStats.realPerCategory), 0);
+    for (const Voice& v : mVoices)
+    {
+        if (!v.inUse)
+            continue;
+        mStats.numVoices++;
+        if (v.source >= 0)
+        {
+            mStats.numReal++;
+            mStats.realPerCategory[static_cast<int>(v.params.category)]++;
+        }
+        else
+        {
+            mStats.numVirtual++;
+        }
+    }
+}
+
+//--------------------------------------
+// 音源を渡して鳴らす
+//  - 仮想だった間の経過ぶん先から始める
+//--------------------------------------
+void VoicePool::StartSource(Voice& voice)
+{
+    if (mFreeSources.empty())
+        return;
+
+    const int index = mFreeSources.back();
+    mFreeSources.pop_back();
+    voice.source = index;
+
+    const ALuint src = mSources[index];
+    const VoiceParams& p = voice.params;
+
+    alSourcei(src, AL_BUFFER, p.sound->GetBuffer());
+    alSourcef(src, AL_GAIN, p.volume);
+    alSourcei(src, AL_LOOPING, p.loop ? AL_TRUE : AL_FALSE);
+
+    if (p.positional)
+    {
+        alSourcei (src, AL_SOURCE_RELATIVE, AL_FALSE);
+        alSource3f(src, AL_POSITION, p.position.x, p.position.y, p.position.z);
+        alSourcef (src, AL_REFERENCE_DISTANCE, p.referenceDistance);
+        alSourcef (src, AL_MAX_DISTANCE,      p.maxDistance);
+        alSourcef (src, AL_ROLLOFF_FACTOR,    p.rolloff);
+    }
+    else
+    {
+        // リスナー基準の原点・減衰なし（2D 的）
+        alSourcei (src, AL_SOURCE_RELATIVE, AL_TRUE);
+        alSource3f(src, AL_POSITION, 0.0f, 0.0f, 0.0f);
+        alSourcef (src, AL_ROLLOFF_FACTOR, 0.0f);
+    }
+
+    if (voice.time > 0.0f && voice.time < voice.duration)
+    {
+        alSourcef(src, AL_SEC_OFFSET, voice.time);
+    }
+    alSourcePlay(src);
+}
+
+//--------------------------------------
+// 音源を返す
+//  - keepTime なら実際の再生位置を読んでおく（仮想ボイスとして続ける）
+//--------------------------------------
+void VoicePool::ReleaseSource(Voice& voice, bool keepTime)
+{
+    if (voice.source < 0)
+        return;
+
+    const ALuint src = mSources[voice.source];
+    if (keepTime)
+    {
+        ALfloat offset = 0.0f;
+        alGetSourcef(src, AL_SEC_OFFSET, &offset);
+        voice.time = offset;
+    }
+    alSourceStop(src);
+    alSourcei(src, AL_BUFFER, 0);
+
+    mFreeSources.push_back(voice.source);
+    voice.source = -1;
+}
+
+void VoicePool::Free(Voice& voice)
+{
+    ReleaseSource(voice, /*keepTime=*/false);
+    voice.params.sound.reset();
+    voice.inUse = false;
+}
+
+} // namespace toy
@@ -6,6 +6,9 @@
 #include "Asset/AssetManager.h"
 #include "Audio/SoundMixer.h"
 #include "Engine/Runtime/TimeOfDaySystem.h"
+#include "Engine/Runtime/JobSystem.h"
+#include "Engine/Runtime/AnimationSystem.h"
+#include "Engine/Runtime/ParticleSystem.h"
 
 #include <algorithm>
 #include <SDL3/SDL.h>
@@ -30,6 +33,9 @@ Application::Application()
     mAssetManager  = std::make_unique<AssetManager>();
     mSoundMixer    = std::make_unique<SoundMixer>(mAssetManager.get());
     mTimeOfDaySys  = std::make_unique<TimeOfDaySystem>();
+    mJobSys        = std::make_unique<JobSystem>();
+    mAnimationSys  = std::make_unique<AnimationSystem>();
+    mParticleSys   = std::make_unique<ParticleSystem>();
 }
 
 // デストラクタ
@@ -63,6 +69,18 @@ bool Application::Initialize()
     // Renderer初期化（ウィンドウ・GLコンテキスト生成など）
     mRenderer->Initialize();
     
+    // アニメーション LOD の設定（画面サイズの閾値など）
+    mAnimationSys->LoadSettings("ToyLib/Settings/Renderer_Settings.json");
+    
+    // パーティクルの粒数の上限
+    mParticleSys->LoadSettings("ToyLib/Settings/Renderer_Settings.json");
+    
+    // テクスチャのミップ・異方性・圧縮の設定（GPU の対応を見るので Renderer の後）
+    mAssetManager->LoadSettings("ToyLib/Settings/Renderer_Settings.json");
+    
+    // 効果音のソース数・分類ごとの同時発音数
+    mSoundMixer->LoadSettings("ToyLib/Settings/Renderer_Settings.json");
+    
     // 入力システム初期化（Gamepadのオープン等）
     mInputSys->Initialize(mRenderer->GetSDLWindow());
     mInputSys->LoadButtonConfig("ToyLib/Settings/InputConfig.json");
@@ -253,6 +271,14 @@ void Application::UpdateFrame()
 
     mTicksCount = now;
     
+    //=====================================
+    // 非同期読み込みの GPU 転送（時間予算内、ポーズ中も進める）
+    //=====================================
+    mAssetManager->ProcessAsyncLoads();
+    
+    // 書き換わったエフェクト定義などの読み直し（間隔ごと）
+    mAssetManager->PollFileChanges();
+    
     // ポーズ中はここで更新をスキップ
     if (mIsPause)
         return;
@@ -303,6 +329,16 @@ void Application::UpdateFrame()
         mActors.end()
     );
     
+    //=====================================
+    // アニメーション（全キャラのポーズを並列計算）
+    //=====================================
+    mAnimationSys->Update(mJobSys.get());
+    
+    //=====================================
+    // パーティクル（全エミッタを並列更新、並べ替えは前フレームのカメラ）
+    //=====================================
+    mParticleSys->Update(deltaTime, mJobSys.get(), GetRenderer()->GetInvViewMatrix());
+    
     //=====================================
     // サウンド更新（リスナー位置はカメラの逆行列から取得）
     //=====================================
@@ -0,0 +1,383 @@
+#include "Engine/Render/BillboardBatch.h"
+#include "Engine/Render/Shader.h"
+#include "Engine/Render/LightingManager.h"
+#include "Asset/Material/Texture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+// フェンス待ちのタイムアウト（ナノ秒）
+constexpr GLuint64 kFenceTimeout = 1000000000ull;
+}
+
+//=============================================================
+// コンストラクタ／デストラクタ
+//=============================================================
+
+BillboardBatch::BillboardBatch()
+: mVertexArray(0)
+, mQuadBuffer(0)
+, mIndexBuffer(0)
+, mInstanceBuffer(0)
+, mSegmentInstances(0)
+, mSegment(0)
+, mCursor(0)
+, mNumDrawCalls(0)
+, mNumInstances(0)
+{
+    for (auto& f : mFences)
+    {
+        f = nullptr;
+    }
+}
+
+BillboardBatch::~BillboardBatch()
+{
+    Shutdown();
+}
+
+//=============================================================
+// 初期化／破棄
+//=============================================================
+
+bool BillboardBatch::Initialize(std::shared_ptr<Shader> unlitShader,
+                                std::shared_ptr<Shader> litShader,
+                                std::shared_ptr<LightingManager> lighting,
+                                size_t instancesPerFrame)
+{
+    if (!unlitShader || !litShader)
+    {
+        std::cerr << "[BillboardBatch] Shader is not loaded" << std::endl;
+        return false;
+    }
+    mUnlitShader = unlitShader;
+    mLitShader   = litShader;
+    mLighting    = lighting;
+
+    // テクスチャはユニット 0、シャドウマップはユニット 1
+    mUnlitShader->SetActive();
+    mUnlitShader->SetTextureUniform("uTexture", 0);
+    mLitShader->SetActive();
+    mLitShader->SetTextureUniform("uTexture", 0);
+    mLitShader->SetTextureUniform("uShadowMap", 1);
+
+    Reallocate(std::max<size_t>(instancesPerFrame, 1));
+    return true;
+}
+
+void BillboardBatch::Shutdown()
+{
+    for (auto& f : mFences)
+    {
+        if (f)
+        {
+            glDeleteSync(f);
+            f = nullptr;
+        }
+    }
+    if (mVertexArray)
+    {
+        glDeleteVertexArrays(1, &mVertexArray);
+        mVertexArray = 0;
+    }
+    GLuint* buffers[] = { &mQuadBuffer, &mIndexBuffer, &mInstanceBuffer };
+    for (GLuint* b : buffers)
+    {
+        if (*b)
+        {
+            glDeleteBuffers(1, b);
+            *b = 0;
+        }
+    }
+}
+
+//=============================================================
+// 作り直し
+//  - 四角形（位置・UV）は固定、インスタンス属性の参照先は
+//    描画ごとに区画内の位置へ付け替える（GL 4.1 には baseInstance が無い）
+//=============================================================
+void BillboardBatch::Reallocate(size_t instancesPerFrame)
+{
+    Shutdown();
+
+    mSegmentInstances = instancesPerFrame;
+
+    // Renderer のスプライト矩形と同じ並び（表面の向きも同じ）
+    const float quad[] =
+    {
+        -0.5f,  0.5f, 0.f, 0.f, // top left
+         0.5f,  0.5f, 1.f, 0.f, // top right
+         0.5f, -0.5f, 1.f, 1.f, // bottom right
+        -0.5f, -0.5f, 0.f, 1.f  // bottom left
+    };
+    const GLuint indices[] = { 2, 1, 0, 0, 3, 2 };
+
+    glGenVertexArrays(1, &mVertexArray);
+    glBindVertexArray(mVertexArray);
+
+    glGenBuffers(1, &mQuadBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mQuadBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+
+    // location 0 : 角の位置（xy）、location 2 : UV（他のビルボード系シェーダと合わせる）
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4, nullptr);
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4,
+                          reinterpret_cast<void*>(sizeof(float) * 2));
+
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    glGenBuffers(1, &mInstanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER,
+                 mSegmentInstances * sizeof(BillboardInstance) * kNumSegments,
+                 nullptr, GL_STREAM_DRAW);
+
+    // 位置＋寿命 / 色 / UV / 大きさ
+    for (GLuint i = 0; i < 4; i++)
+    {
+        glEnableVertexAttribArray(kInstanceLocation + i);
+        glVertexAttribDivisor(kInstanceLocation + i, 1);
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    mSegment = 0;
+    mCursor  = 0;
+}
+
+//=============================================================
+// フレーム境界
+//=============================================================
+
+void BillboardBatch::BeginFrame(const Matrix4& view,
+                                const Matrix4& proj,
+                                const Matrix4& lightSpace,
+                                std::shared_ptr<Texture> shadowMap)
+{
+    mView         = view;
+    mViewProj     = view * proj;
+    mLightSpace   = lightSpace;
+    mShadowMap    = shadowMap;
+    mSegment      = (mSegment + 1) % kNumSegments;
+    mCursor       = 0;
+    mNumDrawCalls = 0;
+    mNumInstances = 0;
+    mRuns.clear();
+    mInstances.clear();
+
+    // この区画を読んでいた kNumSegments フレーム前の描画を待つ
+    GLsync& fence = mFences[mSegment];
+    if (fence)
+    {
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeout) == GL_TIMEOUT_EXPIRED) {}
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+void BillboardBatch::EndFrame()
+{
+    // 積み残しがあれば描いておく
+    Flush();
+
+    GLsync& fence = mFences[mSegment];
+    if (fence)
+    {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+//=============================================================
+// 積む
+//=============================================================
+void BillboardBatch::Add(Texture* texture,
+                         bool blendAdd,
+                         bool lit,
+                         bool upright,
+                         int drawOrder,
+                         const BillboardInstance* instances,
+                         size_t count)
+{
+    if (!texture || !instances || count == 0)
+        return;
+
+    Run run;
+    run.texture   = texture;
+    run.blendAdd  = blendAdd;
+    run.lit       = lit;
+    run.upright   = upright;
+    run.drawOrder = drawOrder;
+    run.begin     = mInstances.size();
+    run.count     = count;
+    mRuns.push_back(run);
+
+    mInstances.insert(mInstances.end(), instances, instances + count);
+}
+
+//=============================================================
+// 描き方ごとのシェーダ設定（Flush 中に 1 回ずつ）
+//=============================================================
+void BillboardBatch::SetupShader(Shader& shader, bool lit)
+{
+    Matrix4 invView = mView;
+    invView.Invert();
+
+    shader.SetActive();
+    shader.SetMatrixUniform("uViewProj", mViewProj);
+    shader.SetVectorUniform("uCameraPos",   invView.GetTranslation());
+    shader.SetVectorUniform("uCameraRight", invView.GetXAxis());
+    shader.SetVectorUniform("uCameraUp",    invView.GetYAxis());
+
+    if (lit)
+    {
+        mLighting->ApplyToShader(mLitShader, mView);
+
+        // メッシュと同じ影・質感の設定
+        if (mShadowMap)
+        {
+            mShadowMap->SetActive(1);
+        }
+        shader.SetMatrixUniform("uLightSpaceMatrix", mLightSpace);
+        shader.SetFloatUniform("uShadowBias", 0.005f);
+        shader.SetFloatUniform("uSpecPower", 32.0f);
+        shader.SetBooleanUniform("uUseToon", false);
+        shader.SetBooleanUniform("uOverrideColor", false);
+    }
+}
+
+//=============================================================
+// 描く
+//  - 描画順だけで安定ソート（同じ描画順は積んだ順のまま。
+//    テクスチャなどで並べ替えると半透明の重なり順が変わる）
+//  - 並べた順に区画へ書き、同じ組み合わせが続く範囲を
+//    1 回の glDrawElementsInstanced にする
+//=============================================================
+void BillboardBatch::Flush()
+{
+    if (mRuns.empty() || !mInstanceBuffer)
+    {
+        mRuns.clear();
+        mInstances.clear();
+        return;
+    }
+
+    std::stable_sort(mRuns.begin(), mRuns.end(),
+        [](const Run& a, const Run& b)
+        {
+            return a.drawOrder < b.drawOrder;
+        });
+
+    // 区画に入り切らなければ倍の容量で作り直す
+    const size_t total = mInstances.size();
+    if (mCursor + total > mSegmentInstances)
+    {
+        size_t capacity = mSegmentInstances * 2;
+        while (capacity < mCursor + total)
+        {
+            capacity *= 2;
+        }
+        Reallocate(capacity);
+        std::cerr << "[BillboardBatch] Grew to "
+                  << mSegmentInstances << " instances per frame" << std::endl;
+    }
+
+    const size_t first = mSegment * mSegmentInstances + mCursor;
+
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+    auto* dst = static_cast<BillboardInstance*>(
+        glMapBufferRange(GL_ARRAY_BUFFER,
+                         first * sizeof(BillboardInstance),
+                         total * sizeof(BillboardInstance),
+                         GL_MAP_WRITE_BIT |
+                         GL_MAP_INVALIDATE_RANGE_BIT |
+                         GL_MAP_UNSYNCHRONIZED_BIT));
+    if (!dst)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        mRuns.clear();
+        mInstances.clear();
+        return;
+    }
+    for (const Run& run : mRuns)
+    {
+        std::memcpy(dst, mInstances.data() + run.begin, run.count * sizeof(BillboardInstance));
+        dst += run.count;
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+
+    //---------------------------------------------------------
+    // 同じ組み合わせが続く範囲ごとに 1 回描く
+    //---------------------------------------------------------
+    glBindVertexArray(mVertexArray);
+
+    Shader* current = nullptr;
+    size_t written = 0;
+    size_t i = 0;
+    while (i < mRuns.size())
+    {
+        const Run& head = mRuns[i];
+        size_t count = 0;
+        size_t j = i;
+        while (j < mRuns.size() &&
+               mRuns[j].texture  == head.texture &&
+               mRuns[j].blendAdd == head.blendAdd &&
+               mRuns[j].lit      == head.lit &&
+               mRuns[j].upright  == head.upright)
+        {
+            count += mRuns[j].count;
+            j++;
+        }
+
+        Shader* shader = head.lit ? mLitShader.get() : mUnlitShader.get();
+        if (shader != current)
+        {
+            SetupShader(*shader, head.lit);
+            current = shader;
+        }
+        shader->SetBooleanUniform("uUpright", head.upright);
+
+        glBlendFunc(head.blendAdd ? GL_ONE : GL_SRC_ALPHA,
+                    head.blendAdd ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+        head.texture->SetActive(0);
+
+        // インスタンス属性をこの範囲の先頭へ
+        const size_t offset = (first + written) * sizeof(BillboardInstance);
+        const GLsizei stride = sizeof(BillboardInstance);
+        glVertexAttribPointer(kInstanceLocation + 0, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offset + offsetof(BillboardInstance, x)));
+        glVertexAttribPointer(kInstanceLocation + 1, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offset + offsetof(BillboardInstance, r)));
+        glVertexAttribPointer(kInstanceLocation + 2, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offset + offsetof(BillboardInstance, u0)));
+        glVertexAttribPointer(kInstanceLocation + 3, 2, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<void*>(offset + offsetof(BillboardInstance, width)));
+
+        glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr,
+                                static_cast<GLsizei>(count));
+        mNumDrawCalls++;
+
+        written += count;
+        i = j;
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    mCursor       += total;
+    mNumInstances += total;
+    mRuns.clear();
+    mInstances.clear();
+}
+
+} // namespace toy
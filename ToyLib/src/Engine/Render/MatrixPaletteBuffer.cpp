@@ -0,0 +1,192 @@
+#include "Engine/Render/MatrixPaletteBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+// フェンス待ちのタイムアウト（ナノ秒）
+constexpr GLuint64 kFenceTimeout = 1000000000ull;
+
+constexpr uint64_t MakeHandle(uint32_t stamp, size_t offset)
+{
+    return (static_cast<uint64_t>(stamp) << 32) | static_cast<uint32_t>(offset);
+}
+}
+
+//=============================================================
+// コンストラクタ／デストラクタ
+//=============================================================
+
+MatrixPaletteBuffer::MatrixPaletteBuffer()
+: mBuffer(0)
+, mStride(0)
+, mSegmentSize(0)
+, mSegment(0)
+, mCursor(0)
+, mNumUploads(0)
+, mStamp(1)
+{
+    for (auto& f : mFences)
+    {
+        f = nullptr;
+    }
+}
+
+MatrixPaletteBuffer::~MatrixPaletteBuffer()
+{
+    Shutdown();
+}
+
+//=============================================================
+// 初期化／破棄
+//=============================================================
+
+bool MatrixPaletteBuffer::Initialize(size_t palettesPerFrame)
+{
+    // バインドする範囲の先頭は UNIFORM_BUFFER_OFFSET_ALIGNMENT の倍数
+    GLint align = 256;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align);
+    align = std::max(align, 1);
+
+    GLint maxBlock = 0;
+    glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &maxBlock);
+
+    const size_t paletteSize = kMaxMatrices * sizeof(Matrix4);
+    if (static_cast<size_t>(maxBlock) < paletteSize)
+    {
+        std::cerr << "[MatrixPaletteBuffer] Uniform block too small: "
+                  << maxBlock << " bytes" << std::endl;
+        return false;
+    }
+
+    mStride = (paletteSize + align - 1) / align * align;
+    Reallocate(std::max<size_t>(palettesPerFrame, 1));
+    return true;
+}
+
+void MatrixPaletteBuffer::Shutdown()
+{
+    for (auto& f : mFences)
+    {
+        if (f)
+        {
+            glDeleteSync(f);
+            f = nullptr;
+        }
+    }
+    if (mBuffer)
+    {
+        glDeleteBuffers(1, &mBuffer);
+        mBuffer = 0;
+    }
+}
+
+//=============================================================
+// 作り直し
+//  - 古いバッファは削除しても、それを参照する描画命令が
+//    終わるまでドライバが保持するので、フレーム途中でもよい
+//=============================================================
+void MatrixPaletteBuffer::Reallocate(size_t palettesPerFrame)
+{
+    Shutdown();
+
+    mSegmentSize = palettesPerFrame * mStride;
+
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, mSegmentSize * kNumSegments, nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    mSegment = 0;
+    mCursor  = 0;
+    mStamp++;
+}
+
+//=============================================================
+// フレーム境界
+//=============================================================
+
+void MatrixPaletteBuffer::BeginFrame()
+{
+    mSegment    = (mSegment + 1) % kNumSegments;
+    mCursor     = 0;
+    mNumUploads = 0;
+    mStamp++;
+
+    // この区画を読んでいた kNumSegments フレーム前の描画を待つ
+    GLsync& fence = mFences[mSegment];
+    if (fence)
+    {
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeout) == GL_TIMEOUT_EXPIRED) {}
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+void MatrixPaletteBuffer::EndFrame()
+{
+    GLsync& fence = mFences[mSegment];
+    if (fence)
+    {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+//=============================================================
+// パレットの書き込み
+//  - 区画は GPU が使っていないことをフェンスで保証しているので、
+//    同期なしでマップして書く
+//=============================================================
+uint64_t MatrixPaletteBuffer::Upload(const Matrix4* matrices, size_t count)
+{
+    if (!mBuffer)
+        return 0;
+
+    // 区画が埋まったら倍の容量で作り直す
+    if (mCursor + mStride > mSegmentSize)
+    {
+        Reallocate(mSegmentSize / mStride * 2);
+        std::cerr << "[MatrixPaletteBuffer] Grew to "
+                  << mSegmentSize / mStride << " palettes per frame" << std::endl;
+    }
+
+    const size_t offset = mSegment * mSegmentSize + mCursor;
+    const size_t bytes  = std::min(count, kMaxMatrices) * sizeof(Matrix4);
+
+    if (bytes > 0)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+        void* dst = glMapBufferRange(GL_UNIFORM_BUFFER, offset, bytes,
+                                     GL_MAP_WRITE_BIT |
+                                     GL_MAP_INVALIDATE_RANGE_BIT |
+                                     GL_MAP_UNSYNCHRONIZED_BIT);
+        if (dst)
+        {
+            std::memcpy(dst, matrices, bytes);
+            glUnmapBuffer(GL_UNIFORM_BUFFER);
+        }
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    mCursor += mStride;
+    mNumUploads++;
+    return MakeHandle(mStamp, offset);
+}
+
+bool MatrixPaletteBuffer::IsCurrent(uint64_t handle) const
+{
+    return static_cast<uint32_t>(handle >> 32) == mStamp;
+}
+
+void MatrixPaletteBuffer::Bind(uint64_t handle) const
+{
+    const GLintptr offset = static_cast<GLintptr>(handle & 0xffffffffull);
+    glBindBufferRange(GL_UNIFORM_BUFFER, kBindingPoint, mBuffer,
+                      offset, kMaxMatrices * sizeof(Matrix4));
+}
+
+} // namespace toy
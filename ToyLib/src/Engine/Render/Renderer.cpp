@@ -1,6 +1,9 @@
 #include "Engine/Render/Renderer.h"
 #include "Engine/Render/Shader.h"
 #include "Engine/Render/LightingManager.h"
+#include "Engine/Render/MatrixPaletteBuffer.h"
+#include "Engine/Render/SpriteBatch.h"
+#include "Engine/Render/BillboardBatch.h"
 #include "Graphics/Sprite/SpriteComponent.h"
 #include "Asset/Material/Texture.h"
 #include "Asset/Geometry/VertexArray.h"
@@ -47,10 +50,15 @@ Renderer::Renderer()
 , mShadowOrthoHeight(100.f)
 , mShadowFBOWidth(4096)
 , mShadowFBOHeight(4096)
+, mIsLodEnabled(true)
+, mLodHysteresis(0.15f)
+, mLodBias(1.0f)
+, mLodScreenSizes(Vector3(0.25f, 0.12f, 0.06f))
 , mWindow(nullptr)
 , mGLContext(nullptr)
 , mShaderPath("ToyLib/Shaders/")
 , mCntDrawObject(0)
+, mFrameCount(0)
 , mSkyDomeComp(nullptr)
 , mLightSpaceMatrix(Matrix4::Identity)
 , mWindowDisplayScale(1.0f)
@@ -204,6 +212,33 @@ bool Renderer::Initialize()
         return false;
     }
 
+    //---------------------------------------------------------
+    // スキニング行列パレットの UBO
+    //---------------------------------------------------------
+    mPaletteBuffer = std::make_unique<MatrixPaletteBuffer>();
+    if (!mPaletteBuffer->Initialize())
+    {
+        return false;
+    }
+
+    //---------------------------------------------------------
+    // 2D スプライトのバッチ
+    //---------------------------------------------------------
+    mSpriteBatch = std::make_unique<SpriteBatch>();
+    if (!mSpriteBatch->Initialize(mShaders["SpriteBatch"]))
+    {
+        return false;
+    }
+
+    //---------------------------------------------------------
+    // パーティクル／ビルボードのインスタンス描画
+    //---------------------------------------------------------
+    mBillboardBatch = std::make_unique<BillboardBatch>();
+    if (!mBillboardBatch->Initialize(mShaders["Particle"], mShaders["BillboardLit"], mLightingManager))
+    {
+        return false;
+    }
+
     //---------------------------------------------------------
     // 各種描画用 VAO 準備
     //---------------------------------------------------------
@@ -239,6 +274,11 @@ bool Renderer::Initialize()
 // リリース処理
 void Renderer::Shutdown()
 {
+    // GL リソースはコンテキストを壊す前に
+    mPaletteBuffer.reset();
+    mSpriteBatch.reset();
+    mBillboardBatch.reset();
+
     if (mGLContext)
     {
         SDL_GL_DestroyContext(mGLContext);
@@ -262,9 +302,18 @@ void Renderer::Draw()
     // カラーバッファ／デプスバッファ初期化
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
+    // ボーン行列パレットの書き込み先を次の区画へ
+    mPaletteBuffer->BeginFrame();
+    
+    // スプライトの頂点の書き込み先も次の区画へ
+    mSpriteBatch->BeginFrame(Matrix4::CreateSimpleViewProj(mScreenWidth, mScreenHeight));
+    
     // 1) ライト視点でのシャドウマップ描画
     RenderShadowMap();
     
+    // ビルボードのインスタンスの書き込み先を次の区画へ（ライト行列が決まってから）
+    mBillboardBatch->BeginFrame(mViewMatrix, mProjectionMatrix, mLightSpaceMatrix, mShadowMapTexture);
+    
     // 2) 通常描画パス
     glEnable(GL_CULL_FACE);
     glFrontFace(GL_CCW);
@@ -285,6 +334,12 @@ void Renderer::Draw()
     // Debug 用カウンタリセット
     // std::cout << "Render 3D Objects Count = " << mCntDrawObject << std::endl;
     mCntDrawObject = 0;
+    mFrameCount++;
+    
+    // このフレームのパレットを GPU が読み終えたか判定するフェンス
+    mPaletteBuffer->EndFrame();
+    mSpriteBatch->EndFrame();
+    mBillboardBatch->EndFrame();
     
     // バッファ入れ替え
     SDL_GL_SwapWindow(mWindow);
@@ -334,6 +389,11 @@ void Renderer::DrawVisualLayer(VisualLayer layer)
         (layer == VisualLayer::Object3D ||
          layer == VisualLayer::Effect3D);
     
+    // 2D レイヤーのスプライトは SpriteBatch でまとめる
+    bool isSpriteLayer =
+        (layer == VisualLayer::UI ||
+         layer == VisualLayer::Background2D);
+    
     Frustum frustum;
     if (is3DLayer)
     {
@@ -393,10 +453,44 @@ void Renderer::DrawVisualLayer(VisualLayer layer)
             }
         }
         
+        if (isSpriteLayer)
+        {
+            if (comp->SubmitToBatch(*mSpriteBatch))
+            {
+                comp->MarkDrawn(mFrameCount);
+                mCntDrawObject++;
+                continue;
+            }
+            
+            // 描画順を保つため、積んであるスプライトを先に描く
+            mSpriteBatch->Flush();
+        }
+        else if (layer == VisualLayer::Effect3D)
+        {
+            // パーティクル／ビルボードはインスタンス描画でまとめる
+            if (comp->SubmitBillboards(*mBillboardBatch))
+            {
+                comp->MarkDrawn(mFrameCount);
+                mCntDrawObject++;
+                continue;
+            }
+            mBillboardBatch->Flush();
+        }
+        
         comp->Draw();
+        comp->MarkDrawn(mFrameCount);
         mCntDrawObject++;
     }
     
+    if (isSpriteLayer)
+    {
+        mSpriteBatch->Flush();
+    }
+    else if (layer == VisualLayer::Effect3D)
+    {
+        mBillboardBatch->Flush();
+    }
+    
     // 状態戻し（保険）
     glEnable(GL_DEPTH_TEST);
     glDepthMask(GL_TRUE);
@@ -576,7 +670,9 @@ void Renderer::RenderShadowMap()
         }
         
         // 影用描画（VisualComponent 側でシャドウシェーダーを使う）
+        // 影だけ見えている場合もアニメーションは止めない
         visual->DrawShadow();
+        visual->MarkDrawn(mFrameCount);
     }
     
     //---------------------------------------------------------
@@ -610,6 +706,23 @@ void Renderer::SetClearColor(const Vector3& color)
     glClearColor(mClearColor.x, mClearColor.y, mClearColor.z, 1.0f);
 }
 
+// スフィアの画面占有率（直径 / 画面高さ）
+//  - カメラ位置からの距離と縦 FOV から求める簡易版
+//  - カメラが内側に入っている場合は 1 以上を返す
+float Renderer::ComputeScreenSize(const Vector3& worldCenter, float worldRadius) const
+{
+    Vector3 camPos = mInvView.GetTranslation();
+    float dist = (worldCenter - camPos).Length();
+    if (dist <= worldRadius)
+    {
+        return Math::Infinity;
+    }
+
+    float halfFov = Math::ToRadians(mPerspectiveFOV) * 0.5f;
+    float size    = worldRadius / (dist * Math::Tan(halfFov));
+    return size * mLodBias;
+}
+
 
 //=============================================================
 // シェーダーロード
@@ -652,6 +765,18 @@ bool Renderer::LoadShaders()
     {
         return false;
     }
+    mShaders["Skinned"]->SetUniformBlockBinding("MatrixPalette", MatrixPaletteBuffer::kBindingPoint);
+
+    //---------------------------------------------------------
+    // 群衆スキンメッシュ用（焼き込みパレット＋インスタンス）
+    //---------------------------------------------------------
+    vShaderName = mShaderPath + "CrowdSkinned.vert";
+    fShaderName = mShaderPath + "Phong.frag";
+    mShaders["CrowdSkinned"] = std::make_shared<Shader>();
+    if (!mShaders["CrowdSkinned"]->Load(vShaderName.c_str(), fShaderName.c_str()))
+    {
+        return false;
+    }
 
     //---------------------------------------------------------
     // スプライト用
@@ -668,6 +793,21 @@ bool Renderer::LoadShaders()
     Matrix4 viewProj = Matrix4::CreateSimpleViewProj(mScreenWidth, mScreenHeight);
     mShaders["Sprite"]->SetMatrixUniform("uViewProj", viewProj);
 
+    // 配列テクスチャはユニット 1（sampler2D と同じユニットを指すと描画エラー）
+    mShaders["Sprite"]->SetActive();
+    mShaders["Sprite"]->SetTextureUniform("uTextureArray", 1);
+
+    //---------------------------------------------------------
+    // スプライトバッチ（UI / Background2D、SpriteBatch が使う）
+    //---------------------------------------------------------
+    vShaderName = mShaderPath + "SpriteBatch.vert";
+    fShaderName = mShaderPath + "SpriteBatch.frag";
+    mShaders["SpriteBatch"] = std::make_shared<Shader>();
+    if (!mShaders["SpriteBatch"]->Load(vShaderName.c_str(), fShaderName.c_str()))
+    {
+        return false;
+    }
+
     //---------------------------------------------------------
     // ビルボード
     //---------------------------------------------------------
@@ -680,9 +820,9 @@ bool Renderer::LoadShaders()
     }
 
     //---------------------------------------------------------
-    // パーティクル
+    // パーティクル（インスタンス描画、BillboardBatch が使う）
     //---------------------------------------------------------
-    vShaderName = mShaderPath + "Billboard.vert";
+    vShaderName = mShaderPath + "BillboardInstanced.vert";
     fShaderName = mShaderPath + "Particle.frag";
     mShaders["Particle"] = std::make_shared<Shader>();
     if (!mShaders["Particle"]->Load(vShaderName.c_str(), fShaderName.c_str()))
@@ -690,6 +830,17 @@ bool Renderer::LoadShaders()
         return false;
     }
 
+    //---------------------------------------------------------
+    // ライティングありビルボード（インスタンス描画、BillboardBatch が使う）
+    //---------------------------------------------------------
+    vShaderName = mShaderPath + "BillboardInstanced.vert";
+    fShaderName = mShaderPath + "Phong.frag";
+    mShaders["BillboardLit"] = std::make_shared<Shader>();
+    if (!mShaders["BillboardLit"]->Load(vShaderName.c_str(), fShaderName.c_str()))
+    {
+        return false;
+    }
+
     //---------------------------------------------------------
     // ソリッドカラー（ワイヤーフレーム／デバッグ用など）
     //---------------------------------------------------------
@@ -711,6 +862,18 @@ bool Renderer::LoadShaders()
     {
         return false;
     }
+    mShaders["ShadowSkinned"]->SetUniformBlockBinding("MatrixPalette", MatrixPaletteBuffer::kBindingPoint);
+
+    //---------------------------------------------------------
+    // シャドウマップ（群衆スキンメッシュ）
+    //---------------------------------------------------------
+    vShaderName = mShaderPath + "ShadowMapping_Crowd.vert";
+    fShaderName = mShaderPath + "ShadowMapping.frag";
+    mShaders["ShadowCrowd"] = std::make_shared<Shader>();
+    if (!mShaders["ShadowCrowd"]->Load(vShaderName.c_str(), fShaderName.c_str()))
+    {
+        return false;
+    }
 
     //---------------------------------------------------------
     // シャドウマップ（通常メッシュ）
@@ -133,6 +133,23 @@ bool Renderer::LoadSettings(const std::string& filePath)
         JsonHelper::GetInt  (data["shadow"], "resolution_height", mShadowFBOHeight);
     }
     
+    //---------------------------------------------------------
+    // メッシュ LOD 設定
+    //   "lod": {
+    //       "enabled": true,
+    //       "hysteresis": 0.15,
+    //       "bias": 1.0,
+    //       "screen_sizes": [0.25, 0.12, 0.06]
+    //   }
+    //---------------------------------------------------------
+    if (data.contains("lod"))
+    {
+        JsonHelper::GetBool   (data["lod"], "enabled",      mIsLodEnabled);
+        JsonHelper::GetFloat  (data["lod"], "hysteresis",   mLodHysteresis);
+        JsonHelper::GetFloat  (data["lod"], "bias",         mLodBias);
+        JsonHelper::GetVector3(data["lod"], "screen_sizes", mLodScreenSizes);
+    }
+    
     std::cerr << "Loaded Renderer settings from "
               << filePath.c_str() << std::endl;
     return true;
@@ -87,6 +87,16 @@ void Shader::SetMatrixUniforms(const char* name, Matrix4* matrices, unsigned cou
     glUniformMatrix4fv(loc, count, GL_TRUE, matrices[0].GetAsFloatPtr());
 }
 
+// uniform ブロックのバインディングポイントを設定
+void Shader::SetUniformBlockBinding(const char* blockName, GLuint binding)
+{
+    GLuint index = glGetUniformBlockIndex(mShaderProgramID, blockName);
+    if (index != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding(mShaderProgramID, index, binding);
+    }
+}
+
 // vec3 を uniform に送る
 void Shader::SetVectorUniform(const char* name, const Vector3& vector)
 {
@@ -0,0 +1,326 @@
+#include "Engine/Render/SpriteBatch.h"
+#include "Engine/Render/Shader.h"
+#include "Asset/Material/Texture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+// フェンス待ちのタイムアウト（ナノ秒）
+constexpr GLuint64 kFenceTimeout = 1000000000ull;
+}
+
+//=============================================================
+// コンストラクタ／デストラクタ
+//=============================================================
+
+SpriteBatch::SpriteBatch()
+: mVertexArray(0)
+, mVertexBuffer(0)
+, mIndexBuffer(0)
+, mSegmentSprites(0)
+, mSegment(0)
+, mCursor(0)
+, mNumDrawCalls(0)
+, mNumSprites(0)
+{
+    for (auto& f : mFences)
+    {
+        f = nullptr;
+    }
+}
+
+SpriteBatch::~SpriteBatch()
+{
+    Shutdown();
+}
+
+//=============================================================
+// 初期化／破棄
+//=============================================================
+
+bool SpriteBatch::Initialize(std::shared_ptr<Shader> shader, size_t spritesPerFrame)
+{
+    if (!shader)
+    {
+        std::cerr << "[SpriteBatch] Shader is not loaded" << std::endl;
+        return false;
+    }
+    mShader = shader;
+
+    // 配列テクスチャはユニット 1（sampler2D と同じユニットを指すと描画エラー）
+    mShader->SetActive();
+    mShader->SetTextureUniform("uTexture", 0);
+    mShader->SetTextureUniform("uTextureArray", 1);
+
+    Reallocate(std::max<size_t>(spritesPerFrame, 1));
+    return true;
+}
+
+void SpriteBatch::Shutdown()
+{
+    for (auto& f : mFences)
+    {
+        if (f)
+        {
+            glDeleteSync(f);
+            f = nullptr;
+        }
+    }
+    if (mVertexArray)
+    {
+        glDeleteVertexArrays(1, &mVertexArray);
+        mVertexArray = 0;
+    }
+    if (mVertexBuffer)
+    {
+        glDeleteBuffers(1, &mVertexBuffer);
+        mVertexBuffer = 0;
+    }
+    if (mIndexBuffer)
+    {
+        glDeleteBuffers(1, &mIndexBuffer);
+        mIndexBuffer = 0;
+    }
+}
+
+//=============================================================
+// 作り直し
+//  - インデックスは 1 区画ぶんの矩形を並べた固定の表で、
+//    描画時は baseVertex で区画・並びの先頭へずらす
+//=============================================================
+void SpriteBatch::Reallocate(size_t spritesPerFrame)
+{
+    Shutdown();
+
+    mSegmentSprites = spritesPerFrame;
+
+    // 頂点の並びは Renderer のスプライト矩形と同じ（表面の向きも同じ）
+    std::vector<GLuint> indices(mSegmentSprites * 6);
+    for (size_t i = 0; i < mSegmentSprites; i++)
+    {
+        const GLuint base = static_cast<GLuint>(i * 4);
+        GLuint* dst = indices.data() + i * 6;
+        dst[0] = base + 2;
+        dst[1] = base + 1;
+        dst[2] = base + 0;
+        dst[3] = base + 0;
+        dst[4] = base + 3;
+        dst[5] = base + 2;
+    }
+
+    glGenVertexArrays(1, &mVertexArray);
+    glBindVertexArray(mVertexArray);
+
+    glGenBuffers(1, &mVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER,
+                 mSegmentSprites * 4 * sizeof(Vertex) * kNumSegments,
+                 nullptr, GL_STREAM_DRAW);
+
+    glGenBuffers(1, &mIndexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                 indices.size() * sizeof(GLuint),
+                 indices.data(), GL_STATIC_DRAW);
+
+    // 位置(2) / UV(2) / 層(1) / 色(4)
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          reinterpret_cast<void*>(offsetof(Vertex, x)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          reinterpret_cast<void*>(offsetof(Vertex, u)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          reinterpret_cast<void*>(offsetof(Vertex, layer)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          reinterpret_cast<void*>(offsetof(Vertex, r)));
+
+    glBindVertexArray(0);
+
+    mSegment = 0;
+    mCursor  = 0;
+}
+
+//=============================================================
+// フレーム境界
+//=============================================================
+
+void SpriteBatch::BeginFrame(const Matrix4& viewProj)
+{
+    mViewProj     = viewProj;
+    mSegment      = (mSegment + 1) % kNumSegments;
+    mCursor       = 0;
+    mNumDrawCalls = 0;
+    mNumSprites   = 0;
+    mSprites.clear();
+
+    // この区画を読んでいた kNumSegments フレーム前の描画を待つ
+    GLsync& fence = mFences[mSegment];
+    if (fence)
+    {
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeout) == GL_TIMEOUT_EXPIRED) {}
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+void SpriteBatch::EndFrame()
+{
+    // 積み残しがあれば描いておく
+    Flush();
+
+    GLsync& fence = mFences[mSegment];
+    if (fence)
+    {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+//=============================================================
+// 積む
+//=============================================================
+void SpriteBatch::Add(Texture* texture,
+                      bool blendAdd,
+                      int drawOrder,
+                      const Vector2& center,
+                      const Vector2& size,
+                      float u0, float v0, float u1, float v1,
+                      int layer,
+                      const Vector3& color,
+                      float alpha,
+                      bool distanceField)
+{
+    if (!texture)
+        return;
+
+    const float l = center.x - size.x * 0.5f;
+    const float r = center.x + size.x * 0.5f;
+    const float t = center.y + size.y * 0.5f;
+    const float b = center.y - size.y * 0.5f;
+    const float z = static_cast<float>(layer);
+    const float cr = color.x;
+    const float cg = color.y;
+    const float cb = color.z;
+
+    Sprite s;
+    s.texture   = texture;
+    s.blendAdd  = blendAdd;
+    s.distanceField = distanceField;
+    s.drawOrder = drawOrder;
+    s.verts[0]  = { l, t, u0, v0, z, cr, cg, cb, alpha };
+    s.verts[1]  = { r, t, u1, v0, z, cr, cg, cb, alpha };
+    s.verts[2]  = { r, b, u1, v1, z, cr, cg, cb, alpha };
+    s.verts[3]  = { l, b, u0, v1, z, cr, cg, cb, alpha };
+    mSprites.push_back(s);
+}
+
+//=============================================================
+// 描く
+//  - 描画順だけで安定ソート（同じ描画順は積んだ順のまま。テクスチャなどで
+//    並べ替えると重なった UI の前後が入れ替わる）
+//  - 区画は GPU が使っていないことをフェンスで保証しているので、
+//    同期なしでマップして書く
+//=============================================================
+void SpriteBatch::Flush()
+{
+    if (mSprites.empty() || !mVertexBuffer)
+    {
+        mSprites.clear();
+        return;
+    }
+
+    std::stable_sort(mSprites.begin(), mSprites.end(),
+        [](const Sprite& a, const Sprite& b)
+        {
+            return a.drawOrder < b.drawOrder;
+        });
+
+    // 区画に入り切らなければ倍の容量で作り直す
+    if (mCursor + mSprites.size() > mSegmentSprites)
+    {
+        size_t capacity = mSegmentSprites * 2;
+        while (capacity < mCursor + mSprites.size())
+        {
+            capacity *= 2;
+        }
+        Reallocate(capacity);
+        std::cerr << "[SpriteBatch] Grew to "
+                  << mSegmentSprites << " sprites per frame" << std::endl;
+    }
+
+    const size_t firstVertex = (mSegment * mSegmentSprites + mCursor) * 4;
+    const size_t bytes       = mSprites.size() * 4 * sizeof(Vertex);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    Vertex* dst = static_cast<Vertex*>(
+        glMapBufferRange(GL_ARRAY_BUFFER, firstVertex * sizeof(Vertex), bytes,
+                         GL_MAP_WRITE_BIT |
+                         GL_MAP_INVALIDATE_RANGE_BIT |
+                         GL_MAP_UNSYNCHRONIZED_BIT));
+    if (!dst)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        mSprites.clear();
+        return;
+    }
+    for (const Sprite& s : mSprites)
+    {
+        std::memcpy(dst, s.verts, sizeof(s.verts));
+        dst += 4;
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    //---------------------------------------------------------
+    // テクスチャ・ブレンドが同じものが続く並びごとに 1 回描く
+    //---------------------------------------------------------
+    mShader->SetActive();
+    mShader->SetMatrixUniform("uViewProj", mViewProj);
+    glBindVertexArray(mVertexArray);
+
+    size_t begin = 0;
+    while (begin < mSprites.size())
+    {
+        const Sprite& first = mSprites[begin];
+        size_t end = begin + 1;
+        while (end < mSprites.size() &&
+               mSprites[end].texture  == first.texture &&
+               mSprites[end].blendAdd == first.blendAdd &&
+               mSprites[end].distanceField == first.distanceField)
+        {
+            end++;
+        }
+
+        glBlendFunc(first.blendAdd ? GL_ONE : GL_SRC_ALPHA,
+                    first.blendAdd ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+
+        const bool isArray = first.texture->IsArray();
+        first.texture->SetActive(isArray ? 1 : 0);
+        mShader->SetBooleanUniform("uUseArray", isArray);
+        mShader->SetBooleanUniform("uDistanceField", first.distanceField);
+
+        glDrawElementsBaseVertex(GL_TRIANGLES,
+                                 static_cast<GLsizei>((end - begin) * 6),
+                                 GL_UNSIGNED_INT,
+                                 nullptr,
+                                 static_cast<GLint>(firstVertex + begin * 4));
+        mNumDrawCalls++;
+        begin = end;
+    }
+
+    glBindVertexArray(0);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    mCursor     += mSprites.size();
+    mNumSprites += mSprites.size();
+    mSprites.clear();
+}
+
+} // namespace toy
@@ -0,0 +1,136 @@
+#include "Engine/Render/TextMesh.h"
+#include "Engine/Render/SpriteBatch.h"
+#include "Asset/Font/GlyphAtlas.h"
+#include "Utils/StringUtil.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace toy {
+
+TextMesh::TextMesh()
+: mWidth(0.0f)
+, mHeight(0.0f)
+, mAtlasVersion(0)
+{
+}
+
+void TextMesh::Clear()
+{
+    mQuads.clear();
+    mWidth  = 0.0f;
+    mHeight = 0.0f;
+}
+
+bool TextMesh::IsStale(const GlyphAtlas& atlas) const
+{
+    return mAtlasVersion != atlas.GetVersion();
+}
+
+//=============================================================
+// 並べる
+//  - 新しい文字でアトラスが詰め直されると、先に並べた文字が
+//    アトラスから消えるので、もう 1 回だけやり直す
+//    （2 回目は文字がすべてアトラスにあるので変わらない）
+//=============================================================
+void TextMesh::Build(GlyphAtlas& atlas, const std::string& text)
+{
+    if (!Layout(atlas, text))
+    {
+        Layout(atlas, text);
+    }
+}
+
+bool TextMesh::Layout(GlyphAtlas& atlas, const std::string& text)
+{
+    Clear();
+    const uint32_t generation = atlas.GetGeneration();
+
+    const int   lineHeight = atlas.GetLineHeight();
+    const float invW = 1.0f / static_cast<float>(atlas.GetWidth());
+
+    // ピクセル座標で並べ、UV は最後に今のアトラスの大きさで割る
+    int penX = 0;
+    int penY = 0;
+    uint32_t prev = 0;
+    size_t pos = 0;
+    while (pos < text.size())
+    {
+        const uint32_t cp = StringUtil::NextCodepoint(text, pos);
+        if (cp == '\n')
+        {
+            mWidth = std::max(mWidth, static_cast<float>(penX));
+            penX = 0;
+            penY += lineHeight;
+            prev = 0;
+            continue;
+        }
+
+        if (prev != 0)
+        {
+            penX += atlas.GetKerning(prev, cp);
+        }
+        prev = cp;
+
+        const Glyph& g = atlas.GetGlyph(cp);
+        if (g.width > 0 && g.height > 0)
+        {
+            Quad q;
+            q.x0 = static_cast<float>(penX + g.offsetX);
+            q.y0 = static_cast<float>(penY + g.offsetY);
+            q.x1 = q.x0 + g.width;
+            q.y1 = q.y0 + g.height;
+            q.u0 = g.x * invW;
+            q.u1 = (g.x + g.width) * invW;
+            q.v0 = static_cast<float>(g.y);            // 高さで割るのは後で
+            q.v1 = static_cast<float>(g.y + g.height);
+            mQuads.push_back(q);
+        }
+        penX += g.advance;
+    }
+    mWidth  = std::max(mWidth, static_cast<float>(penX));
+    mHeight = static_cast<float>(penY + lineHeight);
+
+    // 高さは途中で倍になりうるので最後に割る（幅は変わらない）
+    const float invH = 1.0f / static_cast<float>(atlas.GetHeight());
+    for (Quad& q : mQuads)
+    {
+        q.v0 *= invH;
+        q.v1 *= invH;
+    }
+
+    // 高さの拡張だけなら上の割り算で正しい。詰め直しがあったときだけやり直す
+    mAtlasVersion = atlas.GetVersion();
+    return generation == atlas.GetGeneration();
+}
+
+//=============================================================
+// SpriteBatch へ積む
+//  - 文字列の左上を整数ピクセルに合わせ、等倍のときに文字がぼけないようにする
+//=============================================================
+void TextMesh::Submit(SpriteBatch& batch,
+                      Texture* texture,
+                      int drawOrder,
+                      const Vector2& center,
+                      const Vector2& scale,
+                      const Vector3& color,
+                      float alpha,
+                      bool distanceField) const
+{
+    if (!texture || mQuads.empty())
+        return;
+
+    const float left = std::floor(center.x - mWidth  * scale.x * 0.5f + 0.5f);
+    const float top  = std::floor(center.y + mHeight * scale.y * 0.5f + 0.5f);
+
+    for (const Quad& q : mQuads)
+    {
+        const Vector2 size((q.x1 - q.x0) * scale.x, (q.y1 - q.y0) * scale.y);
+        const Vector2 c(left + (q.x0 + q.x1) * 0.5f * scale.x,
+                        top  - (q.y0 + q.y1) * 0.5f * scale.y);
+        batch.Add(texture, false, drawOrder, c, size,
+                  q.u0, q.v0, q.u1, q.v1, 0, color, alpha, distanceField);
+    }
+}
+
+} // namespace toy
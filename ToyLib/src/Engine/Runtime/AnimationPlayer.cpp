@@ -1,6 +1,7 @@
 #include "Asset/Geometry/Mesh.h"
 #include "Engine/Runtime/AnimationPlayer.h"
-#include <assimp/scene.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace toy {
@@ -9,6 +10,8 @@ namespace toy {
 // AnimationPlayer
 //  - Mesh に紐づくスケルトンアニメーションの再生制御
 //  - ループ再生 / 一回再生 / クリップ間ブレンド などを担当
+//  - ブレンドツリー / レイヤー合成はローカル TRS で行い、
+//    階層計算（行列化）は最後に 1 回だけ
 //=============================================================
 
 AnimationPlayer::AnimationPlayer(std::shared_ptr<Mesh> mesh)
@@ -20,6 +23,9 @@ AnimationPlayer::AnimationPlayer(std::shared_ptr<Mesh> mesh)
 , mIsPaused(false)
 , mNextAnimID(-1)
 , mIsFinished(false)
+, mSkipLeafLevels(0)
+, mTreePhase(0.0f)
+, mIsTreeActive(false)
 {
 }
 
@@ -32,7 +38,7 @@ AnimationPlayer::AnimationPlayer(std::shared_ptr<Mesh> mesh)
 void AnimationPlayer::Play(int animID, bool loop)
 {
     // 同じ内容なら再生しなおさない
-    if (mAnimID == animID && mIsLooping == loop && !mIsPaused)
+    if (!mIsTreeActive && mAnimID == animID && mIsLooping == loop && !mIsPaused)
         return;
     
     mAnimID     = animID;
@@ -41,19 +47,47 @@ void AnimationPlayer::Play(int animID, bool loop)
     mIsPaused   = false;
     mIsFinished = false;
     mNextAnimID = -1;
+    mIsTreeActive = false;
 }
 
 //-------------------------------------------------------------
 // 毎フレーム更新
 //  - deltaTime: 経過秒
-//  - ブレンド中ならブレンド用の姿勢計算
-//  - 通常時は現在クリップの姿勢を計算
+//  - 状態を進めてから、その場でポーズまで計算する
 //-------------------------------------------------------------
 void AnimationPlayer::Update(float deltaTime)
 {
+    Advance(deltaTime);
+    EvaluatePose();
+}
+
+//-------------------------------------------------------------
+// 再生状態を進める
+//  - ベース（単一 / クロスフェード / ツリー）→ レイヤーの順に
+//    「どのクリップを何秒・どの重みで読むか」を記録する
+//  - 行列計算は EvaluatePose() 側（ここでは Mesh を読まない）
+//-------------------------------------------------------------
+void AnimationPlayer::Advance(float deltaTime)
+{
+    mSamples.clear();
+    
     if (!mMesh || mIsPaused)
         return;
     
+    AdvanceBase(deltaTime);
+    
+    // ベースが止まっている（一回再生の終了など）ときはレイヤーも止める
+    if (!mSamples.empty())
+    {
+        AdvanceLayers(deltaTime);
+    }
+}
+
+//-------------------------------------------------------------
+// ベースの時間を進める
+//-------------------------------------------------------------
+void AnimationPlayer::AdvanceBase(float deltaTime)
+{
     //=========================================================
     // ① クリップ間ブレンド中
     //=========================================================
@@ -63,30 +97,18 @@ void AnimationPlayer::Update(float deltaTime)
         float t = mBlend.blendTime / mBlend.blendDuration;
         t = std::clamp(t, 0.0f, 1.0f);
         
-        std::vector<Matrix4> poseA;
-        std::vector<Matrix4> poseB;
-        
         // from/to それぞれで「現在の再生時間」をティックに変換
         float timeA = mPlayTime * mBlend.fromAnim->mTicksPerSecond;
         float timeB = mPlayTime * mBlend.toAnim->mTicksPerSecond;
         
-        // アニメーション周期で wrap してポーズを取得
-        mMesh->ComputePoseAtTime(
-            fmod(timeA, mBlend.fromAnim->mDuration),
-            mBlend.fromAnim,
-            poseA
-        );
-        mMesh->ComputePoseAtTime(
-            fmod(timeB, mBlend.toAnim->mDuration),
-            mBlend.toAnim,
-            poseB
-        );
-        
-        // 2 つのポーズを行列補間して最終ボーン行列を生成
-        mFinalMatrices.resize(poseA.size());
-        for (size_t i = 0; i < poseA.size(); i++)
+        // アニメーション周期で wrap した時刻を重み付きで記録
+        if (t < 1.0f)
+        {
+            PushSample(mBlend.fromAnim, fmod(timeA, mBlend.fromAnim->mDuration), 1.0f - t, 0, -1);
+        }
+        if (t > 0.0f)
         {
-            mFinalMatrices[i] = LerpMatrix(poseA[i], poseB[i], t);
+            PushSample(mBlend.toAnim, fmod(timeB, mBlend.toAnim->mDuration), t, 1, -1);
         }
         
         // ブレンド時間と全体の再生時間を進める
@@ -104,22 +126,52 @@ void AnimationPlayer::Update(float deltaTime)
         return;
     }
     
+    const auto& clips = mMesh->GetAnimationClips();
+    
+    //=========================================================
+    // ② ブレンドツリー
+    //  - 重み付き平均の長さで正規化時間を進め、
+    //    全クリップを同じ位相でサンプリングする（足並みがそろう）
+    //=========================================================
+    if (mIsTreeActive)
+    {
+        float duration = 0.0f;
+        for (size_t i = 0; i < mTreeEntries.size(); i++)
+        {
+            const AnimationClip& clip = clips[mTreeEntries[i].animID];
+            duration += mTreeWeights[i] * clip.mDuration / clip.mTicksPerSecond;
+        }
+        
+        for (size_t i = 0; i < mTreeEntries.size(); i++)
+        {
+            if (mTreeWeights[i] <= 0.0f)
+                continue;
+            const AnimationClip& clip = clips[mTreeEntries[i].animID];
+            PushSample(&clip, mTreePhase * clip.mDuration, mTreeWeights[i], static_cast<int>(i), -1);
+        }
+        
+        if (duration > 0.0f)
+        {
+            mTreePhase = fmod(mTreePhase + deltaTime * mPlayRate / duration, 1.0f);
+        }
+        return;
+    }
+    
     //=========================================================
-    // ② 通常のアニメ再生
+    // ③ 通常のアニメ再生
     //=========================================================
-    const auto& clips = mMesh->GetAnimationClips();
     if (mAnimID < 0 || mAnimID >= static_cast<int>(clips.size()))
         return;
     
-    const aiAnimation* anim = clips[mAnimID].mAnimation;
-    float ticksPerSecond    = clips[mAnimID].mTicksPerSecond;
+    const AnimationClip& anim = clips[mAnimID];
+    float ticksPerSecond      = anim.mTicksPerSecond;
     
     // 経過秒 → ティック に変換
     float timeInTicks = mPlayTime * mPlayRate * ticksPerSecond;
-    float animTime    = fmod(timeInTicks, anim->mDuration);
+    float animTime    = fmod(timeInTicks, anim.mDuration);
     
     // 非ループアニメで最後まで再生しきった場合
-    if (!mIsLooping && timeInTicks >= anim->mDuration)
+    if (!mIsLooping && timeInTicks >= anim.mDuration)
     {
         mIsFinished = true;
         
@@ -131,13 +183,147 @@ void AnimationPlayer::Update(float deltaTime)
         return;
     }
     
-    // 現在時間のポーズを計算して最終ボーン行列として保持
-    mMesh->ComputePoseAtTime(animTime, anim, mFinalMatrices);
+    // 現在時間を記録
+    PushSample(&anim, animTime, 1.0f, 0, -1);
     
     // 経過時間更新
     mPlayTime += deltaTime;
 }
 
+//-------------------------------------------------------------
+// レイヤーの時間を進める（各レイヤーはループ再生）
+//-------------------------------------------------------------
+void AnimationPlayer::AdvanceLayers(float deltaTime)
+{
+    for (size_t i = 0; i < mLayers.size(); i++)
+    {
+        AnimationLayer& layer = mLayers[i];
+        if (layer.weight <= 0.0f)
+            continue;
+        
+        float timeInTicks = layer.time * layer.clip->mTicksPerSecond;
+        PushSample(layer.clip, fmod(timeInTicks, layer.clip->mDuration),
+                   layer.weight, 0, static_cast<int>(i));
+        
+        layer.time += deltaTime * mPlayRate;
+    }
+}
+
+//-------------------------------------------------------------
+// サンプル記録
+//  - ベース用カーソルはここでだけ増やす（EvaluatePose 中は増減しない）
+//-------------------------------------------------------------
+void AnimationPlayer::PushSample(const AnimationClip* clip, float time,
+                                 float weight, int cursor, int layer)
+{
+    if (layer < 0 && cursor >= static_cast<int>(mBaseCursors.size()))
+    {
+        mBaseCursors.resize(cursor + 1);
+    }
+    
+    PoseSample sample;
+    sample.clip   = clip;
+    sample.time   = time;
+    sample.weight = weight;
+    sample.cursor = cursor;
+    sample.layer  = layer;
+    mSamples.push_back(sample);
+}
+
+//-------------------------------------------------------------
+// ポーズ計算
+//  - Mesh は const のまま読むだけ
+//  - 書き込み先は mFinalMatrices と作業領域（すべてこのインスタンス所有）
+//  - 単一クリップだけならローカル姿勢を経由せずに直接行列化
+//-------------------------------------------------------------
+void AnimationPlayer::EvaluatePose()
+{
+    if (!mMesh || mSamples.empty())
+        return;
+    
+    const Mesh& mesh = *mMesh;
+    
+    //=========================================================
+    // ① 単一クリップ（ブレンド無し）
+    //=========================================================
+    if (mSamples.size() == 1 && mSamples[0].layer < 0)
+    {
+        const PoseSample& s = mSamples[0];
+        mesh.ComputePoseAtTime(s.time, *s.clip, mFinalMatrices, mGlobalPose,
+                               &mBaseCursors[s.cursor], mSkipLeafLevels);
+        mSamples.clear();
+        return;
+    }
+    
+    //=========================================================
+    // ② ベースを重み付きで合成（N 本）
+    //  - 累積重み W に対して w / (W + w) で順に寄せると
+    //    全体として重み付き平均になる
+    //=========================================================
+    float accumulated = 0.0f;
+    bool  hasBase     = false;
+    for (const PoseSample& s : mSamples)
+    {
+        if (s.layer >= 0)
+            continue;
+        
+        AnimationCursor* cursor = &mBaseCursors[s.cursor];
+        if (!hasBase)
+        {
+            mesh.SampleLocalPose(s.time, *s.clip, mPose, cursor, mSkipLeafLevels);
+            accumulated = s.weight;
+            hasBase     = true;
+            continue;
+        }
+        
+        mesh.SampleLocalPose(s.time, *s.clip, mScratchPose, cursor, mSkipLeafLevels);
+        float total = accumulated + s.weight;
+        if (total > 0.0f)
+        {
+            AnimationBlend::Blend(mPose, mScratchPose, s.weight / total);
+        }
+        accumulated = total;
+    }
+    
+    // ベースが無ければバインド姿勢から
+    if (!hasBase)
+    {
+        const Skeleton& skeleton = mesh.GetSkeleton();
+        mPose.mLocals   = skeleton.mBindPose;
+        mPose.mAnimated.assign(skeleton.GetNumNodes(), 0);
+    }
+    
+    //=========================================================
+    // ③ レイヤーを順に重ねる
+    //=========================================================
+    for (const PoseSample& s : mSamples)
+    {
+        if (s.layer < 0 || s.layer >= static_cast<int>(mLayers.size()))
+            continue;
+        
+        AnimationLayer& layer = mLayers[s.layer];
+        const BoneMask* mask  = layer.mask.mWeights.empty() ? nullptr : &layer.mask;
+        
+        mesh.SampleLocalPose(s.time, *s.clip, mScratchPose, &layer.cursor, mSkipLeafLevels);
+        if (layer.mode == AnimationLayerMode::Additive)
+        {
+            AnimationBlend::Additive(mPose, mScratchPose, layer.reference, s.weight, mask);
+        }
+        else
+        {
+            AnimationBlend::Blend(mPose, mScratchPose, s.weight, mask);
+        }
+    }
+    
+    //=========================================================
+    // ④ 階層計算は 1 回だけ
+    //=========================================================
+    mesh.ComputeSkinningMatrices(mPose, mFinalMatrices, mGlobalPose);
+    
+    // 同じ内容を二度計算しない
+    mSamples.clear();
+}
+
 //-------------------------------------------------------------
 // 1 回再生用
 //  - animID    : 1 回だけ再生するクリップ
@@ -151,6 +337,7 @@ void AnimationPlayer::PlayOnce(int animID, int nextAnimID)
     mIsPaused   = false;
     mIsFinished = false;
     mNextAnimID = nextAnimID;
+    mIsTreeActive = false;
 }
 
 //-------------------------------------------------------------
@@ -167,40 +354,177 @@ void AnimationPlayer::PlayBlend(int fromAnimID, int toAnimID, float duration)
     if (toAnimID < 0 || toAnimID >= static_cast<int>(clips.size()))
         return;
     
-    mBlend.fromAnim      = clips[fromAnimID].mAnimation;
-    mBlend.toAnim        = clips[toAnimID].mAnimation;
+    mBlend.fromAnim      = &clips[fromAnimID];
+    mBlend.toAnim        = &clips[toAnimID];
     mBlend.blendDuration = duration;
     mBlend.blendTime     = 0.0f;
     mBlend.isBlending    = true;
+    mIsTreeActive        = false;
+}
+
+//-------------------------------------------------------------
+// ブレンドツリー再生開始
+//  - entries : クリップと位置（内部で position 昇順に並べ替える）
+//  - parameter: 初期パラメータ
+//-------------------------------------------------------------
+void AnimationPlayer::PlayBlendTree(const std::vector<BlendTreeEntry>& entries, float parameter)
+{
+    const auto& clips = mMesh->GetAnimationClips();
+    mTreeEntries.clear();
+    for (const auto& e : entries)
+    {
+        if (e.animID < 0 || e.animID >= static_cast<int>(clips.size()))
+        {
+            std::cerr << "[AnimationPlayer] Invalid blend tree clip: " << e.animID << std::endl;
+            continue;
+        }
+        mTreeEntries.push_back(e);
+    }
+    if (mTreeEntries.empty())
+        return;
+    
+    std::stable_sort(mTreeEntries.begin(), mTreeEntries.end(),
+                     [](const BlendTreeEntry& a, const BlendTreeEntry& b)
+                     { return a.position < b.position; });
+    
+    mTreeWeights.assign(mTreeEntries.size(), 0.0f);
+    mTreePhase        = 0.0f;
+    mIsTreeActive     = true;
+    mIsPaused         = false;
+    mIsFinished       = false;
+    mBlend.isBlending = false;
+    
+    SetBlendParameter(parameter);
+}
+
+//-------------------------------------------------------------
+// パラメータ → 重み（両隣の 2 本を線形に）
+//-------------------------------------------------------------
+void AnimationPlayer::SetBlendParameter(float parameter)
+{
+    if (mTreeEntries.empty())
+        return;
+    
+    std::fill(mTreeWeights.begin(), mTreeWeights.end(), 0.0f);
+    
+    const size_t last = mTreeEntries.size() - 1;
+    if (parameter <= mTreeEntries[0].position)
+    {
+        mTreeWeights[0] = 1.0f;
+        return;
+    }
+    if (parameter >= mTreeEntries[last].position)
+    {
+        mTreeWeights[last] = 1.0f;
+        return;
+    }
+    
+    for (size_t i = 0; i < last; i++)
+    {
+        float p0 = mTreeEntries[i].position;
+        float p1 = mTreeEntries[i + 1].position;
+        if (parameter <= p1)
+        {
+            float f = (p1 > p0) ? (parameter - p0) / (p1 - p0) : 1.0f;
+            mTreeWeights[i]     = 1.0f - f;
+            mTreeWeights[i + 1] = f;
+            return;
+        }
+    }
+}
+
+//-------------------------------------------------------------
+// 重みを直接指定（N 本）
+//-------------------------------------------------------------
+void AnimationPlayer::SetBlendWeights(const std::vector<float>& weights)
+{
+    if (mTreeEntries.empty())
+        return;
+    
+    float total = 0.0f;
+    for (size_t i = 0; i < mTreeWeights.size(); i++)
+    {
+        mTreeWeights[i] = (i < weights.size()) ? std::max(weights[i], 0.0f) : 0.0f;
+        total += mTreeWeights[i];
+    }
+    
+    if (total <= 0.0f)
+    {
+        mTreeWeights[0] = 1.0f;
+        return;
+    }
+    for (float& w : mTreeWeights)
+    {
+        w /= total;
+    }
 }
 
 //-------------------------------------------------------------
-// 行列の線形補間（要素ごと）
-//  - ※本来は平行移動/回転/スケールを分解して補間した方が綺麗だが
-//    ここでは簡易に 4x4 行列の要素を直接 Lerp している
+// レイヤー追加
+//  - 加算レイヤーはクリップ先頭フレームを基準姿勢として保持
 //-------------------------------------------------------------
-Matrix4 AnimationPlayer::LerpMatrix(const Matrix4& a, const Matrix4& b, float t)
+int AnimationPlayer::AddLayer(int animID,
+                              AnimationLayerMode mode,
+                              float weight,
+                              const std::string& maskRoot)
 {
-    Matrix4 result;
-    for (int i = 0; i < 4; i++)
+    const auto& clips = mMesh->GetAnimationClips();
+    if (animID < 0 || animID >= static_cast<int>(clips.size()))
+        return -1;
+    
+    AnimationLayer layer;
+    layer.clip   = &clips[animID];
+    layer.mode   = mode;
+    layer.weight = weight;
+    
+    if (!maskRoot.empty())
     {
-        for (int j = 0; j < 4; j++)
+        layer.mask = BoneMask::FromSubtree(mMesh->GetSkeleton(), maskRoot);
+        if (layer.mask.mWeights.empty())
         {
-            result.mat[i][j] = a.mat[i][j] * (1.0f - t) + b.mat[i][j] * t;
+            std::cerr << "[AnimationPlayer] Mask root not found: " << maskRoot << std::endl;
         }
     }
-    return result;
+    
+    if (mode == AnimationLayerMode::Additive)
+    {
+        mMesh->SampleLocalPose(0.0f, *layer.clip, layer.reference);
+    }
+    
+    mLayers.emplace_back(std::move(layer));
+    return static_cast<int>(mLayers.size()) - 1;
+}
+
+//-------------------------------------------------------------
+// レイヤーの重み
+//-------------------------------------------------------------
+void AnimationPlayer::SetLayerWeight(int layer, float weight)
+{
+    if (layer < 0 || layer >= static_cast<int>(mLayers.size()))
+        return;
+    mLayers[layer].weight = weight;
+}
+
+//-------------------------------------------------------------
+// 全レイヤーを外す
+//  - 記録済みサンプルがレイヤー番号を指しているので捨てる
+//    （このフレームは前回の行列のまま）
+//-------------------------------------------------------------
+void AnimationPlayer::ClearLayers()
+{
+    mLayers.clear();
+    mSamples.clear();
 }
 
 //-------------------------------------------------------------
-// aiAnimation* から対応するクリップ番号を探す
+// AnimationClip* から対応するクリップ番号を探す
 //-------------------------------------------------------------
-int AnimationPlayer::FindClipIndex(const aiAnimation* anim) const
+int AnimationPlayer::FindClipIndex(const AnimationClip* anim) const
 {
     const auto& clips = mMesh->GetAnimationClips();
     for (size_t i = 0; i < clips.size(); i++)
     {
-        if (clips[i].mAnimation == anim)
+        if (&clips[i] == anim)
         {
             return static_cast<int>(i);
         }
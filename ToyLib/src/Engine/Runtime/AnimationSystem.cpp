@@ -0,0 +1,190 @@
+#include "Engine/Runtime/AnimationSystem.h"
+#include "Engine/Runtime/JobSystem.h"
+#include "Graphics/Mesh/SkeletalMeshComponent.h"
+#include "Utils/JsonHelper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+namespace toy {
+
+namespace {
+// 1 ジョブあたりのキャラ数（ポーズ 1 体は数十 µs 程度なので小さめ）
+constexpr size_t kGrainSize = 4;
+}
+
+AnimationSystem::AnimationSystem()
+: mFrame(0)
+{
+}
+
+//-------------------------------------------------------------
+// 登録管理
+//-------------------------------------------------------------
+void AnimationSystem::AddSkeletalMesh(SkeletalMeshComponent* comp)
+{
+    mSkeletalMeshes.emplace_back(comp);
+}
+
+void AnimationSystem::RemoveSkeletalMesh(SkeletalMeshComponent* comp)
+{
+    auto iter = std::find(mSkeletalMeshes.begin(), mSkeletalMeshes.end(), comp);
+    if (iter != mSkeletalMeshes.end())
+    {
+        mSkeletalMeshes.erase(iter);
+    }
+}
+
+//-------------------------------------------------------------
+// LOD 判定
+//  - 可視性は前フレームの描画結果（シャドウパス含む）で見る。
+//    画面に入った最初の 1 フレームだけ古いポーズで描かれる
+//-------------------------------------------------------------
+AnimationLod AnimationSystem::SelectLod(SkeletalMeshComponent* comp) const
+{
+    if (!mLodSettings.enabled)
+        return AnimationLod::Full;
+    
+    if (mLodSettings.cullOffscreen && !comp->WasDrawnLastFrame())
+        return AnimationLod::Culled;
+    
+    float size = comp->ComputeScreenSize();
+    if (size < mLodSettings.quarterRateSize)
+        return AnimationLod::Quarter;
+    if (size < mLodSettings.halfRateSize)
+        return AnimationLod::Half;
+    return AnimationLod::Full;
+}
+
+//-------------------------------------------------------------
+// ポーズ計算
+//  - 各コンポーネントは自分の AnimationPlayer のバッファにだけ書き、
+//    共有している Mesh は読むだけなので、ロック無しで並列に回せる
+//  - 間引くキャラは前回の行列をそのまま使う（再生時間は進んでいるので
+//    次に計算したときに正しい姿勢へ戻る）。位相はキャラごとにずらして
+//    計算負荷がフレーム間で偏らないようにする
+//-------------------------------------------------------------
+void AnimationSystem::Update(JobSystem* jobs)
+{
+    mFrame++;
+    
+    mStats = AnimationStats();
+    mStats.numCharacters = static_cast<int>(mSkeletalMeshes.size());
+    
+    mEvaluateList.clear();
+    for (size_t i = 0; i < mSkeletalMeshes.size(); i++)
+    {
+        SkeletalMeshComponent* comp = mSkeletalMeshes[i];
+        AnimationPlayer* player = comp->GetAnimPlayer();
+        if (!player || !player->HasPendingPose())
+            continue;
+        
+        int skipLeafLevels = 0;
+        switch (SelectLod(comp))
+        {
+            case AnimationLod::Culled:
+                mStats.numCulled++;
+                continue;
+            case AnimationLod::Quarter:
+                if ((mFrame + i) % 4 != 0)
+                {
+                    mStats.numThrottled++;
+                    continue;
+                }
+                skipLeafLevels = mLodSettings.skipLeafLevels;
+                break;
+            case AnimationLod::Half:
+                if ((mFrame + i) % 2 != 0)
+                {
+                    mStats.numThrottled++;
+                    continue;
+                }
+                break;
+            case AnimationLod::Full:
+                break;
+        }
+        
+        player->SetSkipLeafLevels(skipLeafLevels);
+        mEvaluateList.emplace_back(comp);
+    }
+    
+    if (mEvaluateList.empty())
+        return;
+    
+    auto evaluate = [this](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            mEvaluateList[i]->EvaluatePose();
+        }
+    };
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    if (jobs)
+    {
+        jobs->ParallelFor(mEvaluateList.size(), kGrainSize, evaluate);
+    }
+    else
+    {
+        evaluate(0, mEvaluateList.size());
+    }
+    
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    mStats.evaluateMs = std::chrono::duration<float, std::milli>(elapsed).count();
+    
+    mStats.numEvaluated = static_cast<int>(mEvaluateList.size());
+    for (auto* comp : mEvaluateList)
+    {
+        mStats.numBones += static_cast<int>(comp->GetAnimPlayer()->GetFinalMatrices().size());
+    }
+}
+
+//=============================================================
+// LoadSettings
+//   - Renderer_Settings.json の "animation_lod" セクション
+//
+//   "animation_lod": {
+//       "enabled": true,
+//       "cull_offscreen": true,
+//       "half_rate_screen_size": 0.15,
+//       "quarter_rate_screen_size": 0.06,
+//       "skip_leaf_levels": 2
+//   }
+//=============================================================
+bool AnimationSystem::LoadSettings(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open settings file: "
+                  << filePath.c_str() << std::endl;
+        return false;
+    }
+    
+    nlohmann::json data;
+    try
+    {
+        file >> data;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "JSON parse error: " << e.what() << std::endl;
+        return false;
+    }
+    
+    if (data.contains("animation_lod"))
+    {
+        const auto& lod = data["animation_lod"];
+        JsonHelper::GetBool (lod, "enabled",                  mLodSettings.enabled);
+        JsonHelper::GetBool (lod, "cull_offscreen",           mLodSettings.cullOffscreen);
+        JsonHelper::GetFloat(lod, "half_rate_screen_size",    mLodSettings.halfRateSize);
+        JsonHelper::GetFloat(lod, "quarter_rate_screen_size", mLodSettings.quarterRateSize);
+        JsonHelper::GetInt  (lod, "skip_leaf_levels",         mLodSettings.skipLeafLevels);
+    }
+    return true;
+}
+
+} // namespace toy
@@ -0,0 +1,147 @@
+#include "Engine/Runtime/JobSystem.h"
+
+#include <algorithm>
+
+namespace toy {
+
+namespace {
+// ワーカー数の上限（これ以上はメモリ帯域で頭打ちになる）
+constexpr unsigned int kMaxWorkers = 7;
+}
+
+//=============================================================
+// コンストラクタ／デストラクタ
+//=============================================================
+
+JobSystem::JobSystem(unsigned int numWorkers)
+: mFunc(nullptr)
+, mCount(0)
+, mGrainSize(1)
+, mNext(0)
+, mGeneration(0)
+, mBusy(0)
+, mQuit(false)
+{
+    if (numWorkers == 0)
+    {
+        unsigned int cores = std::thread::hardware_concurrency();
+        numWorkers = (cores > 1) ? std::min(cores - 1, kMaxWorkers) : 0;
+    }
+
+    mWorkers.reserve(numWorkers);
+    for (unsigned int i = 0; i < numWorkers; i++)
+    {
+        mWorkers.emplace_back(&JobSystem::WorkerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mQuit = true;
+    }
+    mWakeCond.notify_all();
+
+    for (auto& t : mWorkers)
+    {
+        t.join();
+    }
+}
+
+//=============================================================
+// 並列 for
+//=============================================================
+void JobSystem::ParallelFor(size_t count,
+                            size_t grainSize,
+                            const std::function<void(size_t, size_t)>& func)
+{
+    if (count == 0) return;
+    grainSize = std::max<size_t>(grainSize, 1);
+
+    // ワーカーが無い / 1 チャンクで終わるならその場で処理
+    if (mWorkers.empty() || count <= grainSize)
+    {
+        func(0, count);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        // 前回のジョブに遅れて起きたワーカーが手を離すまで待つ
+        // （ジョブ内容を書き換える前に必要）
+        mDoneCond.wait(lock, [this] { return mBusy == 0; });
+
+        mFunc      = &func;
+        mCount     = count;
+        mGrainSize = grainSize;
+        mNext.store(0, std::memory_order_relaxed);
+        mGeneration++;
+    }
+    mWakeCond.notify_all();
+
+    // 呼び出し側も処理に参加
+    while (RunChunk(&func, count, grainSize)) {}
+
+    // 取りかかったワーカーの完了待ち
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDoneCond.wait(lock, [this] { return mBusy == 0; });
+}
+
+//=============================================================
+// チャンク 1 つ分を処理
+//=============================================================
+bool JobSystem::RunChunk(const std::function<void(size_t, size_t)>* func,
+                         size_t count,
+                         size_t grainSize)
+{
+    size_t begin = mNext.fetch_add(grainSize, std::memory_order_relaxed);
+    if (begin >= count)
+    {
+        return false;
+    }
+    (*func)(begin, std::min(begin + grainSize, count));
+    return true;
+}
+
+//=============================================================
+// ワーカースレッド
+//=============================================================
+void JobSystem::WorkerLoop()
+{
+    uint64_t seen = 0;
+
+    for (;;)
+    {
+        const std::function<void(size_t, size_t)>* func;
+        size_t count;
+        size_t grainSize;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWakeCond.wait(lock, [&] { return mQuit || mGeneration != seen; });
+            if (mQuit)
+            {
+                return;
+            }
+
+            // ジョブ内容はロック中に写しておく
+            seen      = mGeneration;
+            func      = mFunc;
+            count     = mCount;
+            grainSize = mGrainSize;
+            mBusy++;
+        }
+
+        while (RunChunk(func, count, grainSize)) {}
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBusy--;
+        }
+        mDoneCond.notify_all();
+    }
+}
+
+} // namespace toy
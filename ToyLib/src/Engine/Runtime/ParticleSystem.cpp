@@ -0,0 +1,589 @@
+#include "Engine/Runtime/ParticleSystem.h"
+#include "Engine/Runtime/JobSystem.h"
+#include "Graphics/VisualComponent.h"
+#include "Asset/Effect/ParticleEffect.h"
+#include "Utils/JsonHelper.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TOYLIB_PARTICLE_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define TOYLIB_PARTICLE_NEON 1
+#endif
+
+namespace toy {
+
+namespace {
+
+// 積分 1 ジョブあたりの粒数（1 粒 ~1ns なので数十 µs 単位に分ける）
+constexpr size_t kChunkSize = 16384;
+
+// 詰め直し・並べ替えは 1 ジョブ 1 エミッタ
+constexpr size_t kPoolGrainSize = 1;
+
+//======================================================================
+// 4 粒ぶんの演算（SSE2 / NEON の薄い包み、無ければスカラーだけ）
+//======================================================================
+#if defined(TOYLIB_PARTICLE_SSE)
+#define TOYLIB_PARTICLE_SIMD 1
+using Float4 = __m128;
+inline Float4 Load4(const float* p)              { return _mm_loadu_ps(p); }
+inline void   Store4(float* p, Float4 v)         { _mm_storeu_ps(p, v); }
+inline Float4 Set4(float v)                      { return _mm_set1_ps(v); }
+inline Float4 Add4(Float4 a, Float4 b)           { return _mm_add_ps(a, b); }
+inline Float4 Mul4(Float4 a, Float4 b)           { return _mm_mul_ps(a, b); }
+inline Float4 MulAdd4(Float4 a, Float4 b, Float4 c) { return _mm_add_ps(a, _mm_mul_ps(b, c)); }
+inline bool   AnyGreater4(Float4 a, Float4 b)    { return _mm_movemask_ps(_mm_cmpgt_ps(a, b)) != 0; }
+#elif defined(TOYLIB_PARTICLE_NEON)
+#define TOYLIB_PARTICLE_SIMD 1
+using Float4 = float32x4_t;
+inline Float4 Load4(const float* p)              { return vld1q_f32(p); }
+inline void   Store4(float* p, Float4 v)         { vst1q_f32(p, v); }
+inline Float4 Set4(float v)                      { return vdupq_n_f32(v); }
+inline Float4 Add4(Float4 a, Float4 b)           { return vaddq_f32(a, b); }
+inline Float4 Mul4(Float4 a, Float4 b)           { return vmulq_f32(a, b); }
+inline Float4 MulAdd4(Float4 a, Float4 b, Float4 c) { return vmlaq_f32(a, b, c); }
+inline bool   AnyGreater4(Float4 a, Float4 b)    { return vmaxvq_u32(vcgtq_f32(a, b)) != 0; }
+#endif
+
+// 積分の範囲（チャンク 1 つぶんの先頭ポインタ）
+struct ParticleSpan
+{
+    float* posX;
+    float* posY;
+    float* posZ;
+    float* velX;
+    float* velY;
+    float* velZ;
+    float* t;
+    const float* invLife;
+    size_t count;
+};
+
+//======================================================================
+// モジュール：vel += (ax, ay, az)   ※ dt は掛け済み
+//======================================================================
+void ApplyAcceleration(const ParticleSpan& s, float ax, float ay, float az)
+{
+    size_t i = 0;
+#if defined(TOYLIB_PARTICLE_SIMD)
+    const Float4 vx = Set4(ax);
+    const Float4 vy = Set4(ay);
+    const Float4 vz = Set4(az);
+    for (; i + 4 <= s.count; i += 4)
+    {
+        Store4(s.velX + i, Add4(Load4(s.velX + i), vx));
+        Store4(s.velY + i, Add4(Load4(s.velY + i), vy));
+        Store4(s.velZ + i, Add4(Load4(s.velZ + i), vz));
+    }
+#endif
+    for (; i < s.count; i++)
+    {
+        s.velX[i] += ax;
+        s.velY[i] += ay;
+        s.velZ[i] += az;
+    }
+}
+
+//======================================================================
+// モジュール：vel *= factor
+//======================================================================
+void ApplyDrag(const ParticleSpan& s, float factor)
+{
+    size_t i = 0;
+#if defined(TOYLIB_PARTICLE_SIMD)
+    const Float4 vf = Set4(factor);
+    for (; i + 4 <= s.count; i += 4)
+    {
+        Store4(s.velX + i, Mul4(Load4(s.velX + i), vf));
+        Store4(s.velY + i, Mul4(Load4(s.velY + i), vf));
+        Store4(s.velZ + i, Mul4(Load4(s.velZ + i), vf));
+    }
+#endif
+    for (; i < s.count; i++)
+    {
+        s.velX[i] *= factor;
+        s.velY[i] *= factor;
+        s.velZ[i] *= factor;
+    }
+}
+
+//======================================================================
+// 積分：pos += vel * dt、t += invLife * dt
+// - 戻り値は t が 1 を超えた最初の粒（無ければ count）
+//   （寿命の判定を同じ読み込みで済ませ、死んだ粒が無いフレームは詰め直しを省く）
+//======================================================================
+size_t Integrate(const ParticleSpan& s, float dt)
+{
+    size_t i = 0;
+    size_t firstDead = s.count;
+#if defined(TOYLIB_PARTICLE_SIMD)
+    const Float4 vdt = Set4(dt);
+    const Float4 one = Set4(1.0f);
+    for (; i + 4 <= s.count; i += 4)
+    {
+        Store4(s.posX + i, MulAdd4(Load4(s.posX + i), Load4(s.velX + i), vdt));
+        Store4(s.posY + i, MulAdd4(Load4(s.posY + i), Load4(s.velY + i), vdt));
+        Store4(s.posZ + i, MulAdd4(Load4(s.posZ + i), Load4(s.velZ + i), vdt));
+        const Float4 vt = MulAdd4(Load4(s.t + i), Load4(s.invLife + i), vdt);
+        Store4(s.t + i, vt);
+        if (firstDead == s.count && AnyGreater4(vt, one))
+        {
+            firstDead = i;
+        }
+    }
+#endif
+    for (; i < s.count; i++)
+    {
+        s.posX[i] += s.velX[i] * dt;
+        s.posY[i] += s.velY[i] * dt;
+        s.posZ[i] += s.velZ[i] * dt;
+        s.t[i]    += s.invLife[i] * dt;
+        if (firstDead == s.count && s.t[i] > 1.0f)
+        {
+            firstDead = i;
+        }
+    }
+    return firstDead;
+}
+
+//======================================================================
+// モジュール列 → 積分（半陰的オイラー：速度を先に変える）
+//======================================================================
+size_t UpdateSpan(const ParticleSpan& s, const std::vector<ParticleModule>& modules, float dt)
+{
+    for (const ParticleModule& m : modules)
+    {
+        switch (m.type)
+        {
+            case ParticleModuleType::Acceleration:
+                ApplyAcceleration(s, m.x * dt, m.y * dt, m.z * dt);
+                break;
+            case ParticleModuleType::Drag:
+                ApplyDrag(s, std::exp(-m.x * dt));
+                break;
+        }
+    }
+    return Integrate(s, dt);
+}
+
+} // namespace
+
+//=============================================================
+// ParticlePool
+//=============================================================
+
+void ParticlePool::Resize(size_t n)
+{
+    posX.resize(n);
+    posY.resize(n);
+    posZ.resize(n);
+    velX.resize(n);
+    velY.resize(n);
+    velZ.resize(n);
+    t.resize(n);
+    invLife.resize(n);
+    capacity = n;
+    numAlive = std::min(numAlive, n);
+    drawOrder.clear();
+}
+
+void ParticlePool::Kill(size_t index)
+{
+    const size_t last = --numAlive;
+    if (index == last) return;
+
+    posX[index]    = posX[last];
+    posY[index]    = posY[last];
+    posZ[index]    = posZ[last];
+    velX[index]    = velX[last];
+    velY[index]    = velY[last];
+    velZ[index]    = velZ[last];
+    t[index]       = t[last];
+    invLife[index] = invLife[last];
+}
+
+//-------------------------------------------------------------
+// 1 粒出す
+//  - 空きは常に生存範囲の直後なので探さない
+//  - 位置は半径 spawnRadius の球内、向きは direction 軸の円錐内で一様
+//-------------------------------------------------------------
+void ParticlePool::Spawn()
+{
+    if (numAlive >= capacity || !effect) return;
+
+    const ParticleEffectDesc& desc = effect->GetDesc();
+    const size_t i = numAlive++;
+
+    Vector3 pos = spawnOffset;
+    if (desc.spawnRadius > 0.0f)
+    {
+        Vector3 p;
+        do
+        {
+            p = Vector3(random.Range(-1.0f, 1.0f),
+                        random.Range(-1.0f, 1.0f),
+                        random.Range(-1.0f, 1.0f));
+        } while (p.LengthSq() > 1.0f);
+        pos += p * desc.spawnRadius;
+    }
+
+    // 円錐：cosθ を [cos(角度), 1] で一様に取ると立体角で一様になる
+    const Vector3& axis = desc.direction;
+    const Vector3 helper = (Math::Abs(axis.y) < 0.99f) ? Vector3::UnitY : Vector3::UnitX;
+    const Vector3 tangent = Vector3::Normalize(Vector3::Cross(helper, axis));
+    const Vector3 bitangent = Vector3::Cross(axis, tangent);
+
+    const float cosMax = Math::Cos(Math::ToRadians(desc.coneAngle));
+    const float cosT = random.Range(cosMax, 1.0f);
+    const float sinT = Math::Sqrt(std::max(0.0f, 1.0f - cosT * cosT));
+    const float phi  = random.Range(0.0f, Math::TwoPi);
+    const float speed = random.Range(desc.speedMin, desc.speedMax);
+
+    Vector3 vel = (tangent * (sinT * Math::Cos(phi)) +
+                   bitangent * (sinT * Math::Sin(phi)) +
+                   axis * cosT) * speed;
+    vel.x += random.Range(-desc.velocityRandom.x, desc.velocityRandom.x);
+    vel.y += random.Range(-desc.velocityRandom.y, desc.velocityRandom.y);
+    vel.z += random.Range(-desc.velocityRandom.z, desc.velocityRandom.z);
+
+    posX[i]    = pos.x;
+    posY[i]    = pos.y;
+    posZ[i]    = pos.z;
+    velX[i]    = vel.x;
+    velY[i]    = vel.y;
+    velZ[i]    = vel.z;
+    t[i]       = 0.0f;
+    invLife[i] = 1.0f / random.Range(desc.lifeMin, desc.lifeMax);
+}
+
+//=============================================================
+// ParticleSystem
+//=============================================================
+
+ParticleSystem::ParticleSystem()
+: mDeltaTime(0.0f)
+, mCameraPos(Vector3::Zero)
+, mCameraForward(Vector3::UnitZ)
+{
+}
+
+ParticleSystem::~ParticleSystem()
+{
+}
+
+//-------------------------------------------------------------
+// プール管理
+//  - unique_ptr で持つので、登録が増減してもプールの位置は動かない
+//-------------------------------------------------------------
+ParticlePool* ParticleSystem::CreatePool(VisualComponent* owner)
+{
+    auto pool = std::make_unique<ParticlePool>();
+    pool->owner = owner;
+    pool->random.Seed(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pool.get())));
+
+    ParticlePool* raw = pool.get();
+    mPools.emplace_back(std::move(pool));
+    return raw;
+}
+
+void ParticleSystem::DestroyPool(ParticlePool* pool)
+{
+    auto iter = std::find_if(mPools.begin(), mPools.end(),
+                             [pool](const std::unique_ptr<ParticlePool>& p) { return p.get() == pool; });
+    if (iter != mPools.end())
+    {
+        mPools.erase(iter);
+    }
+}
+
+//-------------------------------------------------------------
+// 予算
+//  - 上限を超えていたら、前フレームで描かれていないエミッタを
+//    優先度の低い順に空にする（見えていないので消えても気づかれない）
+//  - 残りの枠を優先度の高い順に今フレームの発生へ配る
+//    （枠が無いエミッタは発生だけ止め、生きている粒はそのまま）
+//-------------------------------------------------------------
+void ParticleSystem::ApplyBudget()
+{
+    const size_t maxLive = static_cast<size_t>(std::max(0, mSettings.maxLiveParticles));
+
+    size_t total = 0;
+    for (const Work& w : mWork)
+    {
+        total += w.pool->numAlive;
+    }
+
+    // 優先度の低い順（同じなら画面外を先に）
+    std::stable_sort(mWork.begin(), mWork.end(), [](const Work& a, const Work& b)
+    {
+        if (a.pool->priority != b.pool->priority) return a.pool->priority < b.pool->priority;
+        const bool aDrawn = a.pool->owner && a.pool->owner->WasDrawnLastFrame();
+        const bool bDrawn = b.pool->owner && b.pool->owner->WasDrawnLastFrame();
+        return !aDrawn && bDrawn;
+    });
+
+    if (total > maxLive && mSettings.cullOffscreen)
+    {
+        for (Work& w : mWork)
+        {
+            if (total <= maxLive)
+                break;
+            if (!w.pool->owner || w.pool->owner->WasDrawnLastFrame() || w.pool->numAlive == 0)
+                continue;
+
+            total -= w.pool->numAlive;
+            w.pool->numAlive = 0;
+            w.pool->drawOrder.clear();
+            mStats.numCulled++;
+        }
+    }
+
+    // 発生枠は優先度の高い順に配る
+    //  - 発生数は spawnRate × dt（端数は持ち越し）＋ 溜まっているバースト
+    //  - 枠が足りずに出せなかった分は持ち越さない（後でまとめて出ないように）
+    size_t remaining = (total < maxLive) ? maxLive - total : 0;
+    for (auto iter = mWork.rbegin(); iter != mWork.rend(); ++iter)
+    {
+        ParticlePool* pool = iter->pool;
+        const ParticleEffectDesc& desc = pool->effect->GetDesc();
+
+        pool->spawnAccum += desc.spawnRate * mDeltaTime;
+        const float whole = std::floor(pool->spawnAccum);
+        pool->spawnAccum -= whole;
+
+        size_t want = static_cast<size_t>(whole) + pool->burstPending;
+        pool->burstPending = 0;
+
+        const size_t room = pool->capacity - pool->numAlive;
+        want = std::min(want, room);
+        if (want > remaining)
+        {
+            want = remaining;
+            mStats.numThrottled++;
+        }
+        iter->spawnCount = static_cast<uint32_t>(want);
+        remaining -= want;
+    }
+}
+
+//-------------------------------------------------------------
+// エミッタ 1 つぶんの仕上げ（ワーカーから呼ばれる）
+//  - 書くのはこのプールだけなので、エミッタ同士はロック無しで並列に回せる
+//-------------------------------------------------------------
+void ParticleSystem::FinishPool(size_t index)
+{
+    Work& w = mWork[index];
+    ParticlePool& pool = *w.pool;
+
+    // 寿命切れを詰める（分割した積分の結果から最初の 1 粒を拾う）
+    size_t firstDead = pool.numAlive;
+    for (size_t c = w.chunkBegin; c < w.chunkEnd; c++)
+    {
+        if (mChunks[c].firstDead < mChunks[c].end)
+        {
+            firstDead = mChunks[c].firstDead;
+            break;
+        }
+    }
+    for (size_t i = firstDead; i < pool.numAlive;)
+    {
+        if (pool.t[i] > 1.0f)
+            pool.Kill(i);
+        else
+            i++;
+    }
+
+    for (uint32_t s = 0; s < w.spawnCount; s++)
+    {
+        pool.Spawn();
+    }
+
+    //---------------------------------------------------------
+    // 通常ブレンドは奥→手前の順を作る（加算は順番に依らない）
+    //  - 画面外のエミッタは描かれないので省く
+    //---------------------------------------------------------
+    if (!pool.sortBackToFront || (pool.owner && !pool.owner->WasDrawnLastFrame()))
+    {
+        pool.drawOrder.clear();
+        return;
+    }
+
+    const size_t n = pool.numAlive;
+    pool.sortKeys.resize(n);
+    pool.drawOrder.resize(n);
+
+    // 奥行き = (center + pos * scale - camera) · forward
+    const float base = Vector3::Dot(pool.center - mCameraPos, mCameraForward);
+    const float fx = mCameraForward.x * pool.scale;
+    const float fy = mCameraForward.y * pool.scale;
+    const float fz = mCameraForward.z * pool.scale;
+    for (size_t i = 0; i < n; i++)
+    {
+        pool.sortKeys[i]  = base + pool.posX[i] * fx + pool.posY[i] * fy + pool.posZ[i] * fz;
+        pool.drawOrder[i] = static_cast<uint32_t>(i);
+    }
+
+    const float* keys = pool.sortKeys.data();
+    std::sort(pool.drawOrder.begin(), pool.drawOrder.end(),
+              [keys](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+}
+
+//-------------------------------------------------------------
+// 更新
+//  1) 予算（メインスレッド）
+//  2) 積分：全エミッタの生存範囲を kChunkSize ごとに分けて並列
+//  3) 仕上げ：エミッタごとに並列（詰め直し・発生・並べ替え）
+//-------------------------------------------------------------
+void ParticleSystem::Update(float deltaTime, JobSystem* jobs, const Matrix4& invView)
+{
+    mStats = ParticleStats();
+    mStats.numEmitters = static_cast<int>(mPools.size());
+
+    mDeltaTime     = deltaTime;
+    mCameraPos     = invView.GetTranslation();
+    mCameraForward = invView.GetZAxis();
+
+    mWork.clear();
+    for (auto& pool : mPools)
+    {
+        if (!pool->active || !pool->effect)
+            continue;
+
+        // 定義が変わった（初回・ホットリロード）→ 容量を合わせ、バーストを出し直す
+        const ParticleEffect& effect = *pool->effect;
+        if (pool->effectVersion != effect.GetVersion())
+        {
+            pool->Resize(effect.GetDesc().maxParticles);
+            pool->burstPending  = effect.GetDesc().burst;
+            pool->spawnAccum    = 0.0f;
+            pool->effectVersion = effect.GetVersion();
+        }
+        pool->sortBackToFront = !effect.IsBlendAdd();
+
+        if (pool->capacity > 0)
+        {
+            mWork.push_back({ pool.get(), 0, 0, 0 });
+        }
+    }
+    if (mWork.empty())
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+
+    ApplyBudget();
+
+    mChunks.clear();
+    for (Work& w : mWork)
+    {
+        w.chunkBegin = mChunks.size();
+        for (size_t begin = 0; begin < w.pool->numAlive; begin += kChunkSize)
+        {
+            const size_t end = std::min(begin + kChunkSize, w.pool->numAlive);
+            mChunks.push_back({ w.pool, begin, end, end });
+        }
+        w.chunkEnd = mChunks.size();
+    }
+
+    auto integrate = [this](size_t begin, size_t end)
+    {
+        for (size_t c = begin; c < end; c++)
+        {
+            Chunk& chunk = mChunks[c];
+            ParticlePool& pool = *chunk.pool;
+            const size_t b = chunk.begin;
+
+            ParticleSpan span;
+            span.posX    = pool.posX.data() + b;
+            span.posY    = pool.posY.data() + b;
+            span.posZ    = pool.posZ.data() + b;
+            span.velX    = pool.velX.data() + b;
+            span.velY    = pool.velY.data() + b;
+            span.velZ    = pool.velZ.data() + b;
+            span.t       = pool.t.data() + b;
+            span.invLife = pool.invLife.data() + b;
+            span.count   = chunk.end - b;
+            chunk.firstDead = b + UpdateSpan(span, pool.effect->GetModules(), mDeltaTime);
+        }
+    };
+
+    auto finish = [this](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            FinishPool(i);
+        }
+    };
+
+    if (jobs)
+    {
+        if (!mChunks.empty())
+        {
+            jobs->ParallelFor(mChunks.size(), 1, integrate);
+        }
+        jobs->ParallelFor(mWork.size(), kPoolGrainSize, finish);
+    }
+    else
+    {
+        integrate(0, mChunks.size());
+        finish(0, mWork.size());
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    mStats.simulateMs = std::chrono::duration<float, std::milli>(elapsed).count();
+
+    mStats.numSimulated = static_cast<int>(mWork.size());
+    for (const Work& w : mWork)
+    {
+        mStats.numAlive  += static_cast<int>(w.pool->numAlive);
+        mStats.numSorted += static_cast<int>(w.pool->drawOrder.size());
+    }
+}
+
+//=============================================================
+// LoadSettings
+//   - Renderer_Settings.json の "particles" セクション
+//
+//   "particles": {
+//       "max_live_particles": 200000,
+//       "cull_offscreen": true
+//   }
+//=============================================================
+bool ParticleSystem::LoadSettings(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open settings file: "
+                  << filePath.c_str() << std::endl;
+        return false;
+    }
+
+    nlohmann::json data;
+    try
+    {
+        file >> data;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "JSON parse error: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (data.contains("particles"))
+    {
+        const auto& particles = data["particles"];
+        JsonHelper::GetInt (particles, "max_live_particles", mSettings.maxLiveParticles);
+        JsonHelper::GetBool(particles, "cull_offscreen",     mSettings.cullOffscreen);
+    }
+    return true;
+}
+
+} // namespace toy
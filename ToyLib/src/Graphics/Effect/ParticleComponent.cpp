@@ -1,12 +1,11 @@
 // ParticleComponent.cpp
 #include "Graphics/Effect/ParticleComponent.h"
 #include "Engine/Core/Actor.h"
-#include "Engine/Render/Shader.h"
 #include "Asset/Material/Texture.h"
 #include "Engine/Core/Application.h"
 #include "Engine/Render/Renderer.h"
-#include "Asset/Geometry/VertexArray.h"
-#include <random>
+#include "Engine/Runtime/ParticleSystem.h"
+#include "Asset/Effect/ParticleEffect.h"
 
 namespace toy {
 
@@ -16,6 +15,9 @@ namespace toy {
 ParticleComponent::ParticleComponent(Actor* owner, int drawOrder)
 : VisualComponent(owner, drawOrder)
 , mTexture(nullptr)
+, mEffect(nullptr)
+, mLegacyEffect(false)
+, mPool(nullptr)
 , mDrawOrder(drawOrder)
 , mIsBlendAdd(true)
 , mNumParts(0)
@@ -29,13 +31,13 @@ ParticleComponent::ParticleComponent(Actor* owner, int drawOrder)
     // 3D エフェクト扱い（ライト・深度あり）
     mLayer = VisualLayer::Effect3D;
 
-    // パーティクル用シェーダ
-    mShader = GetOwner()->GetApp()->GetRenderer()->GetShader("Particle");
+    // 粒の更新は ParticleSystem でまとめて行う
+    mPool = GetOwner()->GetApp()->GetParticleSystem()->CreatePool(this);
 }
 
 ParticleComponent::~ParticleComponent()
 {
-    mParts.clear();
+    GetOwner()->GetApp()->GetParticleSystem()->DestroyPool(mPool);
 }
 
 //======================================================================
@@ -47,7 +49,24 @@ void ParticleComponent::SetTexture(std::shared_ptr<Texture> tex)
 }
 
 //======================================================================
-// パーティクル生成（必要数だけ配列を確保）
+// エフェクト定義を使う
+//======================================================================
+void ParticleComponent::SetEffect(std::shared_ptr<ParticleEffect> effect, float life)
+{
+    mIsVisible      = true;
+    mLifeTime       = 0.0f;
+    mTotalLife      = life;
+    mEffect         = effect;
+    mLegacyEffect   = false;
+
+    mPool->numAlive      = 0;
+    mPool->spawnOffset   = Vector3::Zero;
+    mPool->effect        = mEffect;
+    mPool->effectVersion = 0;   // 次の更新で容量を合わせ、バーストを出す
+}
+
+//======================================================================
+// パーティクル生成（モードに相当する組み込みの定義を作る）
 //======================================================================
 void ParticleComponent::CreateParticles(
     Vector3 pos,
@@ -57,7 +76,6 @@ void ParticleComponent::CreateParticles(
     float size,
     ParticleMode mode
 ){
-    mPosition       = pos;
     mIsVisible      = true;
     mNumParts       = num;
     mLifeTime       = 0.0f;
@@ -66,153 +84,147 @@ void ParticleComponent::CreateParticles(
     mPartSize       = size;
     mParticleMode   = mode;
 
-    mParts.resize(mNumParts);
+    mEffect = std::make_shared<ParticleEffect>();
+    mLegacyEffect = true;
+    BuildLegacyEffect();
+
+    mPool->numAlive      = 0;
+    mPool->spawnOffset   = pos;
+    mPool->effect        = mEffect;
+    mPool->effectVersion = 0;
 }
 
 //======================================================================
-// パーティクル 1 個生成
-// - ランダムな方向に初期化する
-// - 空いているスロットだけ再利用
+// 組み込みの定義
+// - 以前の挙動（1 フレーム 1/2 の確率で 1 粒、各軸 ±速度係数の初速）を
+//   60fps 換算した値。位置・大きさは mPartSize 倍（Update で掛ける）
 //======================================================================
-void ParticleComponent::GenerateParts()
+void ParticleComponent::BuildLegacyEffect()
 {
-    std::random_device rnd;
+    if (!mLegacyEffect) return;
+
+    ParticleEffectDesc desc;
+    desc.blendAdd       = mIsBlendAdd;
+    desc.maxParticles   = mNumParts;
+    desc.spawnRate      = 30.0f;
+    desc.lifeMin        = mPartLifecycle;
+    desc.lifeMax        = mPartLifecycle;
+    desc.velocityRandom = Vector3(mPartSpeed, mPartSpeed, mPartSpeed);
+
+    // モード別の上下方向の加速度
+    // （以前の 1 フレーム 0.04 の速度変化を 60fps 換算した値）
+    if (mParticleMode == P_WATER)
+        desc.gravity = Vector3(0.0f, -2.4f, 0.0f);   // 落下
+    else if (mParticleMode == P_SMOKE)
+        desc.gravity = Vector3(0.0f, 2.4f, 0.0f);    // 上昇
+
+    mEffect->Compile(desc);
+}
 
-    for (int i = 0; i < mNumParts; i++)
-    {
-        if (mParts[i].isVisible) continue;   // 生存中なら skip
-
-        // ランダム方向（雑だが軽量）
-        float x = (float)(rnd() % (int)mPartSpeed);
-        float y = (float)(rnd() % (int)mPartSpeed);
-        float z = (float)(rnd() % (int)mPartSpeed);
-        if (rand() % 2) x *= -1;
-        if (rand() % 2) y *= -1;
-        if (rand() % 2) z *= -1;
-
-        mParts[i].pos       = mPosition;
-        mParts[i].dir       = Vector3(x, y, z);
-        mParts[i].isVisible = true;
-        mParts[i].lifeTime  = 0.0f;
-        mParts[i].size      = mPartSize;
-        break;
-    }
+//======================================================================
+// 設定
+//======================================================================
+void ParticleComponent::SetAddBlend(bool b)
+{
+    mIsBlendAdd = b;
+    BuildLegacyEffect();
+}
+
+void ParticleComponent::SetSpeed(float speed)
+{
+    mPartSpeed = speed;
+    BuildLegacyEffect();
+}
+
+void ParticleComponent::SetPriority(int priority)
+{
+    mPool->priority = priority;
+}
+
+size_t ParticleComponent::GetNumAlive() const
+{
+    return mPool->numAlive;
 }
 
 //======================================================================
 // Update
-// - パーティクル寿命管理
-// - モードごとの挙動（上昇/落下）
-// - ランダムに新規生成
+// - コンポーネントの寿命
+// - 粒の積分・発生は ParticleSystem が Actor 更新の後にまとめて行うので、
+//   ここではエミッタの位置と更新するかどうかを渡すだけ
 //======================================================================
 void ParticleComponent::Update(float deltaTime)
 {
-    // コンポーネント寿命
+    // コンポーネント寿命（0 は無限）
     mLifeTime += deltaTime;
-    if (mLifeTime > mTotalLife)
+    if (mTotalLife > 0.0f && mLifeTime > mTotalLife)
     {
         mIsVisible = false;
     }
 
-    // 各パーティクル更新
-    for (int i = 0; i < mNumParts; i++)
-    {
-        if (mParts[i].isVisible)
-        {
-            // モード別上下方向の変化
-            if (mParticleMode == P_WATER)
-                mParts[i].dir.y -= 0.04f;   // 落下
-            else if (mParticleMode == P_SMOKE)
-                mParts[i].dir.y += 0.04f;   // 上昇
-
-            // 位置更新
-            mParts[i].lifeTime += deltaTime;
-            mParts[i].pos += mParts[i].dir * deltaTime;
-
-            // 寿命超えたら非表示
-            if (mParts[i].lifeTime > mPartLifecycle)
-                mParts[i].isVisible = false;
-        }
-    }
+    // 組み込みの定義は以前どおりサイズ倍の単位
+    const float unit = mLegacyEffect ? mPartSize : 1.0f;
 
-    // ランダムに新規生成（負荷軽減の簡易実装）
-    if (rand() % 2 == 0)
-    {
-        GenerateParts();
-    }
+    mPool->active = mIsVisible;
+    mPool->center = GetOwner()->GetWorldTransform().GetTranslation();
+    mPool->scale  = unit * GetOwner()->GetScale();
 }
 
 //======================================================================
-// Draw（フルビルボード描画）
-// - 加算／アルファブレンド切り替え
-// - uPosition をパーティクルごとに更新して 6 ポリゴン描画
+// BillboardBatch へ積む
+// - 生きているパーティクルを 1 枚ずつインスタンスにして 1 回で渡す
+//   （描画はテクスチャ・ブレンドが同じ他のパーティクルとまとめて 1 回）
+// - 大きさ・色は定義のカーブ表を寿命 t で引く
 //======================================================================
-void ParticleComponent::Draw()
+bool ParticleComponent::SubmitBillboards(BillboardBatch& batch)
 {
-    if (!mIsVisible || mTexture == nullptr) return;
+    if (!mIsVisible || mEffect == nullptr) return false;
 
-    //------------------------------
-    // ブレンド設定
-    //------------------------------
-    if (mIsBlendAdd)
-    {
-        glBlendFunc(GL_ONE, GL_ONE); // 加算
-    }
-    else
-    {
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); // 通常
-    }
+    // 定義にテクスチャがあればそちらを優先
+    std::shared_ptr<Texture> tex = mEffect->GetTexture();
+    if (tex == nullptr) tex = mTexture;
+    if (tex == nullptr) return false;
+
+    const ParticleEffect& effect = *mEffect;
+    const ParticlePool& pool = *mPool;
+    const float scale = pool.scale;
 
-    //------------------------------
-    // ビルボード用ワールド行列
-    //------------------------------
-    Matrix4 mat = GetOwner()->GetWorldTransform();
-    Matrix4 invView = GetOwner()->GetApp()->GetRenderer()->GetInvViewMatrix();
-
-    // カメラの向きだけ利用し、位置はパーティクルに合わせる
-    invView.mat[3][0] = mat.mat[3][0];
-    invView.mat[3][1] = mat.mat[3][1];
-    invView.mat[3][2] = mat.mat[3][2];
-
-    Matrix4 scaleMat = Matrix4::CreateScale(mPartSize, mPartSize, 1);
-    Matrix4 world = scaleMat *
-                    Matrix4::CreateScale(GetOwner()->GetScale()) *
-                    invView;
-
-    auto renderer = GetOwner()->GetApp()->GetRenderer();
-    Matrix4 view = renderer->GetViewMatrix();
-    Matrix4 proj = renderer->GetProjectionMatrix();
-
-    //------------------------------
-    // シェーダ設定
-    //------------------------------
-    mShader->SetActive();
-    mShader->SetMatrixUniform("uViewProj", view * proj);
-    mShader->SetMatrixUniform("uWorldTransform", world);
-
-    mTexture->SetActive(0);
-    mShader->SetTextureUniform("uTexture", 0);
-
-    //------------------------------
-    // パーティクルを 1 つずつ描画
-    //------------------------------
-    mVertexArray->SetActive();
-    for (int i = 0; i < mNumParts; i++)
+    // 通常ブレンドは ParticleSystem が作った奥→手前の順で積む
+    const bool sorted = (pool.drawOrder.size() == pool.numAlive);
+
+    mInstances.resize(pool.numAlive);
+    for (size_t n = 0; n < pool.numAlive; n++)
     {
-        if (mParts[i].isVisible)
-        {
-            // 位置だけ更新して 6 ポリゴン描画
-            mShader->SetVectorUniform("uPosition", mParts[i].pos);
-            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
-        }
+        const size_t i = sorted ? pool.drawOrder[n] : n;
+
+        BillboardInstance& inst = mInstances[n];
+        inst.x = pool.center.x + pool.posX[i] * scale;
+        inst.y = pool.center.y + pool.posY[i] * scale;
+        inst.z = pool.center.z + pool.posZ[i] * scale;
+        inst.life   = pool.t[i];
+        effect.SampleColor(pool.t[i], inst.r, inst.g, inst.b, inst.a);
+        inst.u0 = 0.0f;
+        inst.v0 = 0.0f;
+        inst.u1 = 1.0f;
+        inst.v1 = 1.0f;
+        inst.width  = effect.SampleSize(pool.t[i]) * scale;
+        inst.height = inst.width;
     }
 
-    //------------------------------
-    // ブレンド戻す
-    //------------------------------
-    if (mIsBlendAdd)
+    batch.Add(tex.get(), effect.IsBlendAdd(), false, false, mDrawOrder,
+              mInstances.data(), mInstances.size());
+    return true;
+}
+
+//======================================================================
+// Draw（単独で描く場合）
+// - バッチへ積んですぐに描く
+//======================================================================
+void ParticleComponent::Draw()
+{
+    auto batch = GetOwner()->GetApp()->GetRenderer()->GetBillboardBatch();
+    if (batch && SubmitBillboards(*batch))
     {
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        batch->Flush();
     }
 }
 
@@ -41,6 +41,7 @@ void ShadowSpriteComponent::SetTexture(std::shared_ptr<Texture> tex)
 {
     // デフォルトの丸影テクスチャを差し替えたい場合に使用
     mTexture = tex;
+    mHasRegion = false;
 }
 
 void ShadowSpriteComponent::Draw()
@@ -61,8 +62,9 @@ void ShadowSpriteComponent::Draw()
     // ----------------------------------------
     // 影スプライトのスケールを決定
     // ----------------------------------------
-    float width  = static_cast<float>(mTexture->GetWidth())  * mScaleWidth;
-    float height = static_cast<float>(mTexture->GetHeight()) * mScaleHeight;
+    //  - 領域指定があればそのピクセルサイズを基準にする
+    float width  = static_cast<float>(mHasRegion ? mRegion.width  : mTexture->GetWidth())  * mScaleWidth;
+    float height = static_cast<float>(mHasRegion ? mRegion.height : mTexture->GetHeight()) * mScaleHeight;
 
     // mOffsetScale で全体の大きさを調整
     // ※高さ側は *3 して、やや楕円気味（足元影の潰れ感を演出）
@@ -114,13 +116,14 @@ void ShadowSpriteComponent::Draw()
     mShader->SetMatrixUniform("uViewProj", view * proj);
     mShader->SetMatrixUniform("uWorldTransform", world);
     
-    // 影用テクスチャをバインド
-    mTexture->SetActive(0); // ShadowSprite 用テクスチャユニット
-    mShader->SetTextureUniform("uTexture", 0);
+    // 影用テクスチャをバインド（アトラスの領域・配列の層も含む）
+    BindTextureRegion(*mTexture);
     
     // フルスクリーンクアッド or 汎用スプライト用の VAO を使用
     mVertexArray->SetActive();
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+    
+    UnbindTextureRegion();
 }
 
 } // namespace toy
@@ -0,0 +1,290 @@
+#include "Graphics/Mesh/CrowdMeshComponent.h"
+#include "Engine/Render/Shader.h"
+#include "Engine/Render/LightingManager.h"
+#include "Asset/Geometry/Mesh.h"
+#include "Asset/Animation/BakedAnimation.h"
+#include "Engine/Core/Actor.h"
+#include "Engine/Core/Application.h"
+#include "Engine/Render/Renderer.h"
+#include "Asset/Material/Texture.h"
+#include "Asset/Geometry/VertexArray.h"
+#include "Asset/Material/Material.h"
+
+#include <GL/glew.h>
+#include <cstddef>
+
+namespace toy {
+
+namespace {
+// インスタンス属性の先頭 location（CrowdSkinned.vert と合わせる）
+constexpr GLuint kInstanceLocation = 5;
+
+// 焼き込みテクスチャのユニット（0: マテリアル, 1: シャドウマップ）
+constexpr int kBakedPaletteUnit = 2;
+
+// 再生時間の折り返し（float の精度が落ちないように）
+constexpr float kTimeWrap = 3600.0f;
+}
+
+//----------------------------------------------------------------------
+// コンストラクタ／デストラクタ
+//----------------------------------------------------------------------
+CrowdMeshComponent::CrowdMeshComponent(Actor* a, int drawOrder, VisualLayer layer)
+: MeshComponent(a, drawOrder, layer, true)
+, mBaked(nullptr)
+, mInstanceBuffer(0)
+, mBufferCapacity(0)
+, mIsDirty(false)
+, mTime(0.0f)
+{
+    auto renderer = GetOwner()->GetApp()->GetRenderer();
+    mShader       = renderer->GetShader("CrowdSkinned");
+    mShadowShader = renderer->GetShader("ShadowCrowd");
+    mLayer        = layer;
+
+    glGenBuffers(1, &mInstanceBuffer);
+}
+
+CrowdMeshComponent::~CrowdMeshComponent()
+{
+    glDeleteBuffers(1, &mInstanceBuffer);
+}
+
+//----------------------------------------------------------------------
+// SetMesh
+//----------------------------------------------------------------------
+void CrowdMeshComponent::SetMesh(std::shared_ptr<Mesh> mesh,
+                                 std::shared_ptr<BakedAnimation> baked)
+{
+    MeshComponent::SetMesh(mesh);
+    mBaked = baked;
+}
+
+//----------------------------------------------------------------------
+// インスタンス管理
+//----------------------------------------------------------------------
+int CrowdMeshComponent::AddInstance(const Matrix4& transform,
+                                    int clip,
+                                    float timeOffset,
+                                    float playRate)
+{
+    mInstances.emplace_back();
+    int index = static_cast<int>(mInstances.size()) - 1;
+    SetInstanceTransform(index, transform);
+    SetInstanceClip(index, clip, timeOffset, playRate);
+    return index;
+}
+
+void CrowdMeshComponent::SetInstanceTransform(int index, const Matrix4& transform)
+{
+    if (index < 0 || index >= static_cast<int>(mInstances.size()))
+        return;
+
+    InstanceData& inst = mInstances[index];
+    for (int r = 0; r < 4; r++)
+    {
+        inst.col0[r] = transform.mat[r][0];
+        inst.col1[r] = transform.mat[r][1];
+        inst.col2[r] = transform.mat[r][2];
+    }
+    mIsDirty = true;
+}
+
+void CrowdMeshComponent::SetInstanceClip(int index, int clip, float timeOffset, float playRate)
+{
+    if (index < 0 || index >= static_cast<int>(mInstances.size()))
+        return;
+
+    WriteAnim(mInstances[index], clip, timeOffset, playRate);
+    mIsDirty = true;
+}
+
+void CrowdMeshComponent::ClearInstances()
+{
+    mInstances.clear();
+    mIsDirty = true;
+}
+
+//----------------------------------------------------------------------
+// クリップ情報をシェーダ用の 4 要素に詰める
+//  - 秒単位の指定を、焼き込みテクスチャの行単位に直しておく
+//----------------------------------------------------------------------
+void CrowdMeshComponent::WriteAnim(InstanceData& inst, int clip, float timeOffset, float playRate) const
+{
+    if (!mBaked || clip < 0 || clip >= mBaked->GetNumClips())
+    {
+        inst.anim[0] = inst.anim[1] = inst.anim[2] = inst.anim[3] = 0.0f;
+        return;
+    }
+
+    const BakedClip& baked = mBaked->GetClip(clip);
+    float fps = baked.GetFramesPerSecond();
+
+    inst.anim[0] = static_cast<float>(baked.mFirstRow);
+    inst.anim[1] = static_cast<float>(baked.mNumFrames);
+    inst.anim[2] = fps * playRate;
+    inst.anim[3] = fps * timeOffset;
+}
+
+//----------------------------------------------------------------------
+// Update
+//----------------------------------------------------------------------
+void CrowdMeshComponent::Update(float deltaTime)
+{
+    mTime += deltaTime;
+    if (mTime > kTimeWrap)
+    {
+        mTime -= kTimeWrap;
+    }
+}
+
+//----------------------------------------------------------------------
+// インスタンスバッファの転送
+//  - 容量が足りなければ作り直し、それ以外は上書きだけ
+//----------------------------------------------------------------------
+void CrowdMeshComponent::UploadInstances()
+{
+    if (!mIsDirty)
+        return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+    if (mInstances.size() > mBufferCapacity)
+    {
+        mBufferCapacity = mInstances.size();
+        glBufferData(GL_ARRAY_BUFFER,
+                     mBufferCapacity * sizeof(InstanceData),
+                     mInstances.data(),
+                     GL_DYNAMIC_DRAW);
+    }
+    else if (!mInstances.empty())
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, 0,
+                        mInstances.size() * sizeof(InstanceData),
+                        mInstances.data());
+    }
+    mIsDirty = false;
+}
+
+//----------------------------------------------------------------------
+// インスタンス属性の設定
+//  - VAO に記録されるので、サブメッシュの VAO を有効にした直後に呼ぶ
+//  - 通常のシェーダは location 5 以降を使わないので、
+//    有効のまま残っていても他の描画には影響しない
+//----------------------------------------------------------------------
+void CrowdMeshComponent::BindInstanceAttributes()
+{
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+
+    const size_t offsets[4] =
+    {
+        offsetof(InstanceData, col0),
+        offsetof(InstanceData, col1),
+        offsetof(InstanceData, col2),
+        offsetof(InstanceData, anim),
+    };
+    for (GLuint i = 0; i < 4; i++)
+    {
+        glEnableVertexAttribArray(kInstanceLocation + i);
+        glVertexAttribPointer(kInstanceLocation + i, 4, GL_FLOAT, GL_FALSE,
+                              sizeof(InstanceData),
+                              reinterpret_cast<const void*>(offsets[i]));
+        glVertexAttribDivisor(kInstanceLocation + i, 1);
+    }
+}
+
+//----------------------------------------------------------------------
+// 焼き込みテクスチャと再生時間
+//----------------------------------------------------------------------
+void CrowdMeshComponent::ApplyCrowdUniforms(const std::shared_ptr<Shader>& shader)
+{
+    mBaked->GetTexture()->SetActive(kBakedPaletteUnit);
+    shader->SetTextureUniform("uBakedPalette", kBakedPaletteUnit);
+    shader->SetFloatUniform("uTime", mTime);
+}
+
+//----------------------------------------------------------------------
+// 通常描画
+//  - 1 サブメッシュにつき 1 回のインスタンス描画
+//  - LOD はインスタンスごとに距離が違うので使わず、常に LOD0
+//----------------------------------------------------------------------
+void CrowdMeshComponent::Draw()
+{
+    if (!mMesh || !mBaked || !mBaked->GetTexture() || mInstances.empty()) return;
+
+    UploadInstances();
+
+    if (mIsBlendAdd)
+    {
+        glBlendFunc(GL_ONE, GL_ONE);
+    }
+
+    mShadowMapTexture->SetActive(1);
+
+    auto  renderer = GetOwner()->GetApp()->GetRenderer();
+    Matrix4 view   = renderer->GetViewMatrix();
+    Matrix4 proj   = renderer->GetProjectionMatrix();
+    Matrix4 light  = renderer->GetLightSpaceMatrix();
+
+    mShader->SetActive();
+    mLightingManger->ApplyToShader(mShader, view);
+    mShader->SetMatrixUniform("uViewProj", view * proj);
+    mShader->SetMatrixUniform("uLightSpaceMatrix", light);
+    mShader->SetTextureUniform("uShadowMap", 1);
+    mShader->SetFloatUniform("uShadowBias", 0.005f);
+    mShader->SetBooleanUniform("uUseToon", mIsToon);
+    mShader->SetMatrixUniform("uWorldTransform", GetOwner()->GetWorldTransform());
+    mShader->SetFloatUniform("uSpecPower", mMesh->GetSpecPower());
+    ApplyCrowdUniforms(mShader);
+
+    const GLsizei count = static_cast<GLsizei>(mInstances.size());
+    auto va = mMesh->GetVertexArray();
+    for (auto v : va)
+    {
+        auto mat = mMesh->GetMaterial(v->GetTextureID());
+        if (mat)
+        {
+            mat->BindToShader(mShader);
+        }
+        ApplyVertexFormat(mShader, v.get());
+        v->SetActive();
+        BindInstanceAttributes();
+        glDrawElementsInstanced(GL_TRIANGLES, v->GetLodNumIndices(0), GL_UNSIGNED_INT,
+                                v->GetLodIndexOffset(0), count);
+    }
+
+    if (mIsBlendAdd)
+    {
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+}
+
+//----------------------------------------------------------------------
+// シャドウ描画
+//----------------------------------------------------------------------
+void CrowdMeshComponent::DrawShadow()
+{
+    if (!mMesh || !mBaked || !mBaked->GetTexture() || mInstances.empty()) return;
+
+    UploadInstances();
+
+    auto   renderer = GetOwner()->GetApp()->GetRenderer();
+    Matrix4 light   = renderer->GetLightSpaceMatrix();
+
+    mShadowShader->SetActive();
+    mShadowShader->SetMatrixUniform("uWorldTransform", GetOwner()->GetWorldTransform());
+    mShadowShader->SetMatrixUniform("uLightSpaceMatrix", light);
+    ApplyCrowdUniforms(mShadowShader);
+
+    const GLsizei count = static_cast<GLsizei>(mInstances.size());
+    auto va = mMesh->GetVertexArray();
+    for (auto v : va)
+    {
+        ApplyVertexFormat(mShadowShader, v.get());
+        v->SetActive();
+        BindInstanceAttributes();
+        glDrawElementsInstanced(GL_TRIANGLES, v->GetLodNumIndices(0), GL_UNSIGNED_INT,
+                                v->GetLodIndexOffset(0), count);
+    }
+}
+
+} // namespace toy
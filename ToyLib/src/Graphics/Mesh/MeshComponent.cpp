@@ -26,6 +26,7 @@ MeshComponent::MeshComponent(Actor* a, int drawOrder, VisualLayer layer, bool is
     , mIsSkeletal(isSkeletal)
     , mIsToon(false)
     , mContourFactor(1.0f)
+    , mCurrentLod(0)
 {
     auto renderer = GetOwner()->GetApp()->GetRenderer();
     mShader          = renderer->GetShader("Mesh");
@@ -89,6 +90,9 @@ void MeshComponent::Draw()
     // ワールド変換を送る
     mShader->SetMatrixUniform("uWorldTransform", GetOwner()->GetWorldTransform());
 
+    // 画面サイズに応じた LOD
+    int lod = SelectLod();
+
     //--------------------------------------------------------
     // メッシュ本体の描画
     //  - Mesh は複数 VertexArray（サブメッシュ）を持つ前提
@@ -104,8 +108,9 @@ void MeshComponent::Draw()
             mat->BindToShader(mShader, 0);
         }
 
+        ApplyVertexFormat(mShader, v.get());
         v->SetActive();
-        glDrawElements(GL_TRIANGLES, v->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+        glDrawElements(GL_TRIANGLES, v->GetLodNumIndices(lod), GL_UNSIGNED_INT, v->GetLodIndexOffset(lod));
     }
 
     //--------------------------------------------------------
@@ -132,8 +137,9 @@ void MeshComponent::Draw()
                 mat->BindToShader(mShader, 0);
             }
 
+            ApplyVertexFormat(mShader, v.get());
             v->SetActive();
-            glDrawElements(GL_TRIANGLES, v->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+            glDrawElements(GL_TRIANGLES, v->GetLodNumIndices(lod), GL_UNSIGNED_INT, v->GetLodIndexOffset(lod));
 
             // 上書きカラーを元に戻す
             if (mat)
@@ -153,6 +159,82 @@ void MeshComponent::Draw()
     }
 }
 
+//------------------------------------------------------------
+// ComputeScreenSize()
+//  - ローカルのバウンディングスフィアをワールドへ移し、
+//    画面の高さに対する占有率を返す
+//------------------------------------------------------------
+float MeshComponent::ComputeScreenSize() const
+{
+    if (!mMesh) return 0.0f;
+
+    auto renderer = GetOwner()->GetApp()->GetRenderer();
+
+    // ローカルのスフィアをワールドへ
+    const Matrix4 world = GetOwner()->GetWorldTransform();
+    Vector3 center = Vector3::Transform(mMesh->GetBoundingCenter(), world);
+    Vector3 scale  = world.GetScale();
+    float   radius = mMesh->GetBoundingRadius() *
+                     Math::Max(scale.x, Math::Max(scale.y, scale.z));
+
+    return renderer->ComputeScreenSize(center, radius);
+}
+
+//------------------------------------------------------------
+// SelectLod()
+//  - バウンディングスフィアの画面占有率で LOD を決める
+//  - 境界付近でちらつかないよう、粗くする時は閾値より少し小さく、
+//    細かくする時は閾値より少し大きくなるまで切り替えない
+//------------------------------------------------------------
+int MeshComponent::SelectLod()
+{
+    auto renderer = GetOwner()->GetApp()->GetRenderer();
+    int numLods = mMesh ? mMesh->GetNumLods() : 1;
+    if (numLods <= 1 || !renderer->IsLodEnabled())
+    {
+        mCurrentLod = 0;
+        return mCurrentLod;
+    }
+
+    float size = ComputeScreenSize();
+    float h    = renderer->GetLodHysteresis();
+
+    // 各 LOD に入る画面サイズ（[0] は無条件）
+    const Vector3& ss = renderer->GetLodScreenSizes();
+    const float thresholds[4] = { Math::Infinity, ss.x, ss.y, ss.z };
+    int maxLod = Math::Min(numLods, 4) - 1;
+
+    int lod = Math::Min(mCurrentLod, maxLod);
+    while (lod < maxLod && size < thresholds[lod + 1] * (1.0f - h))
+    {
+        lod++;
+    }
+    while (lod > 0 && size > thresholds[lod] * (1.0f + h))
+    {
+        lod--;
+    }
+
+    mCurrentLod = lod;
+    return mCurrentLod;
+}
+
+//------------------------------------------------------------
+// ApplyVertexFormat()
+//  - 量子化 VAO なら位置の復元スケール / オフセットを送る
+//  - float VAO（従来形式）なら uQuantized = false
+//------------------------------------------------------------
+void MeshComponent::ApplyVertexFormat(const std::shared_ptr<Shader>& shader,
+                                      const VertexArray* va)
+{
+    shader->SetBooleanUniform("uQuantized", va->IsQuantized());
+    if (va->IsQuantized())
+    {
+        const VertexQuantization& q = va->GetQuantization();
+        shader->SetVectorUniform("uPosScale", q.scale);
+        shader->SetVectorUniform("uPosOffset", q.offset);
+    }
+}
+
 //------------------------------------------------------------
 // GetVertexArray()
 //  - 指定インデックスのサブメッシュ VAO を取得
@@ -182,12 +264,16 @@ void MeshComponent::DrawShadow()
     mShadowShader->SetMatrixUniform("uWorldTransform", GetOwner()->GetWorldTransform());
     mShadowShader->SetMatrixUniform("uLightSpaceMatrix", light);
 
+    // 影も本体と同じ LOD で描く
+    int lod = SelectLod();
+
     // VAO を全サブメッシュ分描画
     auto vaList = mMesh->GetVertexArray();
     for (auto& v : vaList)
     {
+        ApplyVertexFormat(mShadowShader, v.get());
         v->SetActive();
-        glDrawElements(GL_TRIANGLES, v->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+        glDrawElements(GL_TRIANGLES, v->GetLodNumIndices(lod), GL_UNSIGNED_INT, v->GetLodIndexOffset(lod));
     }
 }
 
@@ -5,10 +5,12 @@
 #include "Engine/Core/Actor.h"
 #include "Engine/Core/Application.h"
 #include "Engine/Render/Renderer.h"
+#include "Engine/Render/MatrixPaletteBuffer.h"
 #include "Asset/Material/Texture.h"
 #include "Asset/Geometry/VertexArray.h"
 #include "Asset/Material/Material.h"
 #include "Engine/Runtime/AnimationPlayer.h"
+#include "Engine/Runtime/AnimationSystem.h"
 
 namespace toy {
 
@@ -21,10 +23,22 @@ SkeletalMeshComponent::SkeletalMeshComponent(Actor* a, int drawOrder, VisualLaye
 : MeshComponent(a, drawOrder, layer,  true)
 , mAnimTime(0.0f)
 , mAnimPlayer(nullptr)
+, mPaletteHandle(0)
 {
     auto renderer = GetOwner()->GetApp()->GetRenderer();
     mShader       = renderer->GetShader("Skinned");
     mShadowShader = renderer->GetShader("ShadowSkinned");
+    
+    // ポーズ計算は AnimationSystem でまとめて行う
+    GetOwner()->GetApp()->GetAnimationSystem()->AddSkeletalMesh(this);
+}
+
+//----------------------------------------------------------------------
+// デストラクタ
+//----------------------------------------------------------------------
+SkeletalMeshComponent::~SkeletalMeshComponent()
+{
+    GetOwner()->GetApp()->GetAnimationSystem()->RemoveSkeletalMesh(this);
 }
 
 //----------------------------------------------------------------------
@@ -41,7 +55,7 @@ void SkeletalMeshComponent::SetAnimID(const unsigned int animID, const bool mode
 
 //----------------------------------------------------------------------
 // 通常描画
-//  - ボーン行列(uMatrixPalette)をシェーダへ渡してスキニング描画
+//  - ボーン行列パレット（UBO）を割り当ててスキニング描画
 //  - MeshComponent::Draw とほぼ同じ構成＋スキニング用処理
 //----------------------------------------------------------------------
 void SkeletalMeshComponent::Draw()
@@ -71,15 +85,14 @@ void SkeletalMeshComponent::Draw()
     mShader->SetBooleanUniform("uUseToon", mIsToon);
     mShader->SetMatrixUniform("uWorldTransform", GetOwner()->GetWorldTransform());
     
-    // ボーン行列パレットを取得してシェーダに送る
-    std::vector<Matrix4> transforms =
-        mAnimPlayer ? mAnimPlayer->GetFinalMatrices() : std::vector<Matrix4>();
+    // ボーン行列パレット（シャドウパスで送ってあればそれを使う）
+    BindPalette();
     
-    mShader->SetMatrixUniforms("uMatrixPalette",
-                               transforms.data(),
-                               static_cast<unsigned int>(transforms.size()));
     mShader->SetFloatUniform("uSpecPower", mMesh->GetSpecPower());
     
+    // 画面サイズに応じた LOD（頂点は共有なのでボーン情報はそのまま）
+    int lod = SelectLod();
+    
     // メッシュ本体描画
     auto va = mMesh->GetVertexArray();
     for (auto v : va)
@@ -89,8 +102,9 @@ void SkeletalMeshComponent::Draw()
         {
             mat->BindToShader(mShader);
         }
+        ApplyVertexFormat(mShader, v.get());
         v->SetActive();
-        glDrawElements(GL_TRIANGLES, v->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+        glDrawElements(GL_TRIANGLES, v->GetLodNumIndices(lod), GL_UNSIGNED_INT, v->GetLodIndexOffset(lod));
     }
     
     // トゥーン輪郭描画（アウトライン用にスケール拡大＋表裏反転）
@@ -108,8 +122,9 @@ void SkeletalMeshComponent::Draw()
                 mat->SetOverrideColor(true, Vector3(0.f, 0.f, 0.f));
                 mat->BindToShader(mShader, 0);
             }
+            ApplyVertexFormat(mShader, v.get());
             v->SetActive();
-            glDrawElements(GL_TRIANGLES, v->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+            glDrawElements(GL_TRIANGLES, v->GetLodNumIndices(lod), GL_UNSIGNED_INT, v->GetLodIndexOffset(lod));
             mat->SetOverrideColor(false, Vector3(0.f, 0.f, 0.f));
         }
         glFrontFace(GL_CCW);
@@ -124,7 +139,7 @@ void SkeletalMeshComponent::Draw()
 
 //----------------------------------------------------------------------
 // シャドウ描画
-//  - 通常描画と同様にボーン行列を渡しつつ、深度のみ書き込む想定
+//  - 通常描画と同じパレットを使い、深度のみ書き込む想定
 //----------------------------------------------------------------------
 void SkeletalMeshComponent::DrawShadow()
 {
@@ -136,34 +151,71 @@ void SkeletalMeshComponent::DrawShadow()
     mShadowShader->SetActive();
     mShadowShader->SetMatrixUniform("uWorldTransform", GetOwner()->GetWorldTransform());
     
-    // アニメーション行列（無ければ空配列）
-    static std::vector<Matrix4> gEmptyMatrixList;
-    std::vector<Matrix4> transforms =
-        mAnimPlayer ? mAnimPlayer->GetFinalMatrices() : gEmptyMatrixList;
+    // ボーン行列パレット（このフレーム最初の描画ならここで転送）
+    BindPalette();
     
-    mShadowShader->SetMatrixUniforms("uMatrixPalette",
-                                     transforms.data(),
-                                     static_cast<unsigned int>(transforms.size()));
     mShadowShader->SetMatrixUniform("uLightSpaceMatrix", light);
     
+    // 影も本体と同じ LOD
+    int lod = SelectLod();
+    
     // メッシュをシャドウマップ用に描画
     auto va = mMesh->GetVertexArray();
     for (auto v : va)
     {
+        ApplyVertexFormat(mShadowShader, v.get());
         v->SetActive();
-        glDrawElements(GL_TRIANGLES, v->GetNumIndices(), GL_UNSIGNED_INT, nullptr);
+        glDrawElements(GL_TRIANGLES, v->GetLodNumIndices(lod), GL_UNSIGNED_INT, v->GetLodIndexOffset(lod));
+    }
+}
+
+//----------------------------------------------------------------------
+// BindPalette
+//  - パレットは 1 フレームに 1 回だけ共有 UBO へ書き、
+//    シャドウパス / 通常パスでは同じ範囲を結びつけ直すだけ
+//  - 行列は AnimationPlayer のバッファを直接読む（コピーしない）
+//----------------------------------------------------------------------
+void SkeletalMeshComponent::BindPalette()
+{
+    auto palettes = GetOwner()->GetApp()->GetRenderer()->GetPaletteBuffer();
+    
+    if (!palettes->IsCurrent(mPaletteHandle))
+    {
+        const Matrix4* matrices = nullptr;
+        size_t         count    = 0;
+        if (mAnimPlayer)
+        {
+            const auto& finals = mAnimPlayer->GetFinalMatrices();
+            matrices = finals.data();
+            count    = finals.size();
+        }
+        mPaletteHandle = palettes->Upload(matrices, count);
     }
+    palettes->Bind(mPaletteHandle);
 }
 
 //----------------------------------------------------------------------
 // Update
-//  - 毎フレーム AnimationPlayer を進めるだけ
+//  - 毎フレーム AnimationPlayer の再生状態を進めるだけ
+//  - 行列は後で AnimationSystem から EvaluatePose() で計算される
 //----------------------------------------------------------------------
 void SkeletalMeshComponent::Update(float deltaTime)
 {
     if (mAnimPlayer)
     {
-        mAnimPlayer->Update(deltaTime);
+        mAnimPlayer->Advance(deltaTime);
+    }
+}
+
+//----------------------------------------------------------------------
+// EvaluatePose
+//  - Advance() で決めた時刻のボーン行列を計算
+//----------------------------------------------------------------------
+void SkeletalMeshComponent::EvaluatePose()
+{
+    if (mAnimPlayer)
+    {
+        mAnimPlayer->EvaluatePose();
     }
 }
 
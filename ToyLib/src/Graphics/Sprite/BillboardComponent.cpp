@@ -1,79 +1,61 @@
 #include "Graphics/Sprite/BillboardComponent.h"
 #include "Asset/Material/Texture.h"
-#include "Engine/Render/Shader.h"
-#include "Engine/Render/LightingManager.h"
-#include "Asset/Geometry/VertexArray.h"
+#include "Engine/Render/BillboardBatch.h"
 #include "Engine/Core/Application.h"
 #include "Engine/Core/Actor.h"
 #include "Engine/Render/Renderer.h"
 
-#include <GL/glew.h>
-
 namespace toy {
 
 BillboardComponent::BillboardComponent(class Actor* a, int drawOrder)
 : VisualComponent(a, drawOrder, VisualLayer::Effect3D)
 , mScale(1.0f)
 {
-    mShader = GetOwner()->GetApp()->GetRenderer()->GetShader("Mesh");
 }
 
 BillboardComponent::~BillboardComponent()
 {
 }
 
-void BillboardComponent::Draw()
+// BillboardBatch へ 1 枚積む
+//  - Y 軸だけカメラへ向け、Phong.frag でライティング・影を付ける
+bool BillboardComponent::SubmitBillboards(BillboardBatch& batch)
 {
-    if (!mIsVisible || !mTexture) return;
-    
-    if (mIsBlendAdd)
-    {
-        glBlendFunc(GL_ONE, GL_ONE);
-    }
-    
-    auto renderer = GetOwner()->GetApp()->GetRenderer();
-    Matrix4 view = renderer->GetViewMatrix();
-    Matrix4 proj = renderer->GetProjectionMatrix();
-    
-    
-    // カメラと位置取得
-    Vector3 pos = GetOwner()->GetPosition();
-    Matrix4 invView = GetOwner()->GetApp()->GetRenderer()->GetInvViewMatrix();
-    Vector3 cameraPos = invView.GetTranslation();
-    
-    // 回転角（Y軸）
-    Vector3 toCamera = pos - cameraPos;
-    toCamera.y = 0.0f;
-    toCamera.Normalize();
+    if (!mIsVisible || !mTexture) return false;
     
-    float angle = atan2f(toCamera.x, toCamera.z);
-    Matrix4 rotY = Matrix4::CreateRotationY(angle);
+    // BillboardLit シェーダは sampler2D のみ（配列テクスチャは描けない）
+    if (mTexture->IsArray()) return false;
     
-    // スケール＋平行移動
+    // 大きさ（領域指定があればそのピクセルサイズが基準）
     float scale = mScale * GetOwner()->GetScale();
-    Matrix4 scaleMat = Matrix4::CreateScale(mTexture->GetWidth() * scale,
-                                            mTexture->GetHeight() * scale, 1.0f);
-    Matrix4 translate = Matrix4::CreateTranslation(pos);
-    
-    mShader->SetActive();
-    mLightingManager->ApplyToShader(mShader, view);
-    
-    
-    // 最終行列
-    Matrix4 world = scaleMat * rotY * translate;
-    mShader->SetMatrixUniform("uWorldTransform", world);
-    mShader->SetMatrixUniform("uViewProj", view * proj);
-    mTexture->SetActive(0);
-    mShader->SetTextureUniform("uTexture", 0);
-    
-    
-    // VAO有効化
-    mVertexArray->SetActive();
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+    float texW = static_cast<float>(mHasRegion ? mRegion.width  : mTexture->GetWidth());
+    float texH = static_cast<float>(mHasRegion ? mRegion.height : mTexture->GetHeight());
+    Vector3 pos = GetOwner()->GetPosition();
     
-    if (mIsBlendAdd)
+    BillboardInstance inst;
+    inst.x = pos.x;
+    inst.y = pos.y;
+    inst.z = pos.z;
+    inst.life = 0.0f;
+    inst.r = inst.g = inst.b = inst.a = 1.0f;
+    inst.u0 = mHasRegion ? mRegion.u0 : 0.0f;
+    inst.v0 = mHasRegion ? mRegion.v0 : 0.0f;
+    inst.u1 = mHasRegion ? mRegion.u1 : 1.0f;
+    inst.v1 = mHasRegion ? mRegion.v1 : 1.0f;
+    inst.width  = texW * scale;
+    inst.height = texH * scale;
+    
+    batch.Add(mTexture.get(), mIsBlendAdd, true, true, GetDrawOrder(), &inst, 1);
+    return true;
+}
+
+// 単独で描く場合（バッチへ積んですぐに描く）
+void BillboardComponent::Draw()
+{
+    auto batch = GetOwner()->GetApp()->GetRenderer()->GetBillboardBatch();
+    if (batch && SubmitBillboards(*batch))
     {
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        batch->Flush();
     }
 }
 
@@ -1,10 +1,10 @@
 #include "Graphics/Sprite/SpriteComponent.h"
 #include "Asset/Material/Texture.h"
 #include "Engine/Render/Shader.h"
-#include "Engine/Render/LightingManager.h"
 #include "Asset/Geometry/VertexArray.h"
 #include "Engine/Core/Application.h"
 #include "Engine/Render/Renderer.h"
+#include "Engine/Render/SpriteBatch.h"
 #include "Engine/Core/Actor.h"
 #include <GL/glew.h>
 
@@ -42,18 +42,11 @@ void SpriteComponent::SetTexture(std::shared_ptr<Texture> tex)
     }
 }
 
-void SpriteComponent::Draw()
+//----------------------------------------------------------------------
+// 論理解像度 → 物理解像度の倍率
+//----------------------------------------------------------------------
+float SpriteComponent::ComputeScreenScale() const
 {
-    if (!mIsVisible || mTexture == nullptr) return;
-
-    // ---- ブレンド/深度設定 ----
-    glDisable(GL_DEPTH_TEST);
-    glDepthMask(GL_FALSE);
-    glEnable(GL_BLEND);
-    glBlendFunc(mIsBlendAdd ? GL_ONE : GL_SRC_ALPHA,
-        mIsBlendAdd ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
-    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-
     auto* renderer = GetOwner()->GetApp()->GetRenderer();
 
     // 物理解像度
@@ -71,40 +64,93 @@ void SpriteComponent::Draw()
     // 論理→物理変換は「小さい方」に合わせる（アスペクト比維持）
     float sx = sw / vw;
     float sy = sh / vh;
-    float scale = (sx < sy) ? sx : sy;
+    return (sx < sy) ? sx : sy;
+}
+
+//----------------------------------------------------------------------
+// 物理解像度での中心とサイズ
+//----------------------------------------------------------------------
+void SpriteComponent::ComputeScreenRect(Vector2& center, Vector2& size) const
+{
+    const float scale = ComputeScreenScale();
 
-    // サイズ
-    float texW = static_cast<float>(mTexWidth);
-    float texH = static_cast<float>(mTexHeight);
-    float width  = texW * mScaleWidth  * scale;
-    float height = texH * mScaleHeight * scale;
+    // サイズ（領域指定があればそのピクセルサイズ）
+    float texW = static_cast<float>(mHasRegion ? mRegion.width  : mTexWidth);
+    float texH = static_cast<float>(mHasRegion ? mRegion.height : mTexHeight);
+    size.x = texW * mScaleWidth  * scale;
+    size.y = texH * mScaleHeight * scale;
 
     // 位置
-    Vector3 pos = GetOwner()->GetPosition();
-    pos.x *= scale;
-    pos.y *= scale;
+    const Vector3& pos = GetOwner()->GetPosition();
+    center.x = pos.x * scale;
+    center.y = pos.y * scale;
+}
+
+//----------------------------------------------------------------------
+// SpriteBatch へ積む（UI / Background2D レイヤー）
+//----------------------------------------------------------------------
+bool SpriteComponent::SubmitToBatch(SpriteBatch& batch)
+{
+    if (mTexture == nullptr) return true;   // 描くものが無い
+
+    Vector2 center;
+    Vector2 size;
+    ComputeScreenRect(center, size);
+
+    if (mHasRegion)
+    {
+        batch.Add(mTexture.get(), mIsBlendAdd, mDrawOrder, center, size,
+                  mRegion.u0, mRegion.v0, mRegion.u1, mRegion.v1, mRegion.layer);
+    }
+    else
+    {
+        batch.Add(mTexture.get(), mIsBlendAdd, mDrawOrder, center, size,
+                  0.0f, 0.0f, 1.0f, 1.0f);
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------
+// 単体描画（3D レイヤーに置いた場合など）
+//----------------------------------------------------------------------
+void SpriteComponent::Draw()
+{
+    if (!mIsVisible || mTexture == nullptr) return;
+
+    // ---- ブレンド/深度設定 ----
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glEnable(GL_BLEND);
+    glBlendFunc(mIsBlendAdd ? GL_ONE : GL_SRC_ALPHA,
+        mIsBlendAdd ? GL_ONE : GL_ONE_MINUS_SRC_ALPHA);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+    auto* renderer = GetOwner()->GetApp()->GetRenderer();
+
+    Vector2 center;
+    Vector2 size;
+    ComputeScreenRect(center, size);
 
     // World / ViewProj
-    Matrix4 world = Matrix4::CreateScale(width, height, 1.0f);
-    world *= Matrix4::CreateTranslation(pos);
+    Matrix4 world = Matrix4::CreateScale(size.x, size.y, 1.0f);
+    world *= Matrix4::CreateTranslation(Vector3(center.x, center.y, GetOwner()->GetPosition().z));
 
-    Matrix4 viewProj = Matrix4::CreateSimpleViewProj(sw, sh);
+    Matrix4 viewProj = Matrix4::CreateSimpleViewProj(renderer->GetScreenWidth(),
+                                                     renderer->GetScreenHeight());
 
     mShader->SetActive();
     mShader->SetMatrixUniform("uViewProj", viewProj);
     mShader->SetMatrixUniform("uWorldTransform", world);
 
-    mTexture->SetActive(0);
-    mShader->SetTextureUniform("uTexture", 0);
-
-    Matrix4 view = renderer->GetViewMatrix();
-    mLightingManager->ApplyToShader(mShader, view);
+    BindTextureRegion(*mTexture);
 
     // ---- 描画 ----
     mVertexArray->SetActive();
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
 
     // ---- 戻す ----
+    UnbindTextureRegion();
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glEnable(GL_DEPTH_TEST);
     glDepthMask(GL_TRUE);
 }
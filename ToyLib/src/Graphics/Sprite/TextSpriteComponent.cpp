@@ -1,9 +1,12 @@
 #include "Graphics/Sprite/TextSpriteComponent.h"
 #include "Asset/Font/TextFont.h"
+#include "Asset/Font/GlyphAtlas.h"
 #include "Engine/Core/Actor.h"
 #include "Engine/Core/Application.h"
 #include "Engine/Render/Renderer.h"
+#include "Engine/Render/SpriteBatch.h"
 #include "Asset/Material/Texture.h"
+#include <GL/glew.h>
 
 namespace toy {
 
@@ -12,6 +15,8 @@ TextSpriteComponent::TextSpriteComponent(Actor* owner, int drawOrder, VisualLaye
 , mText("")
 , mColor(1.0f, 1.0f, 1.0f)
 , mFont(nullptr)
+, mFontSize(0.0f)
+, mMeshDirty(true)
 {
 }
 
@@ -27,49 +32,129 @@ void TextSpriteComponent::SetText(const std::string& text)
         return;
     }
     mText = text;
-    UpdateTexture();
+    mMeshDirty = true;
 }
 
 void TextSpriteComponent::SetColor(const Vector3& color)
 {
+    // 色は頂点色なので並べ直しは不要
     mColor = color;
-    UpdateTexture();
 }
 
 void TextSpriteComponent::SetFont(std::shared_ptr<TextFont> font)
 {
     mFont = font;
-    UpdateTexture();
+    mMeshDirty = true;
 }
 
 void TextSpriteComponent::Refresh()
 {
-    UpdateTexture();
+    mMeshDirty = true;
 }
 
-void TextSpriteComponent::UpdateTexture()
+//----------------------------------------------------------------------
+// 文字の並びを用意する
+//  - 並べ直すのは文字列・フォントが変わったときと、
+//    アトラスが拡張・詰め直しされて UV が古くなったときだけ
+//----------------------------------------------------------------------
+GlyphAtlas* TextSpriteComponent::PrepareMesh()
 {
-    // 前提条件が揃ってないならテクスチャをクリア
     if (mText.empty() || !mFont || !mFont->IsValid())
     {
-        SetTexture(nullptr);
-        return;
+        mMesh.Clear();
+        return nullptr;
     }
 
-    auto* app = GetOwner()->GetApp();
-    auto* renderer = app->GetRenderer();
+    GlyphAtlas* atlas = mFont->GetGlyphAtlas();
+    if (!atlas)
+    {
+        return nullptr;
+    }
 
-    auto tex = renderer->CreateTextTexture(mText, mColor, mFont);
-    if (!tex)
+    if (mMeshDirty || mMesh.IsStale(*atlas))
     {
-        // テキスト生成に失敗した場合は消しておく
-        SetTexture(nullptr);
-        return;
+        mMesh.Build(*atlas, mText);
+        mMeshDirty = false;
+    }
+    return atlas;
+}
+
+//----------------------------------------------------------------------
+// 表示の倍率
+//  - 通常のフォントは GetFont で DPI を掛けたサイズで描いてあるので、
+//    指定が無ければ等倍
+//  - SDF フォントは基準サイズで描いてあるので、DPI もここで掛ける
+//----------------------------------------------------------------------
+float TextSpriteComponent::ComputeFontScale() const
+{
+    if (!mFont || mFont->GetPointSize() <= 0)
+        return 1.0f;
+
+    const float dpi = GetOwner()->GetApp()->GetRenderer()->GetWindowDisplayScale();
+    const float reference = static_cast<float>(mFont->GetPointSize());
+
+    if (mFont->IsSdf())
+    {
+        const float size = (mFontSize > 0.0f) ? mFontSize : reference;
+        return size * dpi / reference;
     }
+    if (mFontSize > 0.0f)
+    {
+        return mFontSize * dpi / reference;
+    }
+    return 1.0f;
+}
+
+Vector2 TextSpriteComponent::GetTextSize()
+{
+    PrepareMesh();
+    const float s = ComputeFontScale();
+    return Vector2(mMesh.GetWidth() * s, mMesh.GetHeight() * s);
+}
+
+//----------------------------------------------------------------------
+// SpriteBatch へ積む
+//  - 中心は Actor の位置（以前の文字列テクスチャのスプライトと同じ置き方）
+//----------------------------------------------------------------------
+bool TextSpriteComponent::SubmitToBatch(SpriteBatch& batch)
+{
+    GlyphAtlas* atlas = PrepareMesh();
+    if (!atlas) return true;   // 描くものが無い
+
+    // 新しく描いた文字をここで GPU へ送る
+    auto tex = atlas->GetTexture();
+
+    const float scale = ComputeScreenScale();
+    const float fontScale = ComputeFontScale() * scale;
+    const Vector3& pos = GetOwner()->GetPosition();
+
+    mMesh.Submit(batch, tex.get(), mDrawOrder,
+                 Vector2(pos.x * scale, pos.y * scale),
+                 Vector2(mScaleWidth * fontScale, mScaleHeight * fontScale),
+                 mColor, 1.0f, mFont->IsSdf());
+    return true;
+}
+
+//----------------------------------------------------------------------
+// 単体描画
+//  - バッチへ積んですぐに描く
+//----------------------------------------------------------------------
+void TextSpriteComponent::Draw()
+{
+    if (!mIsVisible) return;
+
+    auto batch = GetOwner()->GetApp()->GetRenderer()->GetSpriteBatch();
+    if (!batch) return;
+
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glEnable(GL_BLEND);
+
+    SubmitToBatch(*batch);
+    batch->Flush();
 
-    SetTexture(tex);
-    // サイズは SpriteComponent 側で tex->GetWidth/Height を使ってくれるので
-    // ここでは特にやることなし（スケーリングしたいときは SetScale() を別途呼ぶ）
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(GL_TRUE);
 }
 
 } // namespace toy
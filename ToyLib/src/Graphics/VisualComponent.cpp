@@ -3,6 +3,8 @@
 #include "Engine/Core/Application.h"
 #include "Engine/Render/Renderer.h"
 #include "Engine/Render/LightingManager.h"
+#include "Engine/Render/Shader.h"
+#include "Asset/Material/Texture.h"
 
 namespace toy {
 
@@ -14,6 +16,8 @@ VisualComponent::VisualComponent(Actor* owner, int drawOrder, VisualLayer layer)
 , mLayer(layer)          // 描画レイヤー
 , mDrawOrder(drawOrder)  // レイヤー内の描画順
 , mEnableShadow(false)   // 影を描かない（必要に応じて有効化）
+, mLastDrawnFrame(0)
+, mHasRegion(false)
 {
     // ------------------------------------------------------------
     // Renderer に登録
@@ -29,6 +33,9 @@ VisualComponent::VisualComponent(Actor* owner, int drawOrder, VisualLayer layer)
     // デフォルトの頂点配列（スプライト用クアッド）
     //   - Particle, Sprite, Overlay などが共通して使う
     mVertexArray = renderer->GetSpriteVerts();
+
+    // 生成フレームは描画済み扱い（最初のフレームから更新される）
+    mLastDrawnFrame = renderer->GetFrameCount();
 }
 
 VisualComponent::~VisualComponent()
@@ -42,4 +49,47 @@ VisualComponent::~VisualComponent()
     renderer->RemoveVisualComp(this);
 }
 
+// 前フレームで描画されたか
+//  - Draw() の最後でフレーム番号が進むので、
+//    Update 中は「現在 - 1」以上なら前フレームに描かれている
+bool VisualComponent::WasDrawnLastFrame() const
+{
+    auto renderer = GetOwner()->GetApp()->GetRenderer();
+    return mLastDrawnFrame + 1 >= renderer->GetFrameCount();
+}
+
+// テクスチャと使用領域をシェーダへ
+void VisualComponent::BindTextureRegion(Texture& texture)
+{
+    if (mHasRegion)
+    {
+        mShader->SetVector2Uniform("uTexOffset", Vector2(mRegion.u0, mRegion.v0));
+        mShader->SetVector2Uniform("uTexScale",
+                                   Vector2(mRegion.u1 - mRegion.u0, mRegion.v1 - mRegion.v0));
+    }
+
+    if (texture.IsArray())
+    {
+        texture.SetActive(1);
+        mShader->SetBooleanUniform("uUseArray", true);
+        mShader->SetFloatUniform("uLayer", static_cast<float>(mHasRegion ? mRegion.layer : 0));
+    }
+    else
+    {
+        texture.SetActive(0);
+        mShader->SetTextureUniform("uTexture", 0);
+    }
+}
+
+// 既定（全体・非配列）へ戻す
+void VisualComponent::UnbindTextureRegion()
+{
+    if (mHasRegion)
+    {
+        mShader->SetVector2Uniform("uTexOffset", Vector2(0.0f, 0.0f));
+        mShader->SetVector2Uniform("uTexScale", Vector2(1.0f, 1.0f));
+    }
+    mShader->SetBooleanUniform("uUseArray", false);
+}
+
 } // namespace toy
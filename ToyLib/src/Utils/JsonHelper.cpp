@@ -174,6 +174,30 @@ namespace JsonHelper
         return true;
     }
 
+    bool LoadFromMemory(const void* data, size_t size,
+                        const std::string& name, nlohmann::json& out)
+    {
+        if (!data || size == 0)
+        {
+            std::cerr << "[JsonHelper] Empty json data: " << name << std::endl;
+            return false;
+        }
+
+        const char* begin = static_cast<const char*>(data);
+        try
+        {
+            out = nlohmann::json::parse(begin, begin + size);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "[JsonHelper] JSON parse error in " << name
+                      << ": " << e.what() << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
     //==========================================================================
     // サブオブジェクト取得
     //==========================================================================
@@ -0,0 +1,216 @@
+//==============================================================
+// AnimBench
+//  - Mesh::ComputePoseAtTime のキー探索（AnimationCursor）の計測
+//  - 60 ボーン × 2000 キー（位置・回転・スケールすべて）の合成クリップを作り、
+//    順方向再生 / ランダムシーク / 短い周期のループ を
+//    カーソルあり・なし（毎回二分探索）で比べる
+//
+//  使い方: AnimBench [繰り返し回数]
+//==============================================================
+#include "Asset/Geometry/Mesh.h"
+#include "Asset/Animation/AnimationClip.h"
+#include "Asset/Animation/Skeleton.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace toy;
+
+namespace {
+
+constexpr int   kNumBones       = 60;
+constexpr int   kNumKeys        = 2000;
+constexpr float kTicksPerSecond = 30.0f;
+
+//--------------------------------------------------------------
+// 合成データ
+//  - 親は (i - 1) / 2 の二分木（親が必ず先に並ぶ）
+//  - キーは 1 tick ごと、値はボーンごとに位相をずらした正弦波
+//--------------------------------------------------------------
+void BuildClip(Skeleton& skeleton, std::vector<std::string>& boneNames, AnimationClip& clip)
+{
+    for (int i = 0; i < kNumBones; i++)
+    {
+        std::string name = "bone" + std::to_string(i);
+        skeleton.mNames.push_back(name);
+        skeleton.mParents.push_back(i == 0 ? -1 : (i - 1) / 2);
+        skeleton.mLocalBind.push_back(Matrix4::CreateTranslation(Vector3(0.0f, 1.0f, 0.0f)));
+        boneNames.push_back(name);
+    }
+
+    clip.mName           = "bench";
+    clip.mDuration       = static_cast<float>(kNumKeys - 1);
+    clip.mTicksPerSecond = kTicksPerSecond;
+
+    for (int i = 0; i < kNumBones; i++)
+    {
+        NodeAnimation ch;
+        ch.mNodeName = skeleton.mNames[i];
+        for (int k = 0; k < kNumKeys; k++)
+        {
+            const float t     = static_cast<float>(k);
+            const float phase = 0.05f * t + 0.3f * static_cast<float>(i);
+
+            ch.mPositionTimes.push_back(t);
+            ch.mPositions.push_back(Vector3(std::sin(phase), 1.0f, std::cos(phase)) * 0.1f);
+
+            ch.mRotationTimes.push_back(t);
+            ch.mRotations.push_back(Quaternion(Vector3(0.0f, 1.0f, 0.0f), std::sin(phase)));
+
+            ch.mScalingTimes.push_back(t);
+            ch.mScalings.push_back(Vector3(1.0f, 1.0f, 1.0f) * (1.0f + 0.05f * std::sin(phase)));
+        }
+        clip.mChannels.push_back(std::move(ch));
+    }
+}
+
+//--------------------------------------------------------------
+// 計測する時刻の並び（tick）
+//--------------------------------------------------------------
+std::vector<float> MakeForward(float duration)
+{
+    // 60fps 等速：1 フレーム 0.5 tick、クリップを 1 周
+    std::vector<float> times;
+    const float step = kTicksPerSecond / 60.0f;
+    for (float t = 0.0f; t < duration; t += step)
+    {
+        times.push_back(t);
+    }
+    return times;
+}
+
+std::vector<float> MakeSeek(float duration, size_t count)
+{
+    // 毎回ランダムな位置へ飛ぶ（固定シードの LCG）
+    std::vector<float> times;
+    uint32_t state = 12345u;
+    for (size_t i = 0; i < count; i++)
+    {
+        state = state * 1664525u + 1013904223u;
+        times.push_back(duration * static_cast<float>(state >> 8) / 16777216.0f);
+    }
+    return times;
+}
+
+std::vector<float> MakeLoop(float duration, size_t count)
+{
+    // 120 tick の区間を 8 倍速で回す（数フレームごとに先頭へ戻る）
+    std::vector<float> times;
+    const float loopLength = std::min(120.0f, duration);
+    const float step = 8.0f * kTicksPerSecond / 60.0f;
+    float t = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        times.push_back(t);
+        t = std::fmod(t + step, loopLength);
+    }
+    return times;
+}
+
+//--------------------------------------------------------------
+// 1 回の計測（1 呼び出しあたりのナノ秒、最良値）
+//--------------------------------------------------------------
+double Measure(const Mesh& mesh,
+               const AnimationClip& clip,
+               const std::vector<float>& times,
+               bool useCursor,
+               int repeats,
+               std::vector<Matrix4>& out)
+{
+    std::vector<Matrix4> global;
+    double best = 1e30;
+
+    for (int r = 0; r < repeats; r++)
+    {
+        AnimationCursor cursor;
+        AnimationCursor* c = useCursor ? &cursor : nullptr;
+
+        const auto begin = std::chrono::steady_clock::now();
+        for (float t : times)
+        {
+            mesh.ComputePoseAtTime(t, clip, out, global, c);
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(end - begin).count();
+        best = std::min(best, ns / static_cast<double>(times.size()));
+    }
+    return best;
+}
+
+// カーソルあり・なしで同じ姿勢になるか
+bool SameResult(const Mesh& mesh, const AnimationClip& clip, const std::vector<float>& times)
+{
+    AnimationCursor cursor;
+    std::vector<Matrix4> a, b, global;
+    for (float t : times)
+    {
+        mesh.ComputePoseAtTime(t, clip, a, global, &cursor);
+        mesh.ComputePoseAtTime(t, clip, b, global, nullptr);
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                for (int c = 0; c < 4; c++)
+                {
+                    if (a[i].mat[r][c] != b[i].mat[r][c])
+                        return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int repeats = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 5;
+
+    Skeleton skeleton;
+    std::vector<std::string> boneNames;
+    AnimationClip source;
+    BuildClip(skeleton, boneNames, source);
+
+    Mesh mesh;
+    mesh.SetAnimationData(skeleton, boneNames, { source });
+    const AnimationClip& clip = mesh.GetAnimationClips()[0];
+
+    struct Case
+    {
+        const char*        name;
+        std::vector<float> times;
+    };
+    const Case cases[] = {
+        { "forward", MakeForward(clip.mDuration) },
+        { "seek",    MakeSeek(clip.mDuration, 4000) },
+        { "loop",    MakeLoop(clip.mDuration, 4000) },
+    };
+
+    printf("AnimBench: %d bones x %d keys, best of %d\n", kNumBones, kNumKeys, repeats);
+    printf("%-8s %8s %14s %14s %8s %6s\n",
+           "case", "calls", "cursor ns", "no cursor ns", "speedup", "match");
+
+    std::vector<Matrix4> out;
+    bool allSame = true;
+    for (const Case& c : cases)
+    {
+        const double withCursor    = Measure(mesh, clip, c.times, true,  repeats, out);
+        const double withoutCursor = Measure(mesh, clip, c.times, false, repeats, out);
+        const bool   same          = SameResult(mesh, clip, c.times);
+        allSame = allSame && same;
+
+        printf("%-8s %8zu %14.1f %14.1f %7.2fx %6s\n",
+               c.name, c.times.size(), withCursor, withoutCursor,
+               withoutCursor / withCursor, same ? "yes" : "NO");
+    }
+
+    return allSame ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+//==============================================================
+// TPakBuilder
+//  - アセットフォルダを 1 つの .tpak にまとめる（AssetPack::Build を呼ぶだけ）
+//  - 作った後にパックを開き直し、元のファイルと中身が一致するか確かめる
+//  - できたパックはゲーム側で AssetManager::MountPack に渡す
+//
+//  使い方: TPakBuilder <アセットフォルダ> <出力.tpak> [--no-compress]
+//    --no-compress : LZ4 圧縮をせず、すべて無圧縮で格納する
+//==============================================================
+#include "Asset/File/AssetPack.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace toy;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+void PrintUsage()
+{
+    printf("usage: TPakBuilder <rootDir> <out%s> [--no-compress]\n", AssetPack::kExtension);
+}
+
+//--------------------------------------------------------------
+// 検証：rootDir の各ファイルをパックから引いて中身を比べる
+//  - Build と同じく .tpak / .tmp は対象外、出力先自身も除く
+//--------------------------------------------------------------
+bool Verify(const std::string& rootDir, const std::string& packPath, size_t& numFiles, size_t& numCompressed)
+{
+    AssetPack pack;
+    if (!pack.Open(packPath))
+    {
+        printf("[TPakBuilder] Cannot open: %s\n", packPath.c_str());
+        return false;
+    }
+
+    std::error_code ec;
+    const fs::path root = fs::absolute(rootDir, ec);
+    const fs::path self = fs::absolute(packPath, ec);
+
+    numFiles      = 0;
+    numCompressed = 0;
+
+    std::vector<uint8_t> extracted;
+    for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+    {
+        if (!it->is_regular_file()) continue;
+
+        const fs::path& p = it->path();
+        if (p.extension() == AssetPack::kExtension || p.extension() == ".tmp") continue;
+        if (fs::absolute(p, ec) == self) continue;
+
+        const std::string name = fs::relative(p, root, ec).generic_string();
+        const PackEntry* entry = pack.Find(name);
+        if (!entry)
+        {
+            printf("[TPakBuilder] Missing in pack: %s\n", name.c_str());
+            return false;
+        }
+
+        std::ifstream file(p, std::ios::binary);
+        std::vector<uint8_t> original((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        if (!pack.Extract(*entry, extracted) || extracted != original)
+        {
+            printf("[TPakBuilder] Mismatch: %s\n", name.c_str());
+            return false;
+        }
+
+        numFiles++;
+        if (entry->compression == PackEntry::LZ4) numCompressed++;
+    }
+
+    if (numFiles != pack.GetNumEntries())
+    {
+        printf("[TPakBuilder] Entry count mismatch: %zu files, %zu entries\n", numFiles, pack.GetNumEntries());
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string rootDir;
+    std::string packPath;
+    bool compress = true;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--no-compress") == 0)
+        {
+            compress = false;
+        }
+        else if (rootDir.empty())
+        {
+            rootDir = argv[i];
+        }
+        else if (packPath.empty())
+        {
+            packPath = argv[i];
+        }
+        else
+        {
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (rootDir.empty() || packPath.empty())
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    std::error_code ec;
+    if (!fs::is_directory(rootDir, ec))
+    {
+        printf("[TPakBuilder] Not a directory: %s\n", rootDir.c_str());
+        return 1;
+    }
+
+    if (!AssetPack::Build(rootDir, packPath, compress))
+    {
+        return 1;
+    }
+
+    size_t numFiles = 0;
+    size_t numCompressed = 0;
+    if (!Verify(rootDir, packPath, numFiles, numCompressed))
+    {
+        return 1;
+    }
+
+    printf("[TPakBuilder] OK: %s (%zu files, %zu LZ4)\n", packPath.c_str(), numFiles, numCompressed);
+    return 0;
+}